@@ -21,14 +21,84 @@
 #import <Foundation/Foundation.h>
 
 #import "BBSyncCaptureMessage.h"
+#import "BBSyncCaptureBatch.h"
+
+/**
+ *  A `BBSyncSegment` is one straight, round capped piece of a trace, from
+ *  (`x1`, `y1`) to (`x2`, `y2`) with the given `width`, all in digitizer
+ *  units. The filter can overshoot the edges of the digitizer, its points are
+ *  clamped to 0...kBBSyncCaptureMessageMaxX and 0...kBBSyncCaptureMessageMaxY.
+ */
+typedef struct {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+    float    width;
+} BBSyncSegment;
+
+/**
+ *  Number of segments that always holds the output for a full capture batch.
+ */
+#define BBSyncSegmentsPerBatch 256
+
+/**
+ *  Number of segments that always holds a prediction.
+ */
+#define BBSyncPredictedSegments 33
 
 /**
  *  The 'BBFiltering' class provides the neccessary methods to convert the raw
  *  data from a Boogie Board Sync digitizer into Cocoa/Cocoa Touch objects
  *  which can be used for drawing to a canvas.
+ *
+ *  Each instance filters one stream of samples and keeps all of its trace
+ *  state to itself, so separate instances can be used for separate boards or
+ *  pens, or for re-rendering a recording, on as many threads as needed. A
+ *  single instance must only be used from one thread at a time.
+ *
+ *  The class methods use a shared default instance.
  */
 @interface BBFiltering : NSObject
 
+/**-----------------------------------------------------------------------------
+ * @name Getting the Default Filter
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Returns the filter used by the class methods.
+ *
+ *  @return Shared filter instance.
+ */
++ (instancetype)defaultFilter;
+
+/**-----------------------------------------------------------------------------
+ * @name Choosing a Profile
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Returns the names of the filter profiles built into the SDK, the default
+ *  one first. Each profile is the filter compiled for one board and output
+ *  resolution, so choosing one has no cost per sample:
+ *
+ *  - "sync" filters for the Boogie Board Sync, with lines sharper than on the
+ *    device.
+ *  - "sync-actual" reports the widths the device itself draws.
+ *  - "sync-fine" draws segments from 0.05 mm instead of 0.1 mm, for output at
+ *    high resolutions.
+ *
+ *  @return Array of NSString.
+ */
++ (NSArray *)profileNames;
+
+/**
+ *  Name of the profile this filter runs, one of profileNames. Defaults to
+ *  "sync". Setting it drops any trace in progress; unknown names are ignored.
+ */
+@property (nonatomic, copy) NSString *profileName;
+
 /**-----------------------------------------------------------------------------
  * @name Filtering Paths 
  * -----------------------------------------------------------------------------
@@ -44,4 +114,124 @@
  */
 + (NSArray *)filteredPathsForCaptureMessage:(BBSyncCaptureMessage *)captureMessage;
 
+/**
+ *  Returns an array of either UIBezierPath or NSBezierPath for a raw capture
+ *  sample, without needing a capture message object.
+ *
+ *  @param x        X coordinate of the sample.
+ *  @param y        Y coordinate of the sample.
+ *  @param pressure Pressure of the sample.
+ *  @param flags    Flags of the sample.
+ *
+ *  @return Array of paths.
+ */
++ (NSArray *)filteredPathsForX:(NSUInteger)x y:(NSUInteger)y pressure:(NSUInteger)pressure flags:(char)flags;
+
+/**
+ *  Returns an array of either UIBezierPath or NSBezierPath depending on the
+ *  corresponding device, using this filter's trace state. The array may
+ *  contain anywhere from 0 to 4 objects.
+ *
+ *  @param captureMessage Capture message returned from a Boogie Board Sync.
+ *
+ *  @return Array of paths.
+ */
+- (NSArray *)filteredPathsForCaptureMessage:(BBSyncCaptureMessage *)captureMessage;
+
+/**
+ *  Returns an array of either UIBezierPath or NSBezierPath for a raw capture
+ *  sample, using this filter's trace state.
+ *
+ *  @param x        X coordinate of the sample.
+ *  @param y        Y coordinate of the sample.
+ *  @param pressure Pressure of the sample.
+ *  @param flags    Flags of the sample.
+ *
+ *  @return Array of paths.
+ */
+- (NSArray *)filteredPathsForX:(NSUInteger)x y:(NSUInteger)y pressure:(NSUInteger)pressure flags:(char)flags;
+
+/**-----------------------------------------------------------------------------
+ * @name Filtering Segments
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Filters every sample in a capture batch, writing the segments one after
+ *  another into a caller owned buffer. No objects are created, which makes
+ *  this much cheaper than asking for paths.
+ *
+ *  @param batch         Samples to filter.
+ *  @param segments      Buffer of at least BBSyncSegmentsPerBatch segments.
+ *  @param segmentCounts Optional buffer of at least CAPTURE_BATCH_CAPACITY
+ *                       entries receiving the number of segments each sample
+ *                       produced, may be NULL.
+ *
+ *  @return Number of segments written.
+ */
+- (NSUInteger)filterCaptureBatch:(const BBSyncCaptureBatch *)batch segments:(BBSyncSegment *)segments segmentCounts:(uint8_t *)segmentCounts;
+
+/**
+ *  Returns an array of either UIBezierPath or NSBezierPath depending on the
+ *  corresponding device, one path per segment.
+ *
+ *  @param segments Segments to convert.
+ *  @param count    Number of segments.
+ *
+ *  @return Array of paths.
+ */
++ (NSArray *)pathsForSegments:(const BBSyncSegment *)segments count:(NSUInteger)count;
+
+/**-----------------------------------------------------------------------------
+ * @name Controlling Traces
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Drops any trace in progress without drawing its remainder. Use this when
+ *  starting on a new stream of samples.
+ */
+- (void)reset;
+
+/**
+ *  Starts a new trace at a contact point, dropping any trace in progress.
+ *
+ *  @param x        X coordinate of the first point.
+ *  @param y        Y coordinate of the first point.
+ *  @param pressure Pressure of the first point.
+ */
+- (void)beginTraceAtX:(NSUInteger)x y:(NSUInteger)y pressure:(NSUInteger)pressure;
+
+/**
+ *  Finishes the trace in progress as if the stylus was lifted after the last
+ *  sample, for example when a stream ends while the stylus is down.
+ *
+ *  @return Array of paths completing the trace.
+ */
+- (NSArray *)endTrace;
+
+/**-----------------------------------------------------------------------------
+ * @name Predicting Ink
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Extrapolates the trace in progress as this filter would draw it if the
+ *  stylus kept its velocity and pressure, so ink can be shown where the
+ *  stylus is about to be rather than trailing it. The segments continue from
+ *  the last one filtered and are provisional: draw them until more samples
+ *  are filtered, then replace them with the next prediction. The filter
+ *  itself is not changed.
+ *
+ *  On replayed handwriting the predicted tip is within about 0.5 mm of where
+ *  the ink goes 28 ms ahead (p50), against 1.7 mm of trailing ink without
+ *  prediction; past 40 ms it overshoots loops more than it helps.
+ *
+ *  @param segments Buffer of at least BBSyncPredictedSegments segments.
+ *  @param interval How far ahead to predict in seconds, at most about 0.22.
+ *
+ *  @return Number of segments written, 0 if no trace is in progress.
+ */
+- (NSUInteger)predictSegments:(BBSyncSegment *)segments interval:(NSTimeInterval)interval;
+
 @end
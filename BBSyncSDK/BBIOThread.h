@@ -0,0 +1,68 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  The `BBIOThread` class is a thread running its own run loop that accessory
+ *  streams can be scheduled on, keeping stream reads and decoding off the
+ *  thread the clients are used from.
+ */
+@interface BBIOThread : NSThread
+
+/**
+ *  Creates and starts a new I/O thread.
+ *
+ *  @param name Name of the thread, shown in the debugger.
+ *
+ *  @return The running thread.
+ */
++ (instancetype)startedThreadWithName:(NSString *)name;
+
+/**
+ *  Runs a block on the I/O thread.
+ *
+ *  @param block Block to run.
+ *  @param wait  Whether to wait for the block to finish. Must be NO when called
+ *  from the I/O thread itself.
+ */
+- (void)performBlock:(dispatch_block_t)block waitUntilDone:(BOOL)wait;
+
+/**
+ *  Schedules the stream on the run loop of the I/O thread and opens it.
+ *
+ *  @param stream Stream to schedule.
+ */
+- (void)scheduleStream:(NSStream *)stream;
+
+/**
+ *  Closes the stream and removes it from the run loop of the I/O thread. Waits
+ *  until the stream is closed.
+ *
+ *  @param stream Stream to unschedule.
+ */
+- (void)unscheduleStream:(NSStream *)stream;
+
+/**
+ *  Stops the run loop after blocks already queued have run.
+ */
+- (void)stop;
+
+@end
@@ -0,0 +1,74 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import "BBIOThread.h"
+
+@implementation BBIOThread
+
++ (instancetype)startedThreadWithName:(NSString *)name {
+    BBIOThread *thread = [[BBIOThread alloc] init];
+    thread.name = name;
+    [thread start];
+    return thread;
+}
+
+- (void)main {
+    @autoreleasepool {
+        // The port only keeps the run loop alive while no stream is scheduled.
+        NSRunLoop *runLoop = [NSRunLoop currentRunLoop];
+        [runLoop addPort:[NSMachPort port] forMode:NSDefaultRunLoopMode];
+        
+        while(![self isCancelled]) {
+            @autoreleasepool {
+                [runLoop runMode:NSDefaultRunLoopMode beforeDate:[NSDate distantFuture]];
+            }
+        }
+    }
+}
+
+- (void)performBlock:(dispatch_block_t)block waitUntilDone:(BOOL)wait {
+    [self performSelector:@selector(runBlock:) onThread:self withObject:[block copy] waitUntilDone:wait];
+}
+
+- (void)runBlock:(dispatch_block_t)block {
+    block();
+}
+
+- (void)scheduleStream:(NSStream *)stream {
+    [self performBlock:^{
+        [stream scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+        [stream open];
+    } waitUntilDone:NO];
+}
+
+- (void)unscheduleStream:(NSStream *)stream {
+    [self performBlock:^{
+        [stream close];
+        [stream removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+    } waitUntilDone:[NSThread currentThread] != self];
+}
+
+- (void)stop {
+    // Cancelling alone does not wake the run loop, the queued block does.
+    [self cancel];
+    [self performBlock:^{} waitUntilDone:NO];
+}
+
+@end
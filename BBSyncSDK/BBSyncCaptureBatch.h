@@ -0,0 +1,36 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+#import "capture_batch.h"
+
+/**
+ *  A `BBSyncCaptureBatch` holds consecutive capture samples reported by a
+ *  Boogie Board Sync as packed arrays. The arrays `x`, `y`, `pressure`,
+ *  `flags`, `reportId` and `timestamp` are valid from index 0 to `count - 1`.
+ *
+ *  Timestamps are monotonic nanoseconds taken when the bytes were read from
+ *  the accessory.
+ *
+ *  @warning A batch handed to a delegate is only valid for the duration of the
+ *  callback. Copy any samples that need to be kept.
+ */
+typedef captureBatch_t BBSyncCaptureBatch;
@@ -19,6 +19,7 @@
 // SOFTWARE.
 
 #import "HIDDataMessage.h"
+#import "BBSyncCaptureBatch.h"
 
 /**
  *  Constant for the maximum X value that a capture message will return.
@@ -30,6 +31,11 @@ extern float const kBBSyncCaptureMessageMaxX;
  */
 extern float const kBBSyncCaptureMessageMaxY;
 
+/**
+ *  Constant for the number of payload bytes in a capture message.
+ */
+extern NSUInteger const kBBSyncCaptureMessageLength;
+
 /**
  *  These constants indicate the type of report returned from the streaming
  *  server.
@@ -96,6 +102,17 @@ typedef NS_ENUM(char, BBSyncCaptureMessageReportId) {
  */
 - (id)initWithReportId:(char)reportId captureData:(NSData *)captureData;
 
+/**
+ *  Initializer that creates a BBSyncCaptureMessage from a sample of a capture
+ *  batch. The payload is only built if it is requested.
+ *
+ *  @param batch Batch containing the sample.
+ *  @param index Index of the sample in the batch.
+ *
+ *  @return initialized capture message.
+ */
+- (id)initWithCaptureBatch:(const BBSyncCaptureBatch *)batch index:(NSUInteger)index;
+
 /**-----------------------------------------------------------------------------
  * @name Identifying Flags
  * -----------------------------------------------------------------------------
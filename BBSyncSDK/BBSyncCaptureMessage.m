@@ -20,16 +20,9 @@
 
 #import "BBSyncCaptureMessage.h"
 
-#define SW_ERASE_FLAG (1 << 7)
-#define SW_SAVE_FLAG (1 << 6)
-#define ERASE_FLAG (1 << 5)
-#define SAVE_FLAG (1 << 4)
-#define RDY_FLAG (1 << 2)
-#define BSW_FLAG (1 << 1)
-#define TSW_FLAG 0x01
-
 float const kBBSyncCaptureMessageMaxX = 20280.0f;
 float const kBBSyncCaptureMessageMaxY = 13942.0f;
+NSUInteger const kBBSyncCaptureMessageLength = CAPTURE_REPORT_LENGTH;
 
 @interface BBSyncCaptureMessage()
 
@@ -59,32 +52,53 @@ float const kBBSyncCaptureMessageMaxY = 13942.0f;
     return self;
 }
 
+- (id)initWithCaptureBatch:(const BBSyncCaptureBatch *)batch index:(NSUInteger)index {
+    self = [super initWithChannel:HIDMessageChannelControl reportType:HIDDataMessageTypeInput reportId:batch->reportId[index] payload:nil];
+    if(self) {
+        _x = batch->x[index];
+        _y = batch->y[index];
+        _pressure = batch->pressure[index];
+        _flags = batch->flags[index];
+    }
+    return self;
+}
+
+- (NSData *)payload {
+    NSData *payload = [super payload];
+    if(payload == nil) {
+        // Messages created from a batch rebuild the raw report on demand.
+        const unsigned char bytes[] = {_x & 0xFF, _x >> 8, _y & 0xFF, _y >> 8, _pressure & 0xFF, _pressure >> 8, _flags};
+        payload = [NSData dataWithBytes:bytes length:sizeof(bytes)];
+    }
+    return payload;
+}
+
 - (BOOL)hasSaveFlag {
-    return (self.flags & SAVE_FLAG) == SAVE_FLAG;
+    return (self.flags & CAPTURE_FLAG_SAVE) == CAPTURE_FLAG_SAVE;
 }
 
 - (BOOL)hasEraseFlag {
-    return (self.flags & ERASE_FLAG) == ERASE_FLAG;
+    return (self.flags & CAPTURE_FLAG_ERASE) == CAPTURE_FLAG_ERASE;
 }
 
 - (BOOL)hasEraseSwitchFlag {
-    return (self.flags & SW_ERASE_FLAG) == SW_ERASE_FLAG;
+    return (self.flags & CAPTURE_FLAG_ERASE_SWITCH) == CAPTURE_FLAG_ERASE_SWITCH;
 }
 
 - (BOOL)hasSaveSwitchFlag {
-    return (self.flags & SW_SAVE_FLAG) == SW_SAVE_FLAG;
+    return (self.flags & CAPTURE_FLAG_SAVE_SWITCH) == CAPTURE_FLAG_SAVE_SWITCH;
 }
 
 - (BOOL)hasReadyFlag {
-    return (self.flags & RDY_FLAG) == RDY_FLAG;
+    return (self.flags & CAPTURE_FLAG_READY) == CAPTURE_FLAG_READY;
 }
 
 - (BOOL)hasBarrelSwitchFlag {
-    return (self.flags & BSW_FLAG) == BSW_FLAG;
+    return (self.flags & CAPTURE_FLAG_BARREL_SWITCH) == CAPTURE_FLAG_BARREL_SWITCH;
 }
 
 - (BOOL)hasTipSwitchFlag {
-    return (self.flags & TSW_FLAG) == TSW_FLAG;
+    return (self.flags & CAPTURE_FLAG_TIP_SWITCH) == CAPTURE_FLAG_TIP_SWITCH;
 }
 
 @end
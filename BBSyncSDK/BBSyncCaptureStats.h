@@ -0,0 +1,113 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+#import "capture_stats.h"
+
+/**
+ *  These constants indicate the stage of the capture pipeline. Each stage's
+ *  latency is measured from the end of the stage before it.
+ */
+typedef NS_ENUM(NSInteger, BBSyncCaptureStage) {
+    /**
+     *  From the bytes being read off the accessory stream to the frame being
+     *  decoded and queued.
+     */
+    BBSyncCaptureStageDecode = CAPTURE_STAGE_DECODE,
+    /**
+     *  From the sample being decoded to the filter emitting its paths,
+     *  including any time spent waiting for the delegate queue.
+     */
+    BBSyncCaptureStageFilter = CAPTURE_STAGE_FILTER,
+    /**
+     *  From the filter emitting paths to the delegate methods returning.
+     */
+    BBSyncCaptureStageDispatch = CAPTURE_STAGE_DISPATCH,
+    /**
+     *  From the bytes being read to the delegate methods returning.
+     */
+    BBSyncCaptureStageTotal = CAPTURE_STAGE_TOTAL
+};
+
+/**
+ *  A `BBSyncCaptureStats` object is a snapshot of the latency histograms and
+ *  sample counters of the streaming client's capture pipeline.
+ */
+@interface BBSyncCaptureStats : NSObject
+
+/**
+ *  Initializes a snapshot by copying the raw statistics.
+ *
+ *  @param stats Statistics to copy.
+ *
+ *  @return An initialized snapshot.
+ */
+- (instancetype)initWithStats:(const captureStats_t *)stats;
+
+/**
+ *  Number of samples that completed the stage.
+ *
+ *  @param stage Stage of the pipeline.
+ *
+ *  @return Number of samples.
+ */
+- (NSUInteger)sampleCountForStage:(BBSyncCaptureStage)stage;
+
+/**
+ *  Samples per second that completed the stage, measured over the last full
+ *  second.
+ *
+ *  @param stage Stage of the pipeline.
+ *
+ *  @return Samples per second.
+ */
+- (double)samplesPerSecondForStage:(BBSyncCaptureStage)stage;
+
+/**
+ *  Latency of the stage that the given percentage of samples did not exceed.
+ *  Values are accurate to about 6%.
+ *
+ *  @param percentile Percentile from 0 to 100, e.g. 99.9.
+ *  @param stage      Stage of the pipeline.
+ *
+ *  @return Latency in seconds.
+ */
+- (NSTimeInterval)latencyAtPercentile:(double)percentile forStage:(BBSyncCaptureStage)stage;
+
+/**
+ *  Mean latency of the stage.
+ *
+ *  @param stage Stage of the pipeline.
+ *
+ *  @return Latency in seconds.
+ */
+- (NSTimeInterval)meanLatencyForStage:(BBSyncCaptureStage)stage;
+
+/**
+ *  Highest latency of the stage.
+ *
+ *  @param stage Stage of the pipeline.
+ *
+ *  @return Latency in seconds.
+ */
+- (NSTimeInterval)maximumLatencyForStage:(BBSyncCaptureStage)stage;
+
+@end
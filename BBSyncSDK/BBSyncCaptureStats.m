@@ -0,0 +1,77 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import "BBSyncCaptureStats.h"
+
+#define NANOS_PER_SECOND 1e9
+
+@interface BBSyncCaptureStats() {
+    captureStats_t _stats;
+}
+
+@end
+
+@implementation BBSyncCaptureStats
+
+- (instancetype)initWithStats:(const captureStats_t *)stats {
+    self = [super init];
+    if(self) {
+        _stats = *stats;
+    }
+    return self;
+}
+
+- (NSUInteger)sampleCountForStage:(BBSyncCaptureStage)stage {
+    return (NSUInteger)_stats.rate[stage].total;
+}
+
+- (double)samplesPerSecondForStage:(BBSyncCaptureStage)stage {
+    return _stats.rate[stage].perSecond;
+}
+
+- (NSTimeInterval)latencyAtPercentile:(double)percentile forStage:(BBSyncCaptureStage)stage {
+    return latencyHistogramValueAtPercentile(&_stats.latency[stage], percentile) / NANOS_PER_SECOND;
+}
+
+- (NSTimeInterval)meanLatencyForStage:(BBSyncCaptureStage)stage {
+    const latencyHistogram_t *histogram = &_stats.latency[stage];
+    if(histogram->total == 0) {
+        return 0;
+    }
+    return (double)histogram->sum / histogram->total / NANOS_PER_SECOND;
+}
+
+- (NSTimeInterval)maximumLatencyForStage:(BBSyncCaptureStage)stage {
+    return _stats.latency[stage].max / NANOS_PER_SECOND;
+}
+
+- (NSString *)description {
+    NSMutableString *description = [NSMutableString stringWithString:[super description]];
+    NSArray *names = @[@"decode", @"filter", @"dispatch", @"total"];
+    for(NSInteger stage = BBSyncCaptureStageDecode; stage <= BBSyncCaptureStageTotal; stage++) {
+        [description appendFormat:@"\n%@: %lu samples, %.1f/s, p50 %.3f ms, p99 %.3f ms, max %.3f ms",
+         names[stage], (unsigned long)[self sampleCountForStage:stage], [self samplesPerSecondForStage:stage],
+         [self latencyAtPercentile:50 forStage:stage] * 1000, [self latencyAtPercentile:99 forStage:stage] * 1000,
+         [self maximumLatencyForStage:stage] * 1000];
+    }
+    return description;
+}
+
+@end
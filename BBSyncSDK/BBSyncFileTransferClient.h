@@ -19,6 +19,7 @@
 // SOFTWARE.
 
 #import <ExternalAccessory/ExternalAccessory.h>
+#import "BBSyncTransport.h"
 #import "BBSyncFileTransferClientDelegate.h"
 #import "OBEXFileTransferFolderListing.h"
 #import "BBSessionController.h"
@@ -95,6 +96,15 @@ extern NSString * const kBBSyncFileTransferErrorDomain;
  */
 - (void)createSessionWithAccessory:(EAAccessory *)accessory;
 
+/**
+ *  Initializes a session over any transport, e.g. a socket connected to the
+ *  device simulator. createSessionWithAccessory: uses this with an accessory
+ *  session.
+ *
+ *  @param transport Transport providing the unopened input and output streams.
+ */
+- (void)createSessionWithTransport:(id<BBSyncTransport>)transport;
+
 /**
  *  Closes the current session if one exists.
  */
@@ -132,6 +142,18 @@ extern NSString * const kBBSyncFileTransferErrorDomain;
  */
 - (void)getFile:(OBEXFileTransferFile *)file;
 
+/**
+ *  Lists the current folder and gets its most recently modified file, e.g. the
+ *  one the Sync just saved when the current folder is where it saves. This is
+ *  an asynchronous call that reports to the completion block rather than the
+ *  delegate.
+ *
+ *  @param completion Block called on the main queue with the file and its
+ *                    data, or with an error if the client is not connected,
+ *                    the folder has no files or a request failed.
+ */
+- (void)getNewestFileWithCompletion:(void (^)(OBEXFileTransferFile *file, NSError *error))completion;
+
 /**
  *  Sends a delete file request to the Sync's file transfer server to delete the
  *  specified file. This is an asynchronous call.
@@ -194,4 +216,19 @@ extern NSString * const kBBSyncFileTransferErrorDomain;
  */
 @property (nonatomic, readonly) NSMutableString *currentDirectoryPath;
 
+/**-----------------------------------------------------------------------------
+ * @name Threading
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  When YES, sessions created afterwards read the accessory streams and frame
+ *  OBEX responses on a dedicated I/O thread. Requests are still made and
+ *  delegate methods still called on the main thread. Defaults to NO.
+ *
+ *  @warning Set this before the session is created, i.e. before the
+ *  BBSessionController connects to the Sync.
+ */
+@property (nonatomic) BOOL usesIOThread;
+
 @end
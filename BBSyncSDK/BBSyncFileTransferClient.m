@@ -24,10 +24,25 @@
 #import "OBEXFileTransferResponse.h"
 #import "OBEXFileTransferFolderListingParser.h"
 #import "BBSyncStreamingClient.h"
+#import "BBIOThread.h"
+#import "byte_ring.h"
+#import "obex_packet.h"
 
 NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomain";
 
-@interface BBSyncFileTransferClient() <NSStreamDelegate>
+#define SESSION_NAME @"FTP"
+
+// Initial buffer sizes, both grow if a packet does not fit.
+#define EAD_INPUT_BUFFER_SIZE 16384
+#define EAD_OUTPUT_BUFFER_SIZE 1024
+
+// Minimum free space offered to each stream read.
+#define EAD_INPUT_READ_SIZE 4096
+
+@interface BBSyncFileTransferClient() <NSStreamDelegate> {
+    byteRing_t _readBuffer;
+    byteRing_t _writeBuffer;
+}
 
 - (void)enqueueRequest:(OBEXFileTransferRequest*)request;
 - (OBEXFileTransferRequest *)dequeueRequest;
@@ -39,9 +54,8 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
 @property (strong) NSMutableArray *requestQueue;
 @property (nonatomic) NSTimer *timeoutTimer;
 @property (nonatomic) OBEXFileTransferFile *tempFile;
-@property (nonatomic) EASession *session;
-@property (nonatomic) NSMutableData *writeData;
-@property (nonatomic) NSMutableData *readData;
+@property (nonatomic) id<BBSyncTransport> session;
+@property (nonatomic) BBIOThread *ioThread;
 @property (nonatomic, readwrite) BBSyncFileTransferClientState state;
 @property (nonatomic, readwrite) NSMutableString *currentDirectoryPath;
 
@@ -56,6 +70,8 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
         _directory = [[NSMutableData alloc] init];
         _state = BBSyncFileTransferClientStateDisconnected;
         _requestQueue = [NSMutableArray new];
+        byteRingInit(&_readBuffer, EAD_INPUT_BUFFER_SIZE);
+        byteRingInit(&_writeBuffer, EAD_OUTPUT_BUFFER_SIZE);
     }
     return self;
 }
@@ -71,17 +87,30 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
 #define FTP_PROTOCOL_NAME @"com.improvelectronics.sync-ftp"
 
 - (void)createSessionWithAccessory:(EAAccessory *)accessory {
-    self.session = [[EASession alloc] initWithAccessory:accessory forProtocol:FTP_PROTOCOL_NAME];
+    EASession *session = [[EASession alloc] initWithAccessory:accessory forProtocol:FTP_PROTOCOL_NAME];
+    if (session) {
+        [self createSessionWithTransport:session];
+    } else {
+        NSLog(@"Creating FTP session failed.");
+    }
+}
+
+- (void)createSessionWithTransport:(id<BBSyncTransport>)transport {
+    self.session = transport;
     if (self.session) {
         NSLog(@"Creating new session.");
         [[self.session inputStream] setDelegate:self];
         [[self.session outputStream] setDelegate:self];
-        [[self.session inputStream] scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
-        [[self.session inputStream] open];
-        [[self.session outputStream] scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
-        [[self.session outputStream] open];
-    } else {
-        NSLog(@"Creating FTP session failed.");
+        if(self.usesIOThread) {
+            self.ioThread = [BBIOThread startedThreadWithName:@"com.improvelectronics.sync-ftp.io"];
+            [self.ioThread scheduleStream:[self.session inputStream]];
+            [self.ioThread scheduleStream:[self.session outputStream]];
+        } else {
+            [[self.session inputStream] scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+            [[self.session inputStream] open];
+            [[self.session outputStream] scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+            [[self.session outputStream] open];
+        }
     }
 }
 
@@ -92,26 +121,35 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
     [self.timeoutTimer invalidate];
     self.connectionID = nil;
     [self.directory setLength:0];
-    self.writeData = nil;
-    self.readData = nil;
+    byteRingClear(&_writeBuffer);
+    byteRingClear(&_readBuffer);
     self.currentDirectoryPath = nil;
 }
 
 - (void)closeSession {
     if(self.session) {
-        [self cleanup];
-        [[self.session inputStream] close];
-        [[self.session inputStream] removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+        if(self.ioThread) {
+            [self.ioThread unscheduleStream:[self.session inputStream]];
+            [self.ioThread unscheduleStream:[self.session outputStream]];
+            [self.ioThread stop];
+            self.ioThread = nil;
+        } else {
+            [[self.session inputStream] close];
+            [[self.session inputStream] removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+            [[self.session outputStream] close];
+            [[self.session outputStream] removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+        }
         [[self.session inputStream] setDelegate:nil];
-        [[self.session outputStream] close];
-        [[self.session outputStream] removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
         [[self.session outputStream] setDelegate:nil];
         self.session = nil;
+        [self cleanup];
     }
 }
 
 - (void)dealloc {
     [self closeSession];
+    byteRingFree(&_readBuffer);
+    byteRingFree(&_writeBuffer);
 }
 
 #pragma mark - Public methods
@@ -119,12 +157,7 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
 - (void)listFolder {
     if(self.state == BBSyncFileTransferClientStateConnected) {
         NSLog(@"Creating list folder request.");
-        OBEXFileTransferRequest *request = [[OBEXFileTransferRequest alloc] initWithOpCode:GET];
-        [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:CONNECTION_ID body:self.connectionID]];
-        [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:NAME]];
-        NSData *folderListingTypeData = [[NSData alloc] initWithBytes:FOLDER_LISTING_TYPE length:22];
-        [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:TYPE body:folderListingTypeData]];
-        [self enqueueRequest:request];
+        [self enqueueRequest:[self listFolderRequest]];
     }
     else {
         NSError *error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:0 userInfo:nil];
@@ -172,14 +205,7 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
 - (void)getFile:(OBEXFileTransferFile *)file {
     if(self.state == BBSyncFileTransferClientStateConnected) {
         NSLog(@"Creating get file request.");
-        // Save the temp file to add the data to.
-        self.tempFile = file;
-        
-        // Construct the descend directory request object.
-        OBEXFileTransferRequest *request  = [[OBEXFileTransferRequest alloc] initWithOpCode:GET];
-        [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:CONNECTION_ID body:self.connectionID]];
-        [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:NAME name:file.name]];
-        [self enqueueRequest:request];
+        [self enqueueRequest:[self getFileRequest:file]];
     }
     else {
         NSError *error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:0 userInfo:nil];
@@ -187,6 +213,51 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
     }
 }
 
+- (void)getNewestFileWithCompletion:(void (^)(OBEXFileTransferFile *file, NSError *error))completion {
+    // Responses arrive on the thread the streams are scheduled on, the result
+    // always goes to the main queue.
+    void (^finish)(OBEXFileTransferFile *, NSError *) = ^(OBEXFileTransferFile *file, NSError *error) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion(file, error);
+        });
+    };
+    
+    if(self.state != BBSyncFileTransferClientStateConnected) {
+        finish(nil, [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:0 userInfo:nil]);
+        return;
+    }
+    
+    NSLog(@"Creating newest file request.");
+    OBEXFileTransferRequest *request = [self listFolderRequest];
+    request.completion = ^(id result, NSError *error) {
+        OBEXFileTransferFolderListing *listing = result;
+        OBEXFileTransferFile *newest = nil;
+        for(OBEXFileTransferFile *file in listing.files) {
+            if(newest == nil || [file.modified compare:newest.modified] == NSOrderedDescending) {
+                newest = file;
+            }
+        }
+        if(newest == nil) {
+            if(error == nil) {
+                error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:0 userInfo:@{ NSLocalizedDescriptionKey : NSLocalizedString(@"The folder has no files.", @"Error that is presented when a folder expected to hold a saved file has none.")}];
+            }
+            finish(nil, error);
+            return;
+        }
+        
+        // A file that fits in one response is only appended to.
+        if(newest.data == nil) {
+            newest.data = [NSMutableData new];
+        }
+        OBEXFileTransferRequest *getRequest = [self getFileRequest:newest];
+        getRequest.completion = ^(id result, NSError *error) {
+            finish(result, error);
+        };
+        [self enqueueRequest:getRequest];
+    };
+    [self enqueueRequest:request];
+}
+
 - (void)deleteFile:(OBEXFileTransferFile *)file {
     if(self.state == BBSyncFileTransferClientStateConnected) {
         NSLog(@"Creating delete request.");
@@ -262,6 +333,26 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
     }
 }
 
+- (OBEXFileTransferRequest *)listFolderRequest {
+    OBEXFileTransferRequest *request = [[OBEXFileTransferRequest alloc] initWithOpCode:GET];
+    [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:CONNECTION_ID body:self.connectionID]];
+    [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:NAME]];
+    NSData *folderListingTypeData = [[NSData alloc] initWithBytes:FOLDER_LISTING_TYPE length:22];
+    [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:TYPE body:folderListingTypeData]];
+    return request;
+}
+
+- (OBEXFileTransferRequest *)getFileRequest:(OBEXFileTransferFile *)file {
+    // Save the temp file to add the data to.
+    self.tempFile = file;
+    
+    // Construct the descend directory request object.
+    OBEXFileTransferRequest *request  = [[OBEXFileTransferRequest alloc] initWithOpCode:GET];
+    [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:CONNECTION_ID body:self.connectionID]];
+    [request addHeader:[[OBEXFileTransferHeader alloc] initWithIdentifier:NAME name:file.name]];
+    return request;
+}
+
 - (void)enqueueRequest:(OBEXFileTransferRequest *)request {
     if(!self.requestQueue) {
         self.requestQueue = [NSMutableArray new];
@@ -317,138 +408,199 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
     NSString *description = @"Could not get a response from the Bluetooth FTP server.";
     NSDictionary *errorDictionary = @{ NSLocalizedDescriptionKey : description};
     NSError *error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:0 userInfo:errorDictionary];
+    
+    // Requests with a completion block hear about it there, the delegate only
+    // if one of its own requests was pending.
+    BOOL notifyDelegate = self.requestQueue.count == 0;
+    for(OBEXFileTransferRequest *request in [self.requestQueue copy]) {
+        if(request.state == BTFtpRequestStateCanceled) {
+            continue;
+        }
+        if(request.completion) {
+            request.completion(nil, error);
+        }
+        else {
+            notifyDelegate = YES;
+        }
+    }
     [self cancelAllRequests];
-    [self.delegate fileTransferClient:self didReceiveError:error];
+    if(notifyDelegate) {
+        [self.delegate fileTransferClient:self didReceiveError:error];
+    }
 }
 
 - (void)sessionDataReceived {
     NSUInteger bytesAvailable = 0;
-    NSError *error = nil;
     
-    // Get the response.
-    while((bytesAvailable = [self readBytesAvailable]) > 0) {
-        NSData *data = [self readData:bytesAvailable];
+    // Handle every complete response packet, a partial one stays buffered until
+    // the rest of it has been read.
+    while((bytesAvailable = [self readBytesAvailable]) >= OBEX_PACKET_HEADER_LENGTH) {
+        const uint8_t *header = byteRingPeek(&_readBuffer, OBEX_PACKET_HEADER_LENGTH);
+        NSUInteger packetLength = ((NSUInteger)header[1] << 8) | header[2];
+        if(packetLength < OBEX_PACKET_HEADER_LENGTH) {
+            NSLog(@"Received malformed packet on %@ session.", SESSION_NAME);
+            byteRingClear(&_readBuffer);
+            break;
+        }
+        if(bytesAvailable < packetLength) {
+            break;
+        }
+        
+        const uint8_t *packet = byteRingPeek(&_readBuffer, packetLength);
+        if(self.ioThread) {
+            // Requests are made and answered on the main queue, so the packet
+            // is copied over there.
+            NSData *data = [NSData dataWithBytes:packet length:packetLength];
+            byteRingConsume(&_readBuffer, packetLength);
+            dispatch_async(dispatch_get_main_queue(), ^{
+                [self.timeoutTimer invalidate];
+                [self responseReceived:data];
+            });
+            continue;
+        }
+        
         // Yay! We got a response back so invalidate the timer.
         [self.timeoutTimer invalidate];
-        if(data) {
-            OBEXFileTransferResponse *response = [[OBEXFileTransferResponse alloc] initWithData:data];
-            OBEXFileTransferRequest *request = [self dequeueRequest];
-            
-            if(request.state == BTFtpRequestStateCanceled) {
+        
+        // The packet is parsed in place. Consuming only moves the read position,
+        // the bytes stay untouched until the next stream read.
+        NSData *data = [NSData dataWithBytesNoCopy:(void *)packet length:packetLength freeWhenDone:NO];
+        byteRingConsume(&_readBuffer, packetLength);
+        [self responseReceived:data];
+    }
+}
+
+- (void)responseReceived:(NSData *)data {
+    NSError *error = nil;
+    OBEXFileTransferRequest *request = [self dequeueRequest];
+    OBEXFileTransferResponse *response = [[OBEXFileTransferResponse alloc] initWithData:data connect:request.code == CONNECT];
+    
+    if(request.state == BTFtpRequestStateCanceled) {
+        [self nextRequest];
+        return;
+    }
+    
+    // Process the response from the server.
+    switch(response.code) {
+        case SUCCESS:
+            if(request.code == CONNECT) {
+                NSLog(@"Connected to Bluetooth FTP Server.");
+                self.state = BBSyncFileTransferClientStateConnected;
+                
+                // Save connection id for future requests.
+                self.connectionID = [response dataForHeader:CONNECTION_ID];
+                self.currentDirectoryPath = [NSMutableString stringWithString:@"/"];
+                
+                [self.delegate fileTransferClient:self didConnectWithError:nil];
+            }
+            else if(request.code == DISCONNECT) {
+                NSLog(@"Disconnected from Bluetooth FTP Server.");
+                self.state = BBSyncFileTransferClientStateDisconnected;
+                
                 [self nextRequest];
-                return;
             }
-            
-            // Process the response from the server.
-            switch(response.code) {
-                case SUCCESS:
-                    if(request.code == CONNECT) {
-                        NSLog(@"Connected to Bluetooth FTP Server.");
-                        self.state = BBSyncFileTransferClientStateConnected;
-                        
-                        // Save connection id for future requests.
-                        OBEXFileTransferHeader *header = [[response headers] objectForKey:[NSString stringWithFormat:@"%c" , CONNECTION_ID]];
-                        self.connectionID = [[NSData alloc] initWithData:[header data]];
-                        self.currentDirectoryPath = [NSMutableString stringWithString:@"/"];
-                        
-                        [self.delegate fileTransferClient:self didConnectWithError:nil];
-                    }
-                    else if(request.code == DISCONNECT) {
-                        NSLog(@"Disconnected from Bluetooth FTP Server.");
-                        self.state = BBSyncFileTransferClientStateDisconnected;
-                        
-                        [self nextRequest];
-                    }
-                    else if(request.code == PUT) {
-                        [self.delegate fileTransferClient:self didDeleteFile:self.tempFile error:nil];
-                    }
-                    else if(request.code == SET_PATH) {
-                        OBEXFileTransferHeader *nameHeader = [request.headers objectForKey:[NSString stringWithFormat:@"%c",NAME]];
-                        NSString *folderName = [[NSString alloc] initWithData:nameHeader.data encoding:NSUTF16BigEndianStringEncoding];
-                        
-                        // Update the current directory path based on request.
-                        if((request.flags & BACKUP_FLAG) == BACKUP_FLAG) {
-                            self.currentDirectoryPath = [NSMutableString stringWithString:[self.currentDirectoryPath stringByDeletingLastPathComponent]];
-                        }
-                        else if(!folderName || [folderName isEqualToString:@""]) {
-                            self.currentDirectoryPath = [NSMutableString stringWithString:@"/"];
-                        }
-                        else {
-                            [self.currentDirectoryPath appendString:[NSString stringWithFormat:@"%@/",folderName]];
-                        }
-                        
-                        [self.delegate fileTransferClient:self didChangeFolder:folderName error:nil];
-                    }
-                    else if(request.code == GET) {
-                        if(request.headers.count == 3) {
-                            // Add the data to the temporary directory.
-                            OBEXFileTransferHeader *header = [[response headers] objectForKey:[NSString stringWithFormat:@"%c" , END_OF_BODY]];
-                            [self.directory appendData:header.data];
-                            
-                            // Parse the directory data to get the resulting folder listing to send to delegate.
-                            OBEXFileTransferFolderListingParser *parser = [[OBEXFileTransferFolderListingParser alloc] init];
-                            OBEXFileTransferFolderListing *listing = [parser parseData:self.directory];
-                            
-                            // Reset directory data.
-                            [self.directory setLength:0];
-                            
-                            [self.delegate fileTransferClient:self didListFolder:listing error:nil];
-                        }
-                        else {
-                            // Add the data to the temporary file and send to delegate.
-                            OBEXFileTransferHeader *header = [[response headers] objectForKey:[NSString stringWithFormat:@"%c" , END_OF_BODY]];
-                            [self.tempFile.data appendData:[header data]];
-                            
-                            [self.delegate fileTransferClient:self didGetFile:self.tempFile error:nil];
-                        }
+            else if(request.code == PUT) {
+                [self.delegate fileTransferClient:self didDeleteFile:self.tempFile error:nil];
+            }
+            else if(request.code == SET_PATH) {
+                OBEXFileTransferHeader *nameHeader = [request.headers objectForKey:[NSString stringWithFormat:@"%c",NAME]];
+                NSString *folderName = [[NSString alloc] initWithData:nameHeader.data encoding:NSUTF16BigEndianStringEncoding];
+                
+                // Update the current directory path based on request.
+                if((request.flags & BACKUP_FLAG) == BACKUP_FLAG) {
+                    self.currentDirectoryPath = [NSMutableString stringWithString:[self.currentDirectoryPath stringByDeletingLastPathComponent]];
+                }
+                else if(!folderName || [folderName isEqualToString:@""]) {
+                    self.currentDirectoryPath = [NSMutableString stringWithString:@"/"];
+                }
+                else {
+                    [self.currentDirectoryPath appendString:[NSString stringWithFormat:@"%@/",folderName]];
+                }
+                
+                [self.delegate fileTransferClient:self didChangeFolder:folderName error:nil];
+            }
+            else if(request.code == GET) {
+                if(request.headers.count == 3) {
+                    // Add the data to the temporary directory.
+                    [response appendBodyToData:self.directory];
+                    
+                    // Parse the directory data to get the resulting folder listing to send to delegate.
+                    OBEXFileTransferFolderListingParser *parser = [[OBEXFileTransferFolderListingParser alloc] init];
+                    OBEXFileTransferFolderListing *listing = [parser parseData:self.directory];
+                    
+                    // Reset directory data.
+                    [self.directory setLength:0];
+                    
+                    if(request.completion) {
+                        request.completion(listing, nil);
                     }
-                    else if(request.code == ACTION) {
-                        NSLog(@"Moved file to ERASED folder.");
+                    else {
+                        [self.delegate fileTransferClient:self didListFolder:listing error:nil];
                     }
-                    else if(request.code == ABORT) {
-                        NSLog(@"Succesful abort command.");
-                        [self nextRequest];
+                }
+                else {
+                    // Add the data to the temporary file and send to delegate.
+                    if(self.tempFile.data == nil) {
+                        self.tempFile.data = [[NSMutableData alloc] init];
                     }
-                    break;
-                case CONTINUE:
-                    if(request.headers.count == 3) { // Retrieve directory.
-                        OBEXFileTransferHeader *header = response.headers[[NSString stringWithFormat:@"%c" , BODY]];
-                        [self.directory appendData:header.data];
-                        [self enqueueRequest:request];
+                    [response appendBodyToData:self.tempFile.data];
+                    
+                    if(request.completion) {
+                        request.completion(self.tempFile, nil);
                     }
-                    else { // Retrieve file.
-                        OBEXFileTransferHeader * header = [[response headers] objectForKey:[NSString stringWithFormat:@"%c" , BODY]];
-                        if(self.tempFile.data == nil) {
-                            self.tempFile.data = [[NSMutableData alloc] init];
-                        }
-                        [self.tempFile.data appendData:[header data]];
-                        [self enqueueRequest:request];
+                    else {
+                        [self.delegate fileTransferClient:self didGetFile:self.tempFile error:nil];
                     }
-                    break;
-                case FORBIDDEN:
-                    error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:response.code userInfo:@{ NSLocalizedDescriptionKey : NSLocalizedString(@"This operation could not be completed.", @"Error that is presented when the user requested action could not be completed.")}];
-                    break;
-                case BAD_GATEWAY:
-                    error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:response.code userInfo:@{ NSLocalizedDescriptionKey : NSLocalizedString(@"This operation could not be completed.", @"Error that is presented when the user requested action could not be completed.")}];
-                    break;
-                case INTERNAL_SERVER_ERROR:
-                    error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:response.code userInfo:@{ NSLocalizedDescriptionKey : NSLocalizedString(@"This operation could not be completed.", @"Error that is presented when the user requested action could not be completed.")}];
-                    break;
-                default:
-                    error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:response.code userInfo:@{ NSLocalizedDescriptionKey : NSLocalizedString(@"This operation could not be completed.", @"Error that is presented when the user requested action could not be completed.")}];
-                    break;
+                }
+            }
+            else if(request.code == ACTION) {
+                NSLog(@"Moved file to ERASED folder.");
             }
-            
-            // Send error to delegate.
-            if(error && request.code == GET && response.code == FORBIDDEN) { // This is a work around when disconnecting and connecting really quick gives me a forbidden command when listing a directory.
-                NSLog(@"Received FORBIDDEN response, trying the same request again.");
-                error = nil;
+            else if(request.code == ABORT) {
+                NSLog(@"Succesful abort command.");
+                [self nextRequest];
+            }
+            break;
+        case CONTINUE:
+            if(request.headers.count == 3) { // Retrieve directory.
+                [response appendBodyToData:self.directory];
                 [self enqueueRequest:request];
             }
-            else if(error) {
-                NSLog(@"Problem occured with Bluetooth device. Response code: %X. Request code: %X", response.code, request.code);
-                [self.delegate fileTransferClient:self didReceiveError:error];
+            else { // Retrieve file.
+                if(self.tempFile.data == nil) {
+                    self.tempFile.data = [[NSMutableData alloc] init];
+                }
+                [response appendBodyToData:self.tempFile.data];
+                [self enqueueRequest:request];
             }
+            break;
+        case FORBIDDEN:
+            error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:response.code userInfo:@{ NSLocalizedDescriptionKey : NSLocalizedString(@"This operation could not be completed.", @"Error that is presented when the user requested action could not be completed.")}];
+            break;
+        case BAD_GATEWAY:
+            error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:response.code userInfo:@{ NSLocalizedDescriptionKey : NSLocalizedString(@"This operation could not be completed.", @"Error that is presented when the user requested action could not be completed.")}];
+            break;
+        case INTERNAL_SERVER_ERROR:
+            error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:response.code userInfo:@{ NSLocalizedDescriptionKey : NSLocalizedString(@"This operation could not be completed.", @"Error that is presented when the user requested action could not be completed.")}];
+            break;
+        default:
+            error = [[NSError alloc] initWithDomain:kBBSyncFileTransferErrorDomain code:response.code userInfo:@{ NSLocalizedDescriptionKey : NSLocalizedString(@"This operation could not be completed.", @"Error that is presented when the user requested action could not be completed.")}];
+            break;
+    }
+    
+    // Send error to delegate.
+    if(error && request.code == GET && response.code == FORBIDDEN) { // This is a work around when disconnecting and connecting really quick gives me a forbidden command when listing a directory.
+        NSLog(@"Received FORBIDDEN response, trying the same request again.");
+        error = nil;
+        [self enqueueRequest:request];
+    }
+    else if(error) {
+        NSLog(@"Problem occured with Bluetooth device. Response code: %X. Request code: %X", response.code, request.code);
+        if(request.completion) {
+            request.completion(nil, error);
+        }
+        else {
+            [self.delegate fileTransferClient:self didReceiveError:error];
         }
     }
 }
@@ -479,61 +631,71 @@ NSString * const kBBSyncFileTransferErrorDomain = @"BBSyncFileTransferErrorDomai
 
 // low level write method - write data to the accessory while there is space available and data to write
 - (void)_writeData {
-    while (([[self.session outputStream] hasSpaceAvailable]) && ([self.writeData length] > 0)) {
-        NSInteger bytesWritten = [[self.session outputStream] write:[self.writeData bytes] maxLength:[self.writeData length]];
+    while (([[self.session outputStream] hasSpaceAvailable]) && (byteRingReadable(&_writeBuffer) > 0)) {
+        // Write straight from the buffer, partial writes just advance the read position.
+        size_t length;
+        const uint8_t *bytes = byteRingReadPointer(&_writeBuffer, &length);
+        NSInteger bytesWritten = [[self.session outputStream] write:bytes maxLength:length];
         if (bytesWritten == -1)
         {
-            NSLog(@"Write error on FTP session.");
+            NSLog(@"Write error on %@ session.", SESSION_NAME);
             break;
         }
         else if (bytesWritten > 0)
         {
-            [self.writeData replaceBytesInRange:NSMakeRange(0, bytesWritten) withBytes:NULL length:0];
+            byteRingConsume(&_writeBuffer, bytesWritten);
+        }
+        else
+        {
+            break;
         }
     }
 }
 
-// low level read method - read data while there is data and space available in the input buffer
+// low level read method - read straight into the free space of the input buffer while there is data available
 - (void)_readData {
-#define EAD_INPUT_BUFFER_SIZE 256
-    uint8_t buf[EAD_INPUT_BUFFER_SIZE];
-    NSInteger bytesRead = 0;
+    BOOL bytesReceived = NO;
     while ([self.session.inputStream hasBytesAvailable]) {
-        bytesRead = [self.session.inputStream read:buf maxLength:EAD_INPUT_BUFFER_SIZE];
-        if (self.readData == nil) {
-            self.readData = [[NSMutableData alloc] init];
+        size_t length;
+        uint8_t *buf = byteRingWritePointer(&_readBuffer, EAD_INPUT_READ_SIZE, &length);
+        if (buf == NULL) {
+            NSLog(@"Could not grow input buffer on %@ session.", SESSION_NAME);
+            break;
+        }
+        
+        NSInteger bytesRead = [self.session.inputStream read:buf maxLength:length];
+        if (bytesRead <= 0) {
+            break;
         }
-        [self.readData appendBytes:(void *)buf length:bytesRead];
+        byteRingCommit(&_readBuffer, bytesRead);
+        bytesReceived = YES;
     }
-    
-    if(bytesRead > 0) {
+
+    if(bytesReceived) {
         [self sessionDataReceived];
     }
 }
 
 // high level write data method
 - (void)writeData:(NSData *)data {
-    if (self.writeData == nil) {
-        self.writeData = [[NSMutableData alloc] init];
+    // The output buffer belongs to the thread the streams are scheduled on.
+    BBIOThread *ioThread = self.ioThread;
+    if (ioThread && [NSThread currentThread] != ioThread) {
+        [ioThread performBlock:^{
+            [self writeData:data];
+        } waitUntilDone:NO];
+        return;
     }
-    [self.writeData appendData:data];
-    [self _writeData];
-}
-
-// high level read method
-- (NSData *)readData:(NSUInteger)bytesToRead {
-    NSData *data = nil;
-    if ([self.readData length] >= bytesToRead) {
-        NSRange range = NSMakeRange(0, bytesToRead);
-        data = [self.readData subdataWithRange:range];
-        [self.readData replaceBytesInRange:range withBytes:NULL length:0];
+    
+    if (byteRingWrite(&_writeBuffer, [data bytes], [data length]) != 0) {
+        NSLog(@"Could not grow output buffer on %@ session.", SESSION_NAME);
     }
-    return data;
+    [self _writeData];
 }
 
 // get number of bytes read into local buffer
 - (NSUInteger)readBytesAvailable {
-    return self.readData.length;
+    return byteRingReadable(&_readBuffer);
 }
 
-@end
\ No newline at end of file
+@end
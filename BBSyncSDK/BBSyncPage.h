@@ -0,0 +1,125 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+
+#import "BBSyncStroke.h"
+#import "OBEXFileTransferFile.h"
+
+@class BBSyncFileTransferClient;
+
+/**
+ *  A `BBSyncPage` is the ink on a Boogie Board Sync's screen at the moment it
+ *  saved, made from the strokes the streaming client already holds. It comes
+ *  with BBSyncStreamingClientDidSave, as soon as the save is reported, rather
+ *  than after downloading the file the Sync saved.
+ *
+ *  The page is complete when capture saw every stroke on it, i.e. the screen
+ *  was erased since capture started, nothing was lost since and no stroke was
+ *  in progress. Otherwise the Sync's file holds ink the page lacks, and
+ *  reconcileWithFileTransferClient:completion: downloads it, only then.
+ */
+@interface BBSyncPage : NSObject
+
+/**
+ *  Initializes a page with the strokes on screen.
+ *
+ *  @param strokes  Finished BBSyncStroke objects in the order they were drawn.
+ *  @param index    Number of the page in the session.
+ *  @param complete Whether the strokes are all the ink on the page.
+ *  @param image    Snapshot of the page, may be NULL. It is retained.
+ *
+ *  @return The page.
+ */
+- (instancetype)initWithStrokes:(NSArray *)strokes index:(NSUInteger)index complete:(BOOL)complete image:(CGImageRef)image;
+
+/**-----------------------------------------------------------------------------
+ * @name Getting the Ink
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Number of the page in the session, for strokesOfPageAtIndex: of the
+ *  streaming client.
+ */
+@property (nonatomic, readonly) NSUInteger index;
+
+/**
+ *  BBSyncStroke objects on the page, in the order they were drawn.
+ */
+@property (nonatomic, readonly) NSArray *strokes;
+
+/**
+ *  When the Sync saved the page.
+ */
+@property (nonatomic, readonly) NSDate *date;
+
+/**
+ *  Bounds of the ink in digitizer units, CGRectNull if the page is blank.
+ */
+@property (nonatomic, readonly) CGRect bounds;
+
+/**
+ *  Grayscale image of the page, white paper and black ink, at the
+ *  streaming client's pageImageDPI, or NULL if that was 0. It is copied from
+ *  pixels kept current as the ink arrived, so it costs no drawing at the save.
+ */
+@property (nonatomic, readonly) CGImageRef image;
+
+/**
+ *  Draws the strokes in digitizer units.
+ *
+ *  @param context Context to draw into.
+ */
+- (void)drawInContext:(CGContextRef)context;
+
+/**-----------------------------------------------------------------------------
+ * @name Reconciling with the Sync
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Whether the strokes are all the ink on the page. When NO, the page lacks
+ *  ink drawn before capture started, while the Sync was in another mode, or
+ *  lost on the way.
+ */
+@property (nonatomic, readonly, getter=isComplete) BOOL complete;
+
+/**
+ *  The file the Sync saved, once reconcileWithFileTransferClient:completion:
+ *  downloaded it, otherwise nil.
+ */
+@property (nonatomic, readonly) OBEXFileTransferFile *deviceFile;
+
+/**
+ *  Makes sure the page has all of its ink. A complete page needs nothing from
+ *  the Sync. Otherwise the newest file in the file transfer client's current
+ *  folder, which should be the folder the Sync saves to, is downloaded into
+ *  deviceFile. Call it on the main queue, whenever the page is needed in
+ *  full.
+ *
+ *  @param client     Connected file transfer client.
+ *  @param completion Block called on the main queue with the page, and an
+ *                    error if the file could not be downloaded.
+ */
+- (void)reconcileWithFileTransferClient:(BBSyncFileTransferClient *)client completion:(void (^)(BBSyncPage *page, NSError *error))completion;
+
+@end
@@ -0,0 +1,72 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import "BBSyncPage.h"
+#import "BBSyncFileTransferClient.h"
+
+@implementation BBSyncPage
+
+- (instancetype)initWithStrokes:(NSArray *)strokes index:(NSUInteger)index complete:(BOOL)complete image:(CGImageRef)image {
+    self = [super init];
+    if (self) {
+        _strokes = [strokes copy];
+        _index = index;
+        _complete = complete;
+        _date = [NSDate date];
+        _image = CGImageRetain(image);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    CGImageRelease(_image);
+}
+
+- (CGRect)bounds {
+    CGRect bounds = CGRectNull;
+    for(BBSyncStroke *stroke in self.strokes) {
+        bounds = CGRectUnion(bounds, stroke.bounds);
+    }
+    return bounds;
+}
+
+- (void)drawInContext:(CGContextRef)context {
+    for(BBSyncStroke *stroke in self.strokes) {
+        [stroke drawInContext:context];
+    }
+}
+
+- (void)reconcileWithFileTransferClient:(BBSyncFileTransferClient *)client completion:(void (^)(BBSyncPage *page, NSError *error))completion {
+    if(self.complete || self.deviceFile) {
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion(self, nil);
+        });
+        return;
+    }
+    
+    [client getNewestFileWithCompletion:^(OBEXFileTransferFile *file, NSError *error) {
+        if(file) {
+            self->_deviceFile = file;
+        }
+        completion(self, error);
+    }];
+}
+
+@end
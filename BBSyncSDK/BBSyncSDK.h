@@ -25,8 +25,13 @@
 #define _BBSYNCSDK_
 
 #import "BBSessionController.h"
+#import "BBSyncCaptureBatch.h"
 #import "BBSyncCaptureMessage.h"
+#import "BBSyncCaptureStats.h"
 #import "BBSyncFileTransferClient.h"
+#import "BBSyncPage.h"
 #import "BBSyncStreamingClient.h"
+#import "BBSyncStroke.h"
+#import "BBSyncTransport.h"
 
 #endif /* _BBSYNCSDK_ */
@@ -19,7 +19,10 @@
 // SOFTWARE.
 
 #import "BBSessionController.h"
+#import "BBSyncTransport.h"
 #import "BBSyncStreamingClientDelegate.h"
+#import "BBSyncCaptureStats.h"
+#import "BBSyncPage.h"
 
 /**
  *  These constants indicate the mode of the steaming client.
@@ -39,12 +42,46 @@ typedef NS_ENUM(char, BBSyncMode) {
     BBSyncModeFile = 0x05
 };
 
+/**
+ *  These constants indicate the format of an exported document.
+ */
+typedef NS_ENUM(NSInteger, BBSyncExportFormat) {
+    /**
+     *  An SVG image.
+     */
+    BBSyncExportFormatSVG = 0,
+    /**
+     *  A PDF document of one page.
+     */
+    BBSyncExportFormatPDF = 1
+};
+
 /**
  *  Posted when a Boogie Baord Sync completed a save.
- *  The notification object is the shared streaming client.
+ *  The notification object is the shared streaming client. When capturing,
+ *  the page that was saved is in the user info under
+ *  BBSyncStreamingClientPageKey. If a document was being exported, its path
+ *  is in the user info under BBSyncStreamingClientExportPathKey.
  */
 extern NSString * const BBSyncStreamingClientDidSave;
 
+/**
+ *  Key of the BBSyncPage saved in the user info of
+ *  BBSyncStreamingClientDidSave.
+ */
+extern NSString * const BBSyncStreamingClientPageKey;
+
+/**
+ *  Key of the path of the exported document in the user info of
+ *  BBSyncStreamingClientDidSave.
+ */
+extern NSString * const BBSyncStreamingClientExportPathKey;
+
+/**
+ *  Default memory budget of the stored pages, 4 MB.
+ */
+extern const NSUInteger BBSyncDefaultPageMemoryBudget;
+
 /**
  *  The 'BBSyncStreamingClient' class facilitates in communicating with a
  *  Boogie Board Sync through a custom data capture protocl based on HID. The
@@ -88,6 +125,15 @@ extern NSString * const BBSyncStreamingClientDidSave;
  */
 - (void)createSessionWithAccessory:(EAAccessory *)accessory;
 
+/**
+ *  Initializes a session over any transport, e.g. a socket connected to the
+ *  device simulator. createSessionWithAccessory: uses this with an accessory
+ *  session.
+ *
+ *  @param transport Transport providing the unopened input and output streams.
+ */
+- (void)createSessionWithTransport:(id<BBSyncTransport>)transport;
+
 /**
  *  Closes the current session if one exists.
  */
@@ -110,6 +156,93 @@ extern NSString * const BBSyncStreamingClientDidSave;
  */
 - (void)setSyncMode:(BBSyncMode)mode;
 
+/**-----------------------------------------------------------------------------
+ * @name Recording and Replaying
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Starts writing every byte read from the Sync, with its arrival time, to a
+ *  recording file. Any recording in progress is stopped first.
+ *
+ *  @param path Path of the recording file, overwritten if it exists.
+ *
+ *  @return YES if the file was created.
+ */
+- (BOOL)startRecordingToPath:(NSString *)path;
+
+/**
+ *  Stops the recording in progress, if any.
+ */
+- (void)stopRecording;
+
+/**
+ *  Starts writing the capture samples and the finished strokes to an archive,
+ *  in the compact format described in `Core/ink_archive.h`. Samples take about
+ *  5 bytes and stroke points about 4, a third of a recording, and an archive
+ *  can be read back with `inkArchiveOpen` without decoding all of it. Any
+ *  archive in progress is stopped first.
+ *
+ *  Call it on the delegateQueue when usesIOThread is YES, otherwise on the
+ *  thread the session runs on.
+ *
+ *  @param path Path of the archive, overwritten if it exists.
+ *
+ *  @return YES if the file was created.
+ */
+- (BOOL)startArchivingToPath:(NSString *)path;
+
+/**
+ *  Writes out the archive in progress, if any, with its index.
+ */
+- (void)stopArchiving;
+
+/**-----------------------------------------------------------------------------
+ * @name Exporting Ink
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Starts writing the ink on the Sync screen to a vector document, the Sync's
+ *  page at its true size. The ink already on screen is written first, then
+ *  every segment as it is filtered, and an erase starts the document over.
+ *  When the Sync saves, the document is finished before
+ *  BBSyncStreamingClientDidSave is posted, which only takes writing its last
+ *  few lines however much ink it holds, and the export stops. Start another
+ *  one from the notification to export the next save. Any export in progress
+ *  is stopped first.
+ *
+ *  Strokes are exported as filtered, also when curveTolerance is set, and
+ *  without their predicted segments.
+ *
+ *  Call it on the delegateQueue when usesIOThread is YES, otherwise on the
+ *  thread the session runs on.
+ *
+ *  @param path   Path of the document, overwritten if it exists.
+ *  @param format Format of the document.
+ *
+ *  @return YES if the file was created.
+ */
+- (BOOL)startExportingToPath:(NSString *)path format:(BBSyncExportFormat)format;
+
+/**
+ *  Finishes the document being exported, if any, without waiting for a save.
+ */
+- (void)stopExporting;
+
+/**
+ *  Feeds a recording back through decoding, filtering and the delegate as if a
+ *  Sync were sending it. Paths, notifications and delegate methods are
+ *  delivered on the delegateQueue.
+ *
+ *  @param path       Path of a file created with startRecordingToPath:.
+ *  @param speed      1 to replay at the recorded pace, 4 for four times as
+ *                    fast, 0 to replay as fast as possible.
+ *  @param completion Block called on the delegateQueue with the number of
+ *                    samples replayed and how long it took, may be nil.
+ */
+- (void)replayRecordingAtPath:(NSString *)path speed:(double)speed completion:(void (^)(NSUInteger samples, NSTimeInterval duration))completion;
+
 /**-----------------------------------------------------------------------------
  * @name Managing the Delegate
  * -----------------------------------------------------------------------------
@@ -120,17 +253,190 @@ extern NSString * const BBSyncStreamingClientDidSave;
  */
 @property (nonatomic, weak) id<BBSyncStreamingClientDelegate> delegate;
 
+/**
+ *  The serial queue delegate methods are called on when usesIOThread is YES
+ *  and while replaying a recording. The paths property is also updated and
+ *  BBSyncStreamingClientDidSave posted on this queue. Defaults to the main
+ *  queue.
+ */
+@property (nonatomic, strong) dispatch_queue_t delegateQueue;
+
+/**-----------------------------------------------------------------------------
+ * @name Threading
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  When YES, sessions created afterwards read and decode the accessory streams
+ *  on a dedicated I/O thread. Decoded samples are handed to the delegateQueue
+ *  through a bounded lock-free queue; if the delegateQueue falls behind, reading
+ *  pauses rather than dropping samples. Defaults to NO, in which case
+ *  everything happens on the thread the session was created on.
+ *
+ *  @warning Set this before the session is created, i.e. before the
+ *  BBSessionController connects to the Sync.
+ */
+@property (nonatomic) BOOL usesIOThread;
+
 /**-----------------------------------------------------------------------------
  * @name Getting State Information
  * -----------------------------------------------------------------------------
  */
 
 /**
- *  Current paths drawn on the Sync screen.
+ *  Strokes currently drawn on the Sync screen, as BBSyncStroke objects in the
+ *  order they were drawn. The last one may still be growing.
+ *  
+ *  @warning This property is only up to date when the current Sync mode is
+ *  BBSyncModeCapture.
+ */
+@property (nonatomic, readonly) NSArray *strokes;
+
+/**
+ *  Current paths drawn on the Sync screen, one per filtered segment. The
+ *  paths are created from strokes each time this property is read; prefer
+ *  strokes, which hold the same ink without an object per segment.
  *  
  *  @warning This property is only up to date when the current Sync mode is
  *  BBSyncModeCapture.
  */
 @property (nonatomic, readonly) NSMutableArray *paths;
 
+/**-----------------------------------------------------------------------------
+ * @name Getting Earlier Pages
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Number of pages stored so far in the session. The ink on screen is stored
+ *  as a page when the Sync saves it, and again when it is erased if ink was
+ *  added since, so erasing no longer loses it.
+ */
+@property (nonatomic, readonly) NSUInteger pageCount;
+
+/**
+ *  Bytes of memory stored pages may take before the oldest ones are written to
+ *  a temporary file, from which they are read back when asked for. Stored
+ *  pages take about half the memory of their strokes. Defaults to
+ *  BBSyncDefaultPageMemoryBudget.
+ */
+@property (nonatomic) NSUInteger pageMemoryBudget;
+
+/**
+ *  Bytes of memory taken by the stored pages.
+ */
+@property (nonatomic, readonly) NSUInteger pageMemory;
+
+/**
+ *  When greater than 0, the ink on screen is also drawn into a grayscale page
+ *  at this many dots per inch as it arrives, and a copy of it is the image of
+ *  every BBSyncPage saved. The cost of drawing follows the new ink, and the
+ *  copy at a save takes well under a millisecond at 200 dpi. Defaults to 0,
+ *  no image.
+ *
+ *  Set it on the delegateQueue when usesIOThread is YES, otherwise on the
+ *  thread the session runs on.
+ */
+@property (nonatomic) CGFloat pageImageDPI;
+
+/**
+ *  Strokes of a stored page, decoded from memory or read back from disk. The
+ *  strokes are new objects on every call; keep them rather than calling again.
+ *
+ *  @param index Page number, from 0 for the first page of the session.
+ *
+ *  @return BBSyncStroke objects in the order they were drawn, or nil if the
+ *  page could not be read.
+ */
+- (NSArray *)strokesOfPageAtIndex:(NSUInteger)index;
+
+/**-----------------------------------------------------------------------------
+ * @name Filtering Ink
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Name of the filter profile for the board this client is connected to, one
+ *  of [BBFiltering profileNames]. Defaults to "sync". Set it before the
+ *  session starts; changing it drops the trace in progress.
+ */
+@property (nonatomic, copy) NSString *filterProfile;
+
+/**
+ *  When greater than 0, the open stroke is given a provisional tail after
+ *  every batch, predicted this many seconds ahead from the filter's velocity,
+ *  in its predictedSegments. The tail is replaced with each update of the
+ *  stroke and dropped when it finishes. 0.015 to 0.03 takes most of the
+ *  visible lag out of the ink; much further ahead the tail overshoots curves.
+ *  Defaults to 0, no prediction.
+ */
+@property (nonatomic) NSTimeInterval predictionInterval;
+
+/**-----------------------------------------------------------------------------
+ * @name Simplifying Ink
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  When greater than 0, each stroke is fitted with cubic Beziers as the stylus
+ *  lifts, within this many digitizer units of the filtered points, and its
+ *  points are replaced with the curves. Fitted strokes take several times less
+ *  memory and have several times fewer segments to draw. 10 to 20, i.e. 0.1 to
+ *  0.2 mm, does not show. Defaults to 0, which keeps every filtered segment.
+ *
+ *  The spatial index keeps the filtered segments, which lie within tolerance
+ *  of the curves.
+ */
+@property (nonatomic) float curveTolerance;
+
+/**-----------------------------------------------------------------------------
+ * @name Finding Ink
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Strokes with ink inside a rectangle, found through a spatial index kept up
+ *  to date as strokes grow rather than by looking at every stroke. Use it to
+ *  redraw part of a view, draw a zoomed in view or select with a lasso.
+ *
+ *  @param rect Rectangle in digitizer units.
+ *
+ *  @return BBSyncStroke objects with a segment whose ink bounds intersect the
+ *  rectangle, in the order they were drawn.
+ */
+- (NSArray *)strokesInRect:(CGRect)rect;
+
+/**
+ *  The stroke whose ink passes closest to a point.
+ *
+ *  @param point     Point in digitizer units.
+ *  @param tolerance How far from the ink the point may be, in digitizer units.
+ *
+ *  @return The stroke, or nil if there is no ink within tolerance of the
+ *  point.
+ */
+- (BBSyncStroke *)strokeAtPoint:(CGPoint)point tolerance:(CGFloat)tolerance;
+
+/**-----------------------------------------------------------------------------
+ * @name Measuring Performance
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ *  Snapshot of the latency histograms and sample rates of each stage of the
+ *  capture pipeline, from reading the accessory stream through decoding,
+ *  filtering and calling the delegate. Taken while capturing, the snapshot is
+ *  approximate.
+ *
+ *  @return The statistics, or nil if they were compiled out by defining
+ *  CAPTURE_STATS_ENABLED as 0.
+ */
+- (BBSyncCaptureStats *)captureStats;
+
+/**
+ *  Clears the capture statistics. Takes effect before the next batch of samples
+ *  is processed.
+ */
+- (void)resetCaptureStats;
+
 @end
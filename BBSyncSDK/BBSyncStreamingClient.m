@@ -21,24 +21,74 @@
 #import "BBSyncStreamingClient.h"
 #import "HIDUtilities.h"
 #import "BBFiltering.h"
+#import "BBSyncStroke.h"
 #import "HIDMessage.h"
 #import "BBSyncCaptureMessage.h"
 #import "HIDSetReport.h"
 #import "HIDGetReport.h"
+#import "BBIOThread.h"
+#import "monotonic_time.h"
+#import "byte_ring.h"
+#import "capture_channel.h"
+#import "capture_stats.h"
+#import "capture_recording.h"
+#import "capture_replay.h"
+#import "ink_archive.h"
+#import "ink_export.h"
+#import "ink_index.h"
+#import "ink_page_store.h"
+#import "ink_raster.h"
 
 NSString * const BBSyncStreamingClientDidSave = @"BBSyncStreamingClientDidSave";
+NSString * const BBSyncStreamingClientExportPathKey = @"BBSyncStreamingClientExportPath";
+NSString * const BBSyncStreamingClientPageKey = @"BBSyncStreamingClientPage";
+const NSUInteger BBSyncDefaultPageMemoryBudget = 4 * 1024 * 1024;
 
-@interface BBSyncStreamingClient() <NSStreamDelegate>
+#define SESSION_NAME @"HID"
+
+// Initial buffer sizes, both grow if a burst does not fit.
+#define EAD_INPUT_BUFFER_SIZE 4096
+#define EAD_OUTPUT_BUFFER_SIZE 256
+
+// Minimum free space offered to each stream read.
+#define EAD_INPUT_READ_SIZE 1024
+
+// Capture batches that can be waiting for the consumer.
+#define CAPTURE_QUEUE_CAPACITY 32
+
+@interface BBSyncStreamingClient() <NSStreamDelegate> {
+    captureChannel_t *_channel;
+#if CAPTURE_STATS_ENABLED
+    captureStats_t *_stats;
+    int _statsResetRequested;
+#endif
+    byteRing_t _readBuffer;
+    byteRing_t _writeBuffer;
+    captureRecorder_t _recorder;
+    inkArchiveWriter_t _archive;
+    inkExportWriter_t _export;
+    NSString *_exportPath;
+    inkIndex_t *_index;
+    inkPageStore_t *_pages;
+    NSUInteger _savedStrokes;
+    inkCanvas_t *_canvas;
+    BOOL _pageComplete;
+    int _captureGap;
+}
 
 @property (nonatomic) BBSessionController *sessionController;
 @property (nonatomic) NSMutableArray *reportQueue;
-@property (nonatomic) EASession *session;
-@property (nonatomic) NSMutableData *writeData;
-@property (nonatomic) NSMutableData *readData;
-@property (nonatomic) NSMutableArray *paths;
+@property (nonatomic) id<BBSyncTransport> session;
+@property (nonatomic) NSMutableArray *strokes;
+@property (nonatomic) BBSyncStroke *currentStroke;
+@property (nonatomic) BBIOThread *ioThread;
+@property (nonatomic) BBFiltering *filter;
 
 - (void)setSyncDeviceFlags;
 - (void)setSyncDateTime;
+- (void)scheduleDrainOfChannel:(captureChannel_t *)channel;
+- (void)captureBatchReceived:(const BBSyncCaptureBatch *)batch;
+- (NSString *)finishExport;
 
 @end
 
@@ -50,13 +100,43 @@ NSString * const BBSyncStreamingClientDidSave = @"BBSyncStreamingClientDidSave";
         // Get reference to the controller.
         _sessionController = [BBSessionController sharedController];
         _reportQueue = [NSMutableArray new];
-        _paths = [NSMutableArray new];
+        _strokes = [NSMutableArray new];
+        _filter = [BBFiltering new];
+        _index = malloc(sizeof(inkIndex_t));
+        inkIndexInit(_index);
+        NSString *spillPath = [NSTemporaryDirectory() stringByAppendingPathComponent:
+                               [NSString stringWithFormat:@"BBSyncPages-%@", [[NSUUID UUID] UUIDString]]];
+        _pages = malloc(sizeof(inkPageStore_t));
+        inkPageStoreInit(_pages, [spillPath fileSystemRepresentation], BBSyncDefaultPageMemoryBudget);
+        _delegateQueue = dispatch_get_main_queue();
+        byteRingInit(&_readBuffer, EAD_INPUT_BUFFER_SIZE);
+        byteRingInit(&_writeBuffer, EAD_OUTPUT_BUFFER_SIZE);
+#if CAPTURE_STATS_ENABLED
+        _stats = malloc(sizeof(captureStats_t));
+        captureStatsReset(_stats);
+#endif
     }
     return self;
 }
 
 - (void)dealloc {
     [self closeSession];
+    captureRecorderClose(&_recorder);
+    [self stopArchiving];
+    [self stopExporting];
+    byteRingFree(&_readBuffer);
+    byteRingFree(&_writeBuffer);
+    inkIndexFree(_index);
+    free(_index);
+    inkPageStoreFree(_pages);
+    free(_pages);
+    if(_canvas) {
+        inkCanvasFree(_canvas);
+        free(_canvas);
+    }
+#if CAPTURE_STATS_ENABLED
+    free(_stats);
+#endif
 }
 
 #pragma mark - Public methods
@@ -72,22 +152,58 @@ NSString * const BBSyncStreamingClientDidSave = @"BBSyncStreamingClientDidSave";
 
 #define HID_PROTOCOL_NAME @"com.improvelectronics.sync-hid"
 
+// Called on the I/O thread when decoded batches are waiting.
+static void captureChannelNotify(void *context) {
+    BBSyncStreamingClient *client = (__bridge BBSyncStreamingClient *)context;
+    [client scheduleDrainOfChannel:client->_channel];
+}
+
 - (void)createSessionWithAccessory:(EAAccessory *)accessory {
-    self.session = [[EASession alloc] initWithAccessory:accessory forProtocol:HID_PROTOCOL_NAME];
+    EASession *session = [[EASession alloc] initWithAccessory:accessory forProtocol:HID_PROTOCOL_NAME];
+    if (session) {
+        [self createSessionWithTransport:session];
+    } else {
+        NSLog(@"Creating HID session failed.");
+    }
+}
+
+- (void)createSessionWithTransport:(id<BBSyncTransport>)transport {
+    self.session = transport;
     if (self.session) {
         NSLog(@"Creating new session.");
+        
+        // Every session gets its own channel so drains still queued for an old
+        // session never see the new one.
+        _channel = malloc(sizeof(captureChannel_t));
+        if (_channel == NULL || captureChannelInit(_channel, CAPTURE_QUEUE_CAPACITY, self.usesIOThread ? captureChannelNotify : NULL, (__bridge void *)self) != 0) {
+            NSLog(@"Could not allocate capture queue on %@ session.", SESSION_NAME);
+            free(_channel);
+            _channel = NULL;
+            self.session = nil;
+            return;
+        }
+        
+        // Start filtering from a clean slate, on the queue the filter runs on.
+        dispatch_async(self.delegateQueue, ^{
+            [self resetFilter];
+        });
+        
         [[self.session inputStream] setDelegate:self];
         [[self.session outputStream] setDelegate:self];
-        [[self.session inputStream] scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
-        [[self.session inputStream] open];
-        [[self.session outputStream] scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
-        [[self.session outputStream] open];
+        if(self.usesIOThread) {
+            self.ioThread = [BBIOThread startedThreadWithName:@"com.improvelectronics.sync-hid.io"];
+            [self.ioThread scheduleStream:[self.session inputStream]];
+            [self.ioThread scheduleStream:[self.session outputStream]];
+        } else {
+            [[self.session inputStream] scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+            [[self.session inputStream] open];
+            [[self.session outputStream] scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+            [[self.session outputStream] open];
+        }
         
         [self setSyncDateTime];
         [self setSyncDeviceFlags];
         [self setSyncMode:BBSyncModeFile];
-    } else {
-        NSLog(@"Creating HID session failed.");
     }
 }
 
@@ -97,16 +213,147 @@ NSString * const BBSyncStreamingClientDidSave = @"BBSyncStreamingClientDidSave";
     }
     
     [self.reportQueue removeAllObjects];
-    self.writeData = nil;
-    self.readData = nil;
     
-    [[self.session inputStream] close];
-    [[self.session inputStream] removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+    BOOL threaded = self.ioThread != nil;
+    if(threaded) {
+        // Queued writes go out before the streams are closed.
+        [self.ioThread unscheduleStream:[self.session inputStream]];
+        [self.ioThread unscheduleStream:[self.session outputStream]];
+        [self.ioThread stop];
+        self.ioThread = nil;
+    } else {
+        [[self.session inputStream] close];
+        [[self.session inputStream] removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+        [[self.session outputStream] close];
+        [[self.session outputStream] removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
+    }
     [[self.session inputStream] setDelegate:nil];
-    [[self.session outputStream] close];
-    [[self.session outputStream] removeFromRunLoop:[NSRunLoop currentRunLoop] forMode:NSDefaultRunLoopMode];
     [[self.session outputStream] setDelegate:nil];
     self.session = nil;
+    
+    byteRingClear(&_writeBuffer);
+    byteRingClear(&_readBuffer);
+    
+    captureChannel_t *channel = _channel;
+    _channel = NULL;
+    if(channel) {
+        if(threaded) {
+            // Free it behind any drain still queued for it.
+            dispatch_async(self.delegateQueue, ^{
+                captureChannelFree(channel);
+                free(channel);
+            });
+        } else {
+            captureChannelFree(channel);
+            free(channel);
+        }
+    }
+}
+
+- (BBSyncCaptureStats *)captureStats {
+#if CAPTURE_STATS_ENABLED
+    return [[BBSyncCaptureStats alloc] initWithStats:_stats];
+#else
+    return nil;
+#endif
+}
+
+- (void)resetCaptureStats {
+#if CAPTURE_STATS_ENABLED
+    // The histograms are only written by the consumer, which resets them
+    // before processing its next batch.
+    __atomic_store_n(&_statsResetRequested, 1, __ATOMIC_RELEASE);
+#endif
+}
+
+- (BOOL)startRecordingToPath:(NSString *)path {
+    __block BOOL started = NO;
+    [self performOnStreamThread:^{
+        captureRecorderClose(&self->_recorder);
+        started = captureRecorderOpen(&self->_recorder, [path fileSystemRepresentation]) == 0;
+    }];
+    if(!started) {
+        NSLog(@"Could not create recording at %@.", path);
+    }
+    return started;
+}
+
+- (void)stopRecording {
+    [self performOnStreamThread:^{
+        captureRecorderClose(&self->_recorder);
+    }];
+}
+
+- (BOOL)startArchivingToPath:(NSString *)path {
+    [self stopArchiving];
+    if(inkArchiveWriterOpen(&_archive, [path fileSystemRepresentation]) != 0) {
+        NSLog(@"Could not create archive at %@.", path);
+        return NO;
+    }
+    return YES;
+}
+
+- (void)stopArchiving {
+    if(_archive.file && inkArchiveWriterClose(&_archive) != 0) {
+        NSLog(@"Could not write archive.");
+    }
+}
+
+- (BOOL)startExportingToPath:(NSString *)path format:(BBSyncExportFormat)format {
+    [self stopExporting];
+    inkExportFormat_t exportFormat = format == BBSyncExportFormatPDF ? INK_EXPORT_PDF : INK_EXPORT_SVG;
+    if(inkExportWriterOpen(&_export, [path fileSystemRepresentation], exportFormat) != 0) {
+        NSLog(@"Could not create document at %@.", path);
+        return NO;
+    }
+    _exportPath = [path copy];
+    
+    // The document starts with the ink on screen.
+    for(BBSyncStroke *stroke in self.strokes) {
+        if(inkExportWriteStroke(&_export, stroke.inkStroke, 0, (uint32_t)stroke.pointCount) != 0) {
+            NSLog(@"Could not write stroke to document.");
+            break;
+        }
+    }
+    return YES;
+}
+
+- (void)stopExporting {
+    [self finishExport];
+}
+
+// Called on the replay queue for every decoded batch.
+static void replayBatchDecoded(void *context, const captureBatch_t *batch) {
+    BBSyncStreamingClient *client = (__bridge BBSyncStreamingClient *)context;
+    dispatch_sync(client.delegateQueue, ^{
+        [client captureBatchReceived:batch];
+    });
+}
+
+- (void)replayRecordingAtPath:(NSString *)path speed:(double)speed completion:(void (^)(NSUInteger samples, NSTimeInterval duration))completion {
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        captureRecording_t recording;
+        
+        dispatch_sync(self.delegateQueue, ^{
+            [self resetFilter];
+        });
+        captureReplayResult_t result = {0};
+        
+        if(captureRecordingOpen(&recording, [path fileSystemRepresentation]) == 0) {
+            captureReplayRun(&recording, speed, replayBatchDecoded, (__bridge void *)self, &result);
+            captureRecordingClose(&recording);
+            NSLog(@"Replayed %llu samples in %.3f s (%.0f samples/s).", result.samples, result.elapsedNanos / 1e9,
+                  result.elapsedNanos > 0 ? result.samples * 1e9 / result.elapsedNanos : 0.0);
+        } else {
+            NSLog(@"Could not read recording at %@.", path);
+        }
+        
+        if(completion) {
+            dispatch_async(self.delegateQueue, ^{
+                completion((NSUInteger)result.samples, result.elapsedNanos / 1e9);
+            });
+        }
+    });
 }
 
 #define ERASE_MODE 0x01
@@ -118,53 +365,428 @@ NSString * const BBSyncStreamingClientDidSave = @"BBSyncStreamingClientDidSave";
 }
 
 - (void)setSyncMode:(BBSyncMode)mode {
+    // Ink drawn outside capture mode is not seen.
+    if(mode != BBSyncModeCapture) {
+        __atomic_store_n(&_captureGap, 1, __ATOMIC_RELEASE);
+    }
     const unsigned char payloadBytes[] = {mode};
     NSData *payload = [NSData dataWithBytes:payloadBytes length:1];
     HIDSetReport *report = [[HIDSetReport alloc] initWithReportType:HIDSetReportTypeFeature reportId:HIDSetReportIdMode payload:payload];
     [self writeData:report.framedData];
 }
 
+- (NSMutableArray *)paths {
+    NSMutableArray *paths = [NSMutableArray new];
+    for(BBSyncStroke *stroke in self.strokes) {
+        [paths addObjectsFromArray:[stroke paths]];
+    }
+    return paths;
+}
+
+static void addStrokeNumber(void *context, const inkIndexEntry_t *entry) {
+    [(__bridge NSMutableIndexSet *)context addIndex:entry->stroke];
+}
+
+- (NSArray *)strokesInRect:(CGRect)rect {
+    rect = CGRectIntersection(CGRectStandardize(rect), CGRectMake(0, 0, UINT16_MAX, UINT16_MAX));
+    if (CGRectIsNull(rect)) {
+        return @[];
+    }
+    
+    inkRect_t r = {CGRectGetMinX(rect), CGRectGetMinY(rect), CGRectGetMaxX(rect), CGRectGetMaxY(rect)};
+    NSMutableIndexSet *strokeNumbers = [NSMutableIndexSet new];
+    inkIndexQueryRect(_index, &r, addStrokeNumber, (__bridge void *)strokeNumbers);
+    return [self.strokes objectsAtIndexes:strokeNumbers];
+}
+
+- (BBSyncStroke *)strokeAtPoint:(CGPoint)point tolerance:(CGFloat)tolerance {
+    uint32_t stroke, segment;
+    if (!inkIndexHitTest(_index, point.x, point.y, tolerance, &stroke, &segment)) {
+        return nil;
+    }
+    return self.strokes[stroke];
+}
+
+- (NSString *)filterProfile {
+    return self.filter.profileName;
+}
+
+- (void)setFilterProfile:(NSString *)filterProfile {
+    self.filter.profileName = filterProfile;
+}
+
+- (NSUInteger)pageCount {
+    return _pages->count;
+}
+
+- (NSUInteger)pageMemoryBudget {
+    return _pages->budget;
+}
+
+- (void)setPageMemoryBudget:(NSUInteger)pageMemoryBudget {
+    if(inkPageStoreSetBudget(_pages, pageMemoryBudget) != 0) {
+        NSLog(@"Could not write pages to disk.");
+    }
+}
+
+- (NSUInteger)pageMemory {
+    return inkPageStoreMemory(_pages);
+}
+
+- (void)setPageImageDPI:(CGFloat)pageImageDPI {
+    if(_canvas) {
+        inkCanvasFree(_canvas);
+        free(_canvas);
+        _canvas = NULL;
+    }
+    _pageImageDPI = 0;
+    if(pageImageDPI <= 0) {
+        return;
+    }
+    
+    _canvas = malloc(sizeof(inkCanvas_t));
+    if(_canvas == NULL || inkCanvasInit(_canvas, pageImageDPI) != 0) {
+        NSLog(@"Could not allocate memory for page image.");
+        free(_canvas);
+        _canvas = NULL;
+        return;
+    }
+    _pageImageDPI = pageImageDPI;
+    for(BBSyncStroke *stroke in self.strokes) {
+        if(inkCanvasDrawStroke(_canvas, stroke.inkStroke, 0, (uint32_t)stroke.pointCount) != 0) {
+            NSLog(@"Could not allocate memory for page image.");
+        }
+    }
+}
+
+- (NSArray *)strokesOfPageAtIndex:(NSUInteger)index {
+    inkPage_t page;
+    inkPageInit(&page);
+    if(inkPageStoreLoad(_pages, index, &page) != 0) {
+        inkPageFree(&page);
+        return nil;
+    }
+    
+    NSMutableArray *strokes = [NSMutableArray arrayWithCapacity:page.count];
+    for(size_t i = 0; i < page.count; i++) {
+        BBSyncStroke *stroke = [[BBSyncStroke alloc] initWithInkStroke:&page.strokes[i]];
+        if(stroke) {
+            [strokes addObject:stroke];
+        }
+    }
+    inkPageFree(&page);
+    return strokes;
+}
+
 #pragma mark - Private methods
 
+// Finishes the document being exported. Returns its path, or nil if there was
+// none or it could not be written.
+- (NSString *)finishExport {
+    if(_export.file == NULL) {
+        return nil;
+    }
+    NSString *path = _exportPath;
+    _exportPath = nil;
+    if(inkExportWriterClose(&_export) != 0) {
+        NSLog(@"Could not write document at %@.", path);
+        return nil;
+    }
+    return path;
+}
+
+// Stores the finished strokes on screen as a page.
+- (void)storePageWithReason:(int)reason {
+    for(BBSyncStroke *stroke in self.strokes) {
+        if(stroke != self.currentStroke && inkPageStoreAddStroke(_pages, stroke.inkStroke) != 0) {
+            NSLog(@"Could not allocate memory for page.");
+        }
+    }
+    if(inkPageStoreEndPage(_pages, reason) != 0) {
+        NSLog(@"Could not store page.");
+    }
+}
+
+static void releasePixels(void *info, const void *data, size_t size) {
+    free((void *)data);
+}
+
+// Copies the page image, white paper and black ink.
+- (CGImageRef)newPageImage {
+    size_t width = _canvas->width, height = _canvas->height;
+    uint8_t *pixels = malloc(width * height);
+    if(pixels == NULL) {
+        NSLog(@"Could not allocate memory for page image.");
+        return NULL;
+    }
+    inkCanvasCopyPixels(_canvas, pixels);
+    
+    CGDataProviderRef provider = CGDataProviderCreateWithData(NULL, pixels, width * height, releasePixels);
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceGray();
+    const CGFloat decode[] = {1.0, 0.0};
+    CGImageRef image = CGImageCreate(width, height, 8, 8, width, colorSpace, (CGBitmapInfo)kCGImageAlphaNone,
+                                     provider, decode, false, kCGRenderingIntentDefault);
+    CGColorSpaceRelease(colorSpace);
+    CGDataProviderRelease(provider);
+    return image;
+}
+
+// The page on screen as the Sync saved it, from the finished strokes.
+- (BBSyncPage *)snapshotPage {
+    NSMutableArray *strokes = [self.strokes mutableCopy];
+    if(self.currentStroke) {
+        [strokes removeObjectIdenticalTo:self.currentStroke];
+    }
+    CGImageRef image = _canvas ? [self newPageImage] : NULL;
+    BBSyncPage *page = [[BBSyncPage alloc] initWithStrokes:strokes index:self.pageCount - 1
+                                                  complete:_pageComplete && self.currentStroke == nil image:image];
+    CGImageRelease(image);
+    return page;
+}
+
+- (void)resetFilter {
+    // A trace cut short or samples from somewhere else leave the page short.
+    _pageComplete = NO;
+    [self.filter reset];
+    [self.currentStroke finish];
+    self.currentStroke = nil;
+}
+
 - (void)sessionDataReceived {
-    NSUInteger bytesAvailable = 0;
+    // The decoder keeps partial frames itself, so everything read can be handed
+    // over in place and consumed. Capture samples are decoded into batches and
+    // queued for the consumer. On the I/O thread a full queue leaves the rest
+    // buffered until the consumer has drained it, otherwise it is drained here.
+    captureChannel_t *channel = _channel;
+    const uint8_t *bytes;
+    size_t length, bytesConsumed;
+    uint64_t timestamp = monotonicTimeNanos();
+    uint32_t crcErrors = channel->decoder.crcErrors;
+    BOOL more;
     
-    while ((bytesAvailable = [self readBytesAvailable]) > 0) {
-        NSData *data = [self readData:bytesAvailable];
-        NSArray *messages = [HIDUtilities parsedMessagesFromData:data];
-        for(HIDMessage *message in messages) {
-            if([message isKindOfClass:[BBSyncCaptureMessage class]]) {
-                BBSyncCaptureMessage *captureMessage = (BBSyncCaptureMessage *)message;
-                NSArray *paths = [BBFiltering filteredPathsForCaptureMessage:captureMessage];
-                
-                if(paths.count > 0) {
-                    [self.paths addObjectsFromArray:paths];
-                }
-                
-                if([captureMessage hasEraseFlag]) {
-                    [self.paths removeAllObjects];
-                }
-                
-                if([captureMessage hasSaveFlag]) {
-                    [[NSNotificationCenter defaultCenter] postNotificationName:BBSyncStreamingClientDidSave object:self];
-                }
-                
-                // Send information to the delegate that is set.
-                if(self.delegate) {
-                    if([self.delegate respondsToSelector:@selector(streamingClient:didReceiveCaptureMessage:)]) {
-                        [self.delegate streamingClient:self didReceiveCaptureMessage:captureMessage];
-                    }
-                    
-                    if([captureMessage hasEraseFlag]) {
-                        [self.delegate syncWasErased];
-                    }
-                    
-                    if(paths.count > 0) {
-                        [self.delegate streamingClient:self didReceivePaths:paths];
-                    }
+    do {
+        bytes = byteRingReadPointer(&_readBuffer, &length);
+        bytesConsumed = captureChannelProduce(channel, bytes, length, timestamp);
+        byteRingConsume(&_readBuffer, bytesConsumed);
+        if(self.ioThread) {
+            more = bytesConsumed > 0 && byteRingReadable(&_readBuffer) > 0;
+        } else {
+            more = [self drainChannel:channel] || byteRingReadable(&_readBuffer) > 0;
+        }
+    } while(more);
+    
+    if(channel->decoder.crcErrors != crcErrors) {
+        __atomic_store_n(&_captureGap, 1, __ATOMIC_RELEASE);
+        NSLog(@"CRC check failed.");
+    }
+}
+
+// Runs the block on the thread the streams are scheduled on and waits for it.
+- (void)performOnStreamThread:(dispatch_block_t)block {
+    BBIOThread *ioThread = self.ioThread;
+    if(ioThread && [NSThread currentThread] != ioThread) {
+        [ioThread performBlock:block waitUntilDone:YES];
+    } else {
+        block();
+    }
+}
+
+// Called on the I/O thread, coalesced until the consumer has started draining.
+- (void)scheduleDrainOfChannel:(captureChannel_t *)channel {
+    BBIOThread *ioThread = self.ioThread;
+    dispatch_async(self.delegateQueue, ^{
+        if([self drainChannel:channel]) {
+            // The I/O thread stopped decoding because the queue was full.
+            [ioThread performBlock:^{
+                if(self->_channel == channel) {
+                    // Decode what was left buffered, then read what the
+                    // stream held back meanwhile, it will not signal again.
+                    [self sessionDataReceived];
+                    [self _readData];
                 }
+            } waitUntilDone:NO];
+        }
+    });
+}
+
+// Processes every queued batch. Returns YES if the producer stalled meanwhile.
+- (BOOL)drainChannel:(captureChannel_t *)channel {
+    BBSyncCaptureBatch batch;
+    
+    captureChannelBeginDrain(channel);
+    while(captureChannelConsume(channel, &batch)) {
+        [self captureBatchReceived:&batch];
+    }
+    return captureChannelEndDrain(channel) != 0;
+}
+
+- (void)captureBatchReceived:(const BBSyncCaptureBatch *)batch {
+    id<BBSyncStreamingClientDelegate> delegate = self.delegate;
+    BOOL wantsMessages = [delegate respondsToSelector:@selector(streamingClient:didReceiveCaptureMessage:)];
+    
+#if CAPTURE_STATS_ENABLED
+    if(__atomic_exchange_n(&_statsResetRequested, 0, __ATOMIC_ACQUIRE)) {
+        captureStatsReset(_stats);
+    }
+#endif
+    
+    // Ink may have been missed since the last batch.
+    if(__atomic_exchange_n(&_captureGap, 0, __ATOMIC_ACQUIRE)) {
+        _pageComplete = NO;
+    }
+    
+    if([delegate respondsToSelector:@selector(streamingClient:didReceiveCaptureBatch:)]) {
+        [delegate streamingClient:self didReceiveCaptureBatch:batch];
+    }
+    
+    // Filter the whole batch up front, path objects are only made for the
+    // samples that produced segments.
+    BBSyncSegment segments[BBSyncSegmentsPerBatch];
+    uint8_t segmentCounts[CAPTURE_BATCH_CAPACITY];
+    NSUInteger segmentCount = [self.filter filterCaptureBatch:batch segments:segments segmentCounts:segmentCounts];
+#if CAPTURE_STATS_ENABLED
+    uint64_t filtered = monotonicTimeNanos();
+#endif
+    
+    // The prediction is made from where the batch left the filter.
+    BBSyncSegment predicted[BBSyncPredictedSegments];
+    NSUInteger predictedCount = 0;
+    if(self.predictionInterval > 0) {
+        predictedCount = [self.filter predictSegments:predicted interval:self.predictionInterval];
+    }
+    
+    BOOL wantsSegments = segmentCount > 0 && [delegate respondsToSelector:@selector(streamingClient:didReceiveSegments:count:)];
+    BOOL wantsStrokes = [delegate respondsToSelector:@selector(streamingClient:didUpdateStroke:)];
+    BOOL wantsPaths = [delegate respondsToSelector:@selector(streamingClient:didReceivePaths:)];
+    
+    if(_archive.file && inkArchiveWriteSamples(&_archive, batch) != 0) {
+        NSLog(@"Could not write samples to archive.");
+    }
+    
+    const BBSyncSegment *sampleSegments = segments;
+    for(NSUInteger i = 0; i < batch->count; i++) {
+        char flags = batch->flags[i];
+        BOOL contact = inkFilterIsContact(flags);
+        BBSyncStroke *updatedStroke = nil;
+        BBSyncPage *savedPage = nil;
+        
+        // Strokes start where the stylus touches and end where it lifts, the
+        // segments finishing a trace come with the sample after its last one.
+        if(contact && self.currentStroke == nil) {
+            self.currentStroke = [BBSyncStroke new];
+            [self.strokes addObject:self.currentStroke];
+        }
+        if(segmentCounts[i] > 0 && self.currentStroke) {
+            NSUInteger indexed = self.currentStroke.pointCount;
+            if(![self.currentStroke appendSegments:sampleSegments count:segmentCounts[i]]) {
+                NSLog(@"Could not allocate memory for stroke.");
+            }
+            if(inkIndexAddSegments(_index, (uint32_t)self.strokes.count - 1, self.currentStroke.points,
+                                   self.currentStroke.widths, (uint32_t)indexed, (uint32_t)self.currentStroke.pointCount) != 0) {
+                NSLog(@"Could not allocate memory for ink index.");
             }
+            updatedStroke = self.currentStroke;
+        }
+        if(segmentCounts[i] > 0 && _export.file && inkExportWriteSegments(&_export, (const inkSegment_t *)sampleSegments, segmentCounts[i]) != 0) {
+            NSLog(@"Could not write segments to document.");
         }
+        for(NSUInteger j = 0; _canvas && j < segmentCounts[i]; j++) {
+            const BBSyncSegment *s = &sampleSegments[j];
+            if(inkCanvasDrawSegment(_canvas, s->x1, s->y1, s->x2, s->y2, s->width) != 0) {
+                NSLog(@"Could not allocate memory for page image.");
+            }
+        }
+        if(!contact && self.currentStroke) {
+            [self.currentStroke finish];
+            if(self.curveTolerance > 0 && ![self.currentStroke fitCurvesWithTolerance:self.curveTolerance]) {
+                NSLog(@"Could not allocate memory for stroke curves.");
+            }
+            if(_archive.file && inkArchiveWriteStroke(&_archive, self.currentStroke.inkStroke) != 0) {
+                NSLog(@"Could not write stroke to archive.");
+            }
+            updatedStroke = self.currentStroke;
+            self.currentStroke = nil;
+        }
+        
+        // The open stroke's tail is replaced once per batch, after its last
+        // sample, and reported with it.
+        if(i == batch->count - 1 && self.predictionInterval > 0 && self.currentStroke) {
+            [self.currentStroke setPredictedSegments:predicted count:predictedCount];
+            updatedStroke = self.currentStroke;
+        }
+        
+        // The Sync keeps the ink on screen when it saves, it is only stored
+        // again on erase if ink was added since.
+        if(flags & CAPTURE_FLAG_SAVE) {
+            [self storePageWithReason:INK_PAGE_SAVED];
+            _savedStrokes = self.strokes.count;
+            savedPage = [self snapshotPage];
+        }
+        if(flags & CAPTURE_FLAG_ERASE) {
+            if(self.strokes.count > _savedStrokes) {
+                [self storePageWithReason:INK_PAGE_ERASED];
+            }
+            _savedStrokes = 0;
+            [self.strokes removeAllObjects];
+            [self.currentStroke finish];
+            self.currentStroke = nil;
+            inkIndexClear(_index);
+            if(_export.file && inkExportClear(&_export) != 0) {
+                NSLog(@"Could not clear document.");
+            }
+            if(_canvas) {
+                inkCanvasClear(_canvas);
+            }
+            
+            // Capture sees every stroke of the next page.
+            _pageComplete = YES;
+        }
+        
+        if(wantsSegments && segmentCounts[i] > 0) {
+            [delegate streamingClient:self didReceiveSegments:sampleSegments count:segmentCounts[i]];
+        }
+        
+        // Path objects are only made if the delegate asks for them.
+        NSArray *paths = nil;
+        if(wantsPaths && segmentCounts[i] > 0) {
+            paths = [BBFiltering pathsForSegments:sampleSegments count:segmentCounts[i]];
+        }
+        sampleSegments += segmentCounts[i];
+        
+        if(flags & CAPTURE_FLAG_SAVE) {
+            NSMutableDictionary *userInfo = [NSMutableDictionary dictionaryWithObject:savedPage forKey:BBSyncStreamingClientPageKey];
+            
+            // The document only needs its ending written.
+            NSString *exportPath = [self finishExport];
+            if(exportPath) {
+                userInfo[BBSyncStreamingClientExportPathKey] = exportPath;
+            }
+            [[NSNotificationCenter defaultCenter] postNotificationName:BBSyncStreamingClientDidSave object:self userInfo:userInfo];
+        }
+        
+        // Send information to the delegate that is set.
+        if(delegate) {
+            // Message objects are only created if the delegate asks for them.
+            if(wantsMessages) {
+                [delegate streamingClient:self didReceiveCaptureMessage:[[BBSyncCaptureMessage alloc] initWithCaptureBatch:batch index:i]];
+            }
+            
+            if(wantsStrokes && updatedStroke) {
+                [delegate streamingClient:self didUpdateStroke:updatedStroke];
+            }
+            
+            if(flags & CAPTURE_FLAG_ERASE) {
+                [delegate syncWasErased];
+            }
+            
+            if(paths.count > 0) {
+                [delegate streamingClient:self didReceivePaths:paths];
+            }
+        }
+        
+#if CAPTURE_STATS_ENABLED
+        captureStatsRecord(_stats, batch->timestamp[i], batch->decoded, filtered, monotonicTimeNanos());
+#endif
     }
 }
 
@@ -230,61 +852,81 @@ NSString * const BBSyncStreamingClientDidSave = @"BBSyncStreamingClientDidSave";
 
 // low level write method - write data to the accessory while there is space available and data to write
 - (void)_writeData {
-    while (([[self.session outputStream] hasSpaceAvailable]) && ([self.writeData length] > 0)) {
-        NSInteger bytesWritten = [[self.session outputStream] write:[self.writeData bytes] maxLength:[self.writeData length]];
+    while (([[self.session outputStream] hasSpaceAvailable]) && (byteRingReadable(&_writeBuffer) > 0)) {
+        // Write straight from the buffer, partial writes just advance the read position.
+        size_t length;
+        const uint8_t *bytes = byteRingReadPointer(&_writeBuffer, &length);
+        NSInteger bytesWritten = [[self.session outputStream] write:bytes maxLength:length];
         if (bytesWritten == -1)
         {
-            NSLog(@"Write error on FTP session.");
+            NSLog(@"Write error on %@ session.", SESSION_NAME);
             break;
         }
         else if (bytesWritten > 0)
         {
-            [self.writeData replaceBytesInRange:NSMakeRange(0, bytesWritten) withBytes:NULL length:0];
+            byteRingConsume(&_writeBuffer, bytesWritten);
+        }
+        else
+        {
+            break;
         }
     }
 }
 
-// low level read method - read data while there is data and space available in the input buffer
+// low level read method - read straight into the free space of the input buffer while there is data available
 - (void)_readData {
-#define EAD_INPUT_BUFFER_SIZE 256
-    uint8_t buf[EAD_INPUT_BUFFER_SIZE];
-    NSInteger bytesRead = 0;
+    BOOL bytesReceived = NO;
+    
+    // While the capture channel is stalled leave the stream alone, so reading
+    // pauses instead of the input buffer growing without bound. The drain that
+    // makes room reads again.
+    if(__atomic_load_n(&_channel->stalled, __ATOMIC_SEQ_CST)) {
+        return;
+    }
     while ([self.session.inputStream hasBytesAvailable]) {
-        bytesRead = [self.session.inputStream read:buf maxLength:EAD_INPUT_BUFFER_SIZE];
-        if (self.readData == nil) {
-            self.readData = [[NSMutableData alloc] init];
+        size_t length;
+        uint8_t *buf = byteRingWritePointer(&_readBuffer, EAD_INPUT_READ_SIZE, &length);
+        if (buf == NULL) {
+            NSLog(@"Could not grow input buffer on %@ session.", SESSION_NAME);
+            break;
+        }
+        
+        NSInteger bytesRead = [self.session.inputStream read:buf maxLength:length];
+        if (bytesRead <= 0) {
+            break;
         }
-        [self.readData appendBytes:(void *)buf length:bytesRead];
+        if (_recorder.file) {
+            captureRecorderWrite(&_recorder, buf, bytesRead, monotonicTimeNanos());
+        }
+        byteRingCommit(&_readBuffer, bytesRead);
+        bytesReceived = YES;
     }
 
-    if(bytesRead > 0) {
+    if(bytesReceived) {
         [self sessionDataReceived];
     }
 }
 
 // high level write data method
 - (void)writeData:(NSData *)data {
-    if (self.writeData == nil) {
-        self.writeData = [[NSMutableData alloc] init];
+    // The output buffer belongs to the thread the streams are scheduled on.
+    BBIOThread *ioThread = self.ioThread;
+    if (ioThread && [NSThread currentThread] != ioThread) {
+        [ioThread performBlock:^{
+            [self writeData:data];
+        } waitUntilDone:NO];
+        return;
     }
-    [self.writeData appendData:data];
-    [self _writeData];
-}
-
-// high level read method
-- (NSData *)readData:(NSUInteger)bytesToRead {
-    NSData *data = nil;
-    if ([self.readData length] >= bytesToRead) {
-        NSRange range = NSMakeRange(0, bytesToRead);
-        data = [self.readData subdataWithRange:range];
-        [self.readData replaceBytesInRange:range withBytes:NULL length:0];
+    
+    if (byteRingWrite(&_writeBuffer, [data bytes], [data length]) != 0) {
+        NSLog(@"Could not grow output buffer on %@ session.", SESSION_NAME);
     }
-    return data;
+    [self _writeData];
 }
 
 // get number of bytes read into local buffer
 - (NSUInteger)readBytesAvailable {
-    return self.readData.length;
+    return byteRingReadable(&_readBuffer);
 }
 
 @end
@@ -20,6 +20,8 @@
 
 #import <Foundation/Foundation.h>
 #import "BBSyncCaptureMessage.h"
+#import "BBFiltering.h"
+#import "BBSyncStroke.h"
 
 @class BBSyncStreamingClient;
 
@@ -31,15 +33,6 @@
  */
 @protocol BBSyncStreamingClientDelegate <NSObject>
 
-/**
- *  Asynchronous callback from the streaming server returning the UIBezier path
- *  objects. These paths can be directly used to draw to a canvas.
- *
- *  @param client The streaming client object that returned the paths.
- *  @param paths  Array of paths.
- */
-- (void)streamingClient:(BBSyncStreamingClient *)client didReceivePaths:(NSArray *)paths;
-
 /**
  *  Callback to inform the delegate that the erase button was pushed on the
  *  Sync.
@@ -48,6 +41,16 @@
 
 @optional
 
+/**
+ *  Asynchronous callback from the streaming server returning the UIBezier path
+ *  objects. These paths can be directly used to draw to a canvas. They are
+ *  only created if the delegate implements this method.
+ *
+ *  @param client The streaming client object that returned the paths.
+ *  @param paths  Array of paths.
+ */
+- (void)streamingClient:(BBSyncStreamingClient *)client didReceivePaths:(NSArray *)paths;
+
 /**
  *  Asynchronous callback from streaming server returning the raw capture
  *  message.
@@ -57,4 +60,40 @@
  */
 - (void)streamingClient:(BBSyncStreamingClient *)client didReceiveCaptureMessage:(BBSyncCaptureMessage *)message;
 
+/**
+ *  Asynchronous callback from streaming server returning the raw capture
+ *  samples decoded from a single read. Prefer this over
+ *  streamingClient:didReceiveCaptureMessage: when handling many samples, no
+ *  objects are created for it.
+ *
+ *  @param client The streaming client object that returned the samples.
+ *  @param batch  Samples, only valid for the duration of the call.
+ */
+- (void)streamingClient:(BBSyncStreamingClient *)client didReceiveCaptureBatch:(const BBSyncCaptureBatch *)batch;
+
+/**
+ *  Asynchronous callback from streaming server returning the filtered
+ *  segments for a sample, before the same segments are reported as paths.
+ *  Prefer this over streamingClient:didReceivePaths: for custom renderers, and
+ *  leave that unimplemented: no objects are created for this one.
+ *
+ *  @param client   The streaming client object that returned the segments.
+ *  @param segments Segments, only valid for the duration of the call.
+ *  @param count    Number of segments.
+ */
+- (void)streamingClient:(BBSyncStreamingClient *)client didReceiveSegments:(const BBSyncSegment *)segments count:(NSUInteger)count;
+
+/**
+ *  Asynchronous callback from streaming server when a stroke started, grew or
+ *  finished. While the stylus is down a stroke's points only grow at its end,
+ *  but its predicted segments are replaced on every update, so redraw the
+ *  newest points and the whole prediction. Once the stroke is finished, redraw
+ *  it in full: its prediction is gone, and with curveTolerance set its points
+ *  have been replaced by the fitted curves.
+ *
+ *  @param client The streaming client object that owns the stroke.
+ *  @param stroke The stroke that changed.
+ */
+- (void)streamingClient:(BBSyncStreamingClient *)client didUpdateStroke:(BBSyncStroke *)stroke;
+
 @end
\ No newline at end of file
@@ -0,0 +1,200 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+
+#import "BBFiltering.h"
+#import "ink_curve.h"
+#import "ink_stroke.h"
+#import "ink_tessellator.h"
+
+/**
+ *  A point of a stroke in digitizer units.
+ */
+typedef inkPoint_t BBSyncPoint;
+
+/**
+ *  A vertex of a stroke mesh in digitizer units.
+ */
+typedef inkVertex_t BBSyncVertex;
+
+/**
+ *  A control point of a fitted curve in digitizer units, its width in
+ *  1/INK_CURVE_WIDTH_SCALE units.
+ */
+typedef inkCurvePoint_t BBSyncCurvePoint;
+
+/**
+ *  A `BBSyncStroke` is one pen down to pen up trace drawn on a Boogie Board
+ *  Sync, held as a variable width polyline in contiguous arrays. An open
+ *  stroke grows as samples arrive; once finished it no longer changes.
+ *
+ *  `widths[i]` is the width of the segment ending at `points[i]`, and
+ *  `widths[0]` repeats `widths[1]`. A dot is two points, possibly equal.
+ */
+@interface BBSyncStroke : NSObject
+
+/**
+ *  Number of points in the stroke.
+ */
+@property (nonatomic, readonly) NSUInteger pointCount;
+
+/**
+ *  Points of the stroke, valid until the stroke next changes.
+ */
+@property (nonatomic, readonly) const BBSyncPoint *points;
+
+/**
+ *  Width at each point in digitizer units, valid until the stroke next
+ *  changes.
+ */
+@property (nonatomic, readonly) const float *widths;
+
+/**
+ *  Smallest rectangle containing all of the ink of the stroke, in digitizer
+ *  units.
+ */
+@property (nonatomic, readonly) CGRect bounds;
+
+/**
+ *  Whether the stylus has been lifted at the end of the stroke.
+ */
+@property (nonatomic, readonly, getter=isFinished) BOOL finished;
+
+/**
+ *  Number of provisional segments extrapolated past the end of an open stroke
+ *  when the streaming client predicts ink, 0 once the stroke is finished.
+ */
+@property (nonatomic, readonly) NSUInteger predictedSegmentCount;
+
+/**
+ *  Provisional segments continuing the stroke to where the stylus is expected
+ *  to be. They are replaced as the stroke grows and are not part of its
+ *  points, bounds or mesh; drawInContext: draws them after the stroke.
+ */
+@property (nonatomic, readonly) const BBSyncSegment *predictedSegments;
+
+/**
+ *  Number of cubic Beziers fitted to the stroke, 0 until
+ *  fitCurvesWithTolerance: is called.
+ */
+@property (nonatomic, readonly) NSUInteger curveCount;
+
+/**
+ *  Control points of the fitted curves, `3 * curveCount + 1` of them: the
+ *  start of the first curve, then the two control points and the end of each
+ *  curve. Widths vary along each curve like the position does.
+ */
+@property (nonatomic, readonly) const BBSyncCurvePoint *curvePoints;
+
+/**
+ *  The stroke as held by the portable core, for its archive and rendering
+ *  functions. Valid until the stroke next changes.
+ */
+@property (nonatomic, readonly) const inkStroke_t *inkStroke;
+
+/**
+ *  Creates a finished stroke with a copy of the points and widths of a stroke
+ *  of the portable core, such as one loaded from a stored page.
+ *
+ *  @param stroke Stroke to copy.
+ *
+ *  @return The stroke, or nil if memory ran out.
+ */
+- (instancetype)initWithInkStroke:(const inkStroke_t *)stroke;
+
+/**
+ *  Extends the stroke with consecutive filtered segments of its trace.
+ *
+ *  @param segments Segments to append.
+ *  @param count    Number of segments.
+ *
+ *  @return NO if memory ran out.
+ */
+- (BOOL)appendSegments:(const BBSyncSegment *)segments count:(NSUInteger)count;
+
+/**
+ *  Replaces the provisional segments predicted past the end of the stroke.
+ *
+ *  @param segments Segments continuing the stroke, copied.
+ *  @param count    Number of segments, at most BBSyncPredictedSegments. 0
+ *                  drops the prediction.
+ */
+- (void)setPredictedSegments:(const BBSyncSegment *)segments count:(NSUInteger)count;
+
+/**
+ *  Marks the stroke as finished, dropping any predicted segments.
+ */
+- (void)finish;
+
+/**
+ *  Fits a few cubic Beziers to the finished stroke and replaces its points
+ *  with the curves, flattened. The curves are fitted within half of tolerance
+ *  and flattened within the other half, so the points drawn stay within
+ *  tolerance of the filtered ones. A stroke of hundreds of filtered segments
+ *  typically becomes a few dozen, and the curves take 5 to 20 times less
+ *  memory than the filtered points.
+ *
+ *  @param tolerance Largest distance in digitizer units between a filtered
+ *                   point and the points drawn, and between its width and
+ *                   theirs. 10 to 20, i.e. 0.1 to 0.2 mm, does not show.
+ *
+ *  @return NO if memory ran out, in which case the stroke is unchanged.
+ */
+- (BOOL)fitCurvesWithTolerance:(float)tolerance;
+
+/**
+ *  Returns an array of either UIBezierPath or NSBezierPath depending on the
+ *  corresponding device, one per segment, as reported by BBFiltering.
+ *
+ *  @return Array of paths.
+ */
+- (NSArray *)paths;
+
+/**
+ *  Strokes every segment with its width and round caps into a context whose
+ *  user space is in digitizer units, then the predicted segments if there
+ *  are any. No objects are created.
+ *
+ *  @param context Context to draw into, using its current stroke color.
+ */
+- (void)drawInContext:(CGContextRef)context;
+
+/**
+ *  Returns the stroke as one triangle strip with round caps and joins, ready
+ *  to upload to the GPU and draw opaque. The mesh is kept with the stroke and
+ *  follows it as it grows: only the end of it is tessellated again, and
+ *  vertices before `firstChanged` are the same as in the previous call with
+ *  the same tolerance.
+ *
+ *  @param tolerance    Largest distance in digitizer units between the round
+ *                      parts of the mesh and true circles.
+ *  @param count        Returns the number of vertices.
+ *  @param firstChanged Returns the first vertex that changed since the last
+ *                      call, may be NULL.
+ *
+ *  @return Vertices valid until the next call, or NULL if memory ran out.
+ */
+- (const BBSyncVertex *)triangleStripWithTolerance:(float)tolerance
+                                             count:(NSUInteger *)count
+                                      firstChanged:(NSUInteger *)firstChanged;
+
+@end
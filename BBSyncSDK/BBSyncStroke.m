@@ -0,0 +1,199 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import "BBSyncStroke.h"
+
+@interface BBSyncStroke () {
+    inkStroke_t _stroke;
+    inkMesh_t _mesh;
+    inkCurves_t _curves;
+    BBSyncSegment *_predicted;
+}
+
+@end
+
+@implementation BBSyncStroke
+
+- (id)init {
+    self = [super init];
+    if (self) {
+        inkStrokeInit(&_stroke);
+        inkMeshInit(&_mesh, 1.0f);
+        inkCurvesInit(&_curves);
+    }
+    return self;
+}
+
+- (instancetype)initWithInkStroke:(const inkStroke_t *)stroke {
+    self = [self init];
+    if (self) {
+        if (inkStrokeAppendPoints(&_stroke, stroke->points, stroke->widths, stroke->count) != 0) {
+            return nil;
+        }
+        _finished = YES;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    inkStrokeFree(&_stroke);
+    inkMeshFree(&_mesh);
+    inkCurvesFree(&_curves);
+    free(_predicted);
+}
+
+- (NSUInteger)pointCount {
+    return _stroke.count;
+}
+
+- (const BBSyncPoint *)points {
+    return _stroke.points;
+}
+
+- (const float *)widths {
+    return _stroke.widths;
+}
+
+- (NSUInteger)curveCount {
+    return _curves.count;
+}
+
+- (const BBSyncCurvePoint *)curvePoints {
+    return _curves.points;
+}
+
+- (const BBSyncSegment *)predictedSegments {
+    return _predicted;
+}
+
+- (const inkStroke_t *)inkStroke {
+    return &_stroke;
+}
+
+- (CGRect)bounds {
+    if (_stroke.count == 0) {
+        return CGRectNull;
+    }
+    inkRect_t r = inkStrokeInkBounds(&_stroke);
+    return CGRectMake(r.minX, r.minY, r.maxX - r.minX, r.maxY - r.minY);
+}
+
+- (BOOL)appendSegments:(const BBSyncSegment *)segments count:(NSUInteger)count {
+    return inkStrokeAppendSegments(&_stroke, (const inkSegment_t *)segments, count) == 0;
+}
+
+- (void)setPredictedSegments:(const BBSyncSegment *)segments count:(NSUInteger)count {
+    if (count > 0 && _predicted == NULL) {
+        _predicted = malloc(BBSyncPredictedSegments * sizeof(BBSyncSegment));
+        if (_predicted == NULL) {
+            count = 0;
+        }
+    }
+    if (count > 0) {
+        memcpy(_predicted, segments, count * sizeof(BBSyncSegment));
+    }
+    _predictedSegmentCount = count;
+}
+
+- (void)finish {
+    _finished = YES;
+    [self setPredictedSegments:NULL count:0];
+}
+
+- (BOOL)fitCurvesWithTolerance:(float)tolerance {
+    inkStroke_t flattened;
+    inkStrokeInit(&flattened);
+    // Half the tolerance goes to fitting and half to flattening, so what is
+    // drawn stays within tolerance of the filtered points.
+    if (inkCurvesFit(&_curves, &_stroke, tolerance*INK_CURVE_FIT_SHARE) != 0 ||
+        inkCurvesFlatten(&_curves, tolerance*(1.0f - INK_CURVE_FIT_SHARE), &flattened) != 0) {
+        _curves.count = 0;
+        inkStrokeFree(&flattened);
+        return NO;
+    }
+    
+    inkStrokeFree(&_stroke);
+    _stroke = flattened;
+    inkMeshReset(&_mesh);
+    return YES;
+}
+
+- (NSArray *)paths {
+    if (_stroke.count < 2) {
+        return @[];
+    }
+    
+    // Rebuild the segments the filter reported.
+    NSUInteger count = _stroke.count - 1;
+    BBSyncSegment *segments = malloc(count * sizeof(BBSyncSegment));
+    if (segments == NULL) {
+        return @[];
+    }
+    for (NSUInteger i = 0; i < count; i++) {
+        segments[i].x1 = _stroke.points[i].x;
+        segments[i].y1 = _stroke.points[i].y;
+        segments[i].x2 = _stroke.points[i + 1].x;
+        segments[i].y2 = _stroke.points[i + 1].y;
+        segments[i].width = _stroke.widths[i + 1];
+    }
+    NSArray *paths = [BBFiltering pathsForSegments:segments count:count];
+    free(segments);
+    return paths;
+}
+
+- (void)drawInContext:(CGContextRef)context {
+    CGContextSaveGState(context);
+    CGContextSetLineCap(context, kCGLineCapRound);
+    for (uint32_t i = 1; i < _stroke.count; i++) {
+        CGContextSetLineWidth(context, _stroke.widths[i]);
+        CGContextMoveToPoint(context, _stroke.points[i - 1].x, _stroke.points[i - 1].y);
+        CGContextAddLineToPoint(context, _stroke.points[i].x, _stroke.points[i].y);
+        CGContextStrokePath(context);
+    }
+    for (NSUInteger i = 0; i < _predictedSegmentCount; i++) {
+        CGContextSetLineWidth(context, _predicted[i].width);
+        CGContextMoveToPoint(context, _predicted[i].x1, _predicted[i].y1);
+        CGContextAddLineToPoint(context, _predicted[i].x2, _predicted[i].y2);
+        CGContextStrokePath(context);
+    }
+    CGContextRestoreGState(context);
+}
+
+- (const BBSyncVertex *)triangleStripWithTolerance:(float)tolerance
+                                             count:(NSUInteger *)count
+                                      firstChanged:(NSUInteger *)firstChanged {
+    if (tolerance != _mesh.tolerance) {
+        inkMeshFree(&_mesh);
+        inkMeshInit(&_mesh, tolerance);
+    }
+    if (inkMeshUpdate(&_mesh, &_stroke) != 0) {
+        NSLog(@"Out of memory tessellating stroke.");
+        *count = 0;
+        return NULL;
+    }
+    
+    *count = _mesh.count;
+    if (firstChanged != NULL) {
+        *firstChanged = _mesh.firstChanged;
+    }
+    return _mesh.vertices;
+}
+
+@end
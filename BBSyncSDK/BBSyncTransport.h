@@ -0,0 +1,67 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import <ExternalAccessory/ExternalAccessory.h>
+
+/**
+ *  The `BBSyncTransport` protocol is adopted by objects that provide the pair
+ *  of byte streams a client talks to a Boogie Board Sync over. The streams are
+ *  handed over unopened; the client schedules, opens and closes them.
+ */
+@protocol BBSyncTransport <NSObject>
+
+/**
+ *  Stream carrying bytes from the Sync.
+ */
+@property (nonatomic, readonly) NSInputStream *inputStream;
+
+/**
+ *  Stream carrying bytes to the Sync.
+ */
+@property (nonatomic, readonly) NSOutputStream *outputStream;
+
+@end
+
+/**
+ *  An accessory session is the transport to a connected Sync.
+ */
+@interface EASession (BBSyncTransport) <BBSyncTransport>
+@end
+
+/**
+ *  The `BBSyncSocketTransport` class provides streams over a connected socket,
+ *  such as one end of a socketpair or a connection to the device simulator
+ *  under Tools.
+ */
+@interface BBSyncSocketTransport : NSObject <BBSyncTransport>
+
+/**
+ *  Initializes the transport with a connected socket.
+ *
+ *  @param socket Socket file descriptor. The transport takes ownership and the
+ *  socket is closed together with the streams.
+ *
+ *  @return An initialized transport, or nil if the streams could not be
+ *  created.
+ */
+- (instancetype)initWithSocket:(int)socket;
+
+@end
@@ -0,0 +1,56 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import "BBSyncTransport.h"
+
+@implementation EASession (BBSyncTransport)
+@end
+
+@interface BBSyncSocketTransport ()
+
+@property (nonatomic, readwrite) NSInputStream *inputStream;
+@property (nonatomic, readwrite) NSOutputStream *outputStream;
+
+@end
+
+@implementation BBSyncSocketTransport
+
+- (instancetype)initWithSocket:(int)socket {
+    self = [super init];
+    if(self) {
+        CFReadStreamRef readStream = NULL;
+        CFWriteStreamRef writeStream = NULL;
+        CFStreamCreatePairWithSocket(kCFAllocatorDefault, socket, &readStream, &writeStream);
+        if(readStream == NULL || writeStream == NULL) {
+            if(readStream) CFRelease(readStream);
+            if(writeStream) CFRelease(writeStream);
+            return nil;
+        }
+        
+        // Closing either stream closes the socket.
+        CFReadStreamSetProperty(readStream, kCFStreamPropertyShouldCloseNativeSocket, kCFBooleanTrue);
+        CFWriteStreamSetProperty(writeStream, kCFStreamPropertyShouldCloseNativeSocket, kCFBooleanTrue);
+        _inputStream = (__bridge_transfer NSInputStream *)readStream;
+        _outputStream = (__bridge_transfer NSOutputStream *)writeStream;
+    }
+    return self;
+}
+
+@end
@@ -0,0 +1,136 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "byte_ring.h"
+
+static size_t roundUpPowerOfTwo(size_t n)
+{
+    size_t p = 16;
+    while (p < n)
+        p <<= 1;
+    return p;
+}
+
+int byteRingInit(byteRing_t *r, size_t capacity)
+{
+    r->capacity = roundUpPowerOfTwo(capacity);
+    r->head = r->tail = 0;
+    r->bytes = malloc(r->capacity);
+    return r->bytes ? 0 : -1;
+}
+
+void byteRingFree(byteRing_t *r)
+{
+    free(r->bytes);
+    r->bytes = NULL;
+    r->capacity = 0;
+    r->head = r->tail = 0;
+}
+
+const uint8_t *byteRingReadPointer(const byteRing_t *r, size_t *length)
+{
+    size_t mask = r->capacity - 1;
+    size_t start = r->head & mask;
+    size_t readable = byteRingReadable(r);
+    size_t contiguous = r->capacity - start;
+
+    *length = readable < contiguous ? readable : contiguous;
+    return r->bytes + start;
+}
+
+// Moves the readable bytes to the front of a buffer of the given capacity.
+static int relocate(byteRing_t *r, size_t capacity)
+{
+    size_t readable = byteRingReadable(r);
+    uint8_t *bytes = malloc(capacity);
+    size_t first;
+    const uint8_t *src;
+
+    if (bytes == NULL)
+        return -1;
+
+    src = byteRingReadPointer(r, &first);
+    memcpy(bytes, src, first);
+    memcpy(bytes + first, r->bytes, readable - first);
+
+    free(r->bytes);
+    r->bytes = bytes;
+    r->capacity = capacity;
+    r->head = 0;
+    r->tail = readable;
+    return 0;
+}
+
+const uint8_t *byteRingPeek(byteRing_t *r, size_t length)
+{
+    size_t contiguous;
+    const uint8_t *bytes;
+
+    if (byteRingReadable(r) < length)
+        return NULL;
+
+    bytes = byteRingReadPointer(r, &contiguous);
+    if (contiguous >= length)
+        return bytes;
+
+    if (relocate(r, r->capacity))
+        return NULL;
+    return r->bytes;
+}
+
+uint8_t *byteRingWritePointer(byteRing_t *r, size_t minimum, size_t *length)
+{
+    size_t mask, start, contiguous, writable;
+
+    if (byteRingWritable(r) < minimum &&
+        relocate(r, roundUpPowerOfTwo(byteRingReadable(r) + minimum)))
+        return NULL;
+
+    mask = r->capacity - 1;
+    start = r->tail & mask;
+    contiguous = r->capacity - start;
+    writable = byteRingWritable(r);
+
+    *length = writable < contiguous ? writable : contiguous;
+    return r->bytes + start;
+}
+
+int byteRingWrite(byteRing_t *r, const void *bytes, size_t length)
+{
+    const uint8_t *src = bytes;
+
+    while (length)
+    {
+        size_t space;
+        uint8_t *dst = byteRingWritePointer(r, length, &space);
+        if (dst == NULL)
+            return -1;
+        if (space > length)
+            space = length;
+        memcpy(dst, src, space);
+        byteRingCommit(r, space);
+        src += space;
+        length -= space;
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _BYTE_RING_H_
+#define _BYTE_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Reusable byte ring buffer for stream I/O. Producers write straight into the
+// free space and commit, consumers read contiguous views in place and consume,
+// so neither side copies or shifts the buffer.
+typedef struct
+{
+    uint8_t *bytes;
+    size_t   capacity;      // Always a power of two.
+    size_t   head;          // Total bytes consumed.
+    size_t   tail;          // Total bytes committed.
+} byteRing_t;
+
+// Allocates the buffer, capacity is rounded up to a power of two. Returns 0 on
+// success, -1 if the allocation failed.
+int byteRingInit(byteRing_t *r, size_t capacity);
+
+void byteRingFree(byteRing_t *r);
+
+// Discards all buffered bytes without releasing the buffer.
+static inline void byteRingClear(byteRing_t *r)
+{
+    r->head = r->tail = 0;
+}
+
+static inline size_t byteRingReadable(const byteRing_t *r)
+{
+    return r->tail - r->head;
+}
+
+static inline size_t byteRingWritable(const byteRing_t *r)
+{
+    return r->capacity - byteRingReadable(r);
+}
+
+// Returns the start of the readable bytes and, in *length, how many of them
+// are contiguous. Bytes past the wrap point follow after consuming these.
+const uint8_t *byteRingReadPointer(const byteRing_t *r, size_t *length);
+
+// Makes the first length readable bytes contiguous and returns them, or NULL
+// if fewer bytes are buffered. Only moves data when the range wraps.
+const uint8_t *byteRingPeek(byteRing_t *r, size_t length);
+
+static inline void byteRingConsume(byteRing_t *r, size_t length)
+{
+    r->head += length;
+    if (r->head == r->tail)
+        r->head = r->tail = 0;  // Restart at the front to keep views contiguous.
+}
+
+// Returns where the next bytes can be written and, in *length, how much
+// contiguous space is there. Grows the buffer first if it has less than
+// minimum bytes free. Returns NULL if growing failed.
+uint8_t *byteRingWritePointer(byteRing_t *r, size_t minimum, size_t *length);
+
+static inline void byteRingCommit(byteRing_t *r, size_t length)
+{
+    r->tail += length;
+}
+
+// Copies bytes in, growing the buffer as needed. Returns 0 on success.
+int byteRingWrite(byteRing_t *r, const void *bytes, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BYTE_RING_H_ */
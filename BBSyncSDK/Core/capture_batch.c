@@ -0,0 +1,49 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "capture_batch.h"
+
+// Interrupt channel, data message type in the upper nibble of the header.
+#define INTERRUPT_CHANNEL   0x01
+#define DATA_MESSAGE_TYPE   0x0A
+
+int captureBatchAppendFrame(captureBatch_t *b, const uint8_t *frame, size_t length, uint64_t timestamp)
+{
+    const uint8_t *payload;
+    size_t i;
+
+    if (b->count >= CAPTURE_BATCH_CAPACITY || length < 3 + CAPTURE_REPORT_LENGTH)
+        return 0;
+    if (frame[0] != INTERRUPT_CHANNEL || (frame[1] >> 4) != DATA_MESSAGE_TYPE)
+        return 0;
+    if (frame[2] != CAPTURE_REPORT_ID_DATA_CAPTURE && frame[2] != CAPTURE_REPORT_ID_DIGITIZER)
+        return 0;
+
+    // Little endian x, y and pressure followed by the flags.
+    payload = frame + 3;
+    i = b->count++;
+    b->x[i] = (uint16_t)(payload[0] | (payload[1] << 8));
+    b->y[i] = (uint16_t)(payload[2] | (payload[3] << 8));
+    b->pressure[i] = (uint16_t)(payload[4] | (payload[5] << 8));
+    b->flags[i] = payload[6];
+    b->reportId[i] = frame[2];
+    b->timestamp[i] = timestamp;
+    return 1;
+}
@@ -0,0 +1,83 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _CAPTURE_BATCH_H_
+#define _CAPTURE_BATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Report ids carrying capture samples on the interrupt channel.
+#define CAPTURE_REPORT_ID_DIGITIZER     0x02
+#define CAPTURE_REPORT_ID_DATA_CAPTURE  0x03
+
+// Number of payload bytes in a capture report.
+#define CAPTURE_REPORT_LENGTH           7
+
+// Capture flags.
+#define CAPTURE_FLAG_TIP_SWITCH         (1 << 0)
+#define CAPTURE_FLAG_BARREL_SWITCH      (1 << 1)
+#define CAPTURE_FLAG_READY              (1 << 2)
+#define CAPTURE_FLAG_SAVE               (1 << 4)
+#define CAPTURE_FLAG_ERASE              (1 << 5)
+#define CAPTURE_FLAG_SAVE_SWITCH        (1 << 6)
+#define CAPTURE_FLAG_ERASE_SWITCH       (1 << 7)
+
+// Samples held by one batch.
+#define CAPTURE_BATCH_CAPACITY          64
+
+// Packed struct-of-arrays holding consecutive capture samples. Filled straight
+// from decoded frames without any heap allocation.
+typedef struct
+{
+    size_t   count;
+    uint16_t x[CAPTURE_BATCH_CAPACITY];
+    uint16_t y[CAPTURE_BATCH_CAPACITY];
+    uint16_t pressure[CAPTURE_BATCH_CAPACITY];
+    uint8_t  flags[CAPTURE_BATCH_CAPACITY];
+    uint8_t  reportId[CAPTURE_BATCH_CAPACITY];
+    uint64_t timestamp[CAPTURE_BATCH_CAPACITY];     // Monotonic arrival time in ns.
+    uint64_t decoded;                               // Monotonic time in ns the batch was decoded.
+} captureBatch_t;
+
+static inline void captureBatchClear(captureBatch_t *b)
+{
+    b->count = 0;
+}
+
+static inline int captureBatchIsFull(const captureBatch_t *b)
+{
+    return b->count >= CAPTURE_BATCH_CAPACITY;
+}
+
+// Appends the sample carried by an unescaped HID frame (CRC removed).
+// Returns 1 if the frame was a capture report and was appended, 0 if it was
+// some other message (or the batch is full) and was left for the caller.
+int captureBatchAppendFrame(captureBatch_t *b, const uint8_t *frame, size_t length, uint64_t timestamp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CAPTURE_BATCH_H_ */
@@ -0,0 +1,113 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "capture_channel.h"
+#include "capture_stats.h"
+#include "monotonic_time.h"
+
+// Pushes the pending batch. Returns 0 if the queue is full.
+static int pushPending(captureChannel_t *c)
+{
+#if CAPTURE_STATS_ENABLED
+    c->pending.decoded = monotonicTimeNanos();
+#endif
+    if (!spscQueuePush(&c->queue, &c->pending))
+    {
+        // Flag the stall, then look again in case the consumer drained in
+        // between and would otherwise never see the flag.
+        __atomic_store_n(&c->stalled, 1, __ATOMIC_SEQ_CST);
+        if (!spscQueuePush(&c->queue, &c->pending))
+            return 0;
+        __atomic_store_n(&c->stalled, 0, __ATOMIC_SEQ_CST);
+    }
+
+    captureBatchClear(&c->pending);
+    if (c->notify && !__atomic_exchange_n(&c->notified, 1, __ATOMIC_ACQ_REL))
+        c->notify(c->context);
+    return 1;
+}
+
+static int frameDecoded(void *context, const uint8_t *frame, size_t length)
+{
+    captureChannel_t *c = context;
+
+    if (!captureBatchAppendFrame(&c->pending, frame, length, c->timestamp))
+        return 0;
+
+    // Stop decoding if a full batch cannot be queued.
+    return captureBatchIsFull(&c->pending) && !pushPending(c);
+}
+
+int captureChannelInit(captureChannel_t *c, size_t capacity, captureChannelNotify_t notify, void *context)
+{
+    c->notify = notify;
+    c->context = context;
+    if (spscQueueInit(&c->queue, sizeof(captureBatch_t), capacity) != 0)
+        return -1;
+    captureChannelReset(c);
+    return 0;
+}
+
+void captureChannelFree(captureChannel_t *c)
+{
+    spscQueueFree(&c->queue);
+}
+
+void captureChannelReset(captureChannel_t *c)
+{
+    hidDecoderReset(&c->decoder);
+    captureBatchClear(&c->pending);
+    c->queue.head = c->queue.tail = 0;
+    c->notified = 0;
+    c->stalled = 0;
+}
+
+size_t captureChannelProduce(captureChannel_t *c, const uint8_t *bytes, size_t length, uint64_t timestamp)
+{
+    size_t consumed;
+
+    // A full batch left over from a stall goes first.
+    if (captureBatchIsFull(&c->pending) && !pushPending(c))
+        return 0;
+
+    c->timestamp = timestamp;
+    consumed = hidDecoderFeed(&c->decoder, bytes, length, frameDecoded, c);
+
+    // Hand over what was decoded now rather than waiting for a full batch.
+    // If the queue is full a partial batch just keeps filling.
+    if (c->pending.count > 0 && !captureBatchIsFull(&c->pending))
+        pushPending(c);
+    return consumed;
+}
+
+void captureChannelBeginDrain(captureChannel_t *c)
+{
+    __atomic_store_n(&c->notified, 0, __ATOMIC_SEQ_CST);
+}
+
+int captureChannelConsume(captureChannel_t *c, captureBatch_t *batch)
+{
+    return spscQueuePop(&c->queue, batch);
+}
+
+int captureChannelEndDrain(captureChannel_t *c)
+{
+    return __atomic_exchange_n(&c->stalled, 0, __ATOMIC_SEQ_CST);
+}
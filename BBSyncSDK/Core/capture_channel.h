@@ -0,0 +1,87 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _CAPTURE_CHANNEL_H_
+#define _CAPTURE_CHANNEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "capture_batch.h"
+#include "hid_decoder.h"
+#include "spsc_queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Called on the producer thread when batches become available and the
+// consumer has not been notified since it last drained the channel.
+typedef void (*captureChannelNotify_t)(void *context);
+
+// Hands decoded capture samples from the thread reading the accessory stream
+// to the thread consuming them. The producer decodes raw stream bytes into
+// batches and pushes them through a bounded lock-free queue; the consumer pops
+// whole batches. When the queue is full the producer stops consuming bytes and
+// marks the channel stalled instead of dropping samples.
+typedef struct
+{
+    hidDecoder_t           decoder;     // Producer only.
+    captureBatch_t         pending;     // Producer only, batch being filled.
+    uint64_t               timestamp;   // Producer only, arrival time of the bytes being decoded.
+    spscQueue_t            queue;       // captureBatch_t elements.
+    int                    notified;    // Consumer has a drain outstanding.
+    int                    stalled;     // Producer is waiting for the consumer to make room.
+    captureChannelNotify_t notify;
+    void                  *context;
+} captureChannel_t;
+
+// Allocates a queue of capacity batches. notify may be NULL if the consumer
+// drains on its own schedule. Returns 0 on success, -1 on allocation failure.
+int captureChannelInit(captureChannel_t *c, size_t capacity, captureChannelNotify_t notify, void *context);
+
+void captureChannelFree(captureChannel_t *c);
+
+// Discards queued batches and decoder state. Only call while neither side is
+// running.
+void captureChannelReset(captureChannel_t *c);
+
+// Producer: decodes stream bytes that arrived at timestamp. Returns the number
+// of bytes consumed, which is less than length only if the queue filled up; the
+// caller keeps the rest and retries once the consumer has drained the channel.
+size_t captureChannelProduce(captureChannel_t *c, const uint8_t *bytes, size_t length, uint64_t timestamp);
+
+// Consumer: call before draining. Re-arms the notification so batches pushed
+// after this point notify again.
+void captureChannelBeginDrain(captureChannel_t *c);
+
+// Consumer: pops the oldest batch. Returns 0 if the channel is empty.
+int captureChannelConsume(captureChannel_t *c, captureBatch_t *batch);
+
+// Consumer: call after draining. Returns 1 if the producer had stalled and
+// must be woken up to call captureChannelProduce again, with its remaining
+// bytes or with none to flush samples it is still holding.
+int captureChannelEndDrain(captureChannel_t *c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CAPTURE_CHANNEL_H_ */
@@ -0,0 +1,153 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "capture_recording.h"
+#include "varint.h"
+
+int captureRecorderOpen(captureRecorder_t *r, const char *path)
+{
+    uint8_t header[CAPTURE_RECORDING_HEADER_LENGTH];
+
+    memcpy(header, CAPTURE_RECORDING_MAGIC, 4);
+    header[4] = CAPTURE_RECORDING_VERSION;
+
+    r->lastTimestamp = 0;
+    r->chunks = 0;
+    r->bytes = 0;
+    r->file = fopen(path, "wb");
+    if (r->file == NULL)
+        return -1;
+    if (fwrite(header, 1, sizeof(header), r->file) != sizeof(header))
+    {
+        fclose(r->file);
+        r->file = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+int captureRecorderWrite(captureRecorder_t *r, const uint8_t *bytes, size_t length, uint64_t timestamp)
+{
+    uint8_t prefix[2*VARINT_MAX_LENGTH];
+    uint64_t delta;
+    size_t n;
+
+    if (r->file == NULL)
+        return -1;
+
+    // The first chunk starts the clock. Advancing by what was written keeps
+    // the rounding to microseconds from accumulating.
+    if (r->chunks == 0)
+        r->lastTimestamp = timestamp;
+    delta = timestamp > r->lastTimestamp ? (timestamp - r->lastTimestamp)/1000 : 0;
+    r->lastTimestamp += delta*1000;
+
+    n = varintEncode(delta, prefix);
+    n += varintEncode(length, prefix + n);
+    if (fwrite(prefix, 1, n, r->file) != n || fwrite(bytes, 1, length, r->file) != length)
+        return -1;
+
+    r->chunks++;
+    r->bytes += length;
+    return 0;
+}
+
+void captureRecorderClose(captureRecorder_t *r)
+{
+    if (r->file)
+        fclose(r->file);
+    r->file = NULL;
+}
+
+int captureRecordingOpen(captureRecording_t *rec, const char *path)
+{
+    struct stat st;
+    void *map;
+    int fd;
+
+    rec->data = NULL;
+    rec->length = 0;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    if (fstat(fd, &st) != 0 || st.st_size < CAPTURE_RECORDING_HEADER_LENGTH)
+    {
+        close(fd);
+        return -1;
+    }
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return -1;
+
+    rec->data = map;
+    rec->length = (size_t)st.st_size;
+    if (memcmp(rec->data, CAPTURE_RECORDING_MAGIC, 4) != 0 || rec->data[4] != CAPTURE_RECORDING_VERSION)
+    {
+        captureRecordingClose(rec);
+        return -1;
+    }
+
+    captureRecordingRewind(rec);
+    return 0;
+}
+
+void captureRecordingClose(captureRecording_t *rec)
+{
+    if (rec->data)
+        munmap((void *)rec->data, rec->length);
+    rec->data = NULL;
+    rec->length = 0;
+}
+
+void captureRecordingRewind(captureRecording_t *rec)
+{
+    rec->offset = CAPTURE_RECORDING_HEADER_LENGTH;
+    rec->timestamp = 0;
+}
+
+int captureRecordingNext(captureRecording_t *rec, const uint8_t **bytes, size_t *length, uint64_t *micros)
+{
+    uint64_t delta, chunkLength;
+    size_t n, m;
+
+    n = varintDecode(rec->data + rec->offset, rec->length - rec->offset, &delta);
+    if (n == 0)
+        return 0;
+    m = varintDecode(rec->data + rec->offset + n, rec->length - rec->offset - n, &chunkLength);
+    if (m == 0 || chunkLength > rec->length - rec->offset - n - m)
+        return 0;
+
+    rec->offset += n + m;
+    rec->timestamp += delta;
+    *bytes = rec->data + rec->offset;
+    *length = (size_t)chunkLength;
+    *micros = rec->timestamp;
+    rec->offset += (size_t)chunkLength;
+    return 1;
+}
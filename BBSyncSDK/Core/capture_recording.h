@@ -0,0 +1,87 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _CAPTURE_RECORDING_H_
+#define _CAPTURE_RECORDING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A recording is the raw byte stream read from the HID session, chunked the
+// way the stream reads returned it:
+//
+//   header: "BBHR" version(1)
+//   chunk:  varint(microseconds since previous chunk) varint(length) bytes
+//
+// Chunks are appended as they arrive, so a recording cut short by a crash is
+// still readable up to its last complete chunk.
+#define CAPTURE_RECORDING_MAGIC         "BBHR"
+#define CAPTURE_RECORDING_VERSION       1
+#define CAPTURE_RECORDING_HEADER_LENGTH 5
+
+typedef struct
+{
+    FILE    *file;
+    uint64_t lastTimestamp;     // Monotonic ns of the previous chunk.
+    uint64_t chunks;
+    uint64_t bytes;
+} captureRecorder_t;
+
+// Creates the file and writes the header. Returns 0 on success, -1 on failure.
+int captureRecorderOpen(captureRecorder_t *r, const char *path);
+
+// Appends bytes read at the monotonic timestamp. Returns 0 on success.
+int captureRecorderWrite(captureRecorder_t *r, const uint8_t *bytes, size_t length, uint64_t timestamp);
+
+void captureRecorderClose(captureRecorder_t *r);
+
+// Read-only view of a recording mapped into memory.
+typedef struct
+{
+    const uint8_t *data;
+    size_t         length;
+    size_t         offset;      // Next chunk.
+    uint64_t       timestamp;   // Microseconds from the first chunk to the last one read.
+} captureRecording_t;
+
+// Maps the file. Returns 0 on success, -1 if it cannot be read or is not a
+// recording.
+int captureRecordingOpen(captureRecording_t *rec, const char *path);
+
+void captureRecordingClose(captureRecording_t *rec);
+
+// Starts over at the first chunk.
+void captureRecordingRewind(captureRecording_t *rec);
+
+// Points bytes at the next chunk inside the mapping and sets its length and
+// offset in microseconds from the first chunk. Returns 0 at the end of the
+// recording or at a truncated chunk.
+int captureRecordingNext(captureRecording_t *rec, const uint8_t **bytes, size_t *length, uint64_t *micros);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CAPTURE_RECORDING_H_ */
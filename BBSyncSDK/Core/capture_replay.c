@@ -0,0 +1,89 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <time.h>
+
+#include "capture_channel.h"
+#include "capture_replay.h"
+#include "monotonic_time.h"
+
+#define REPLAY_QUEUE_CAPACITY   4
+
+static void sleepUntil(uint64_t deadline)
+{
+    struct timespec ts;
+    uint64_t now = monotonicTimeNanos();
+
+    if (deadline <= now)
+        return;
+    ts.tv_sec = (time_t)((deadline - now)/1000000000ull);
+    ts.tv_nsec = (long)((deadline - now)%1000000000ull);
+    nanosleep(&ts, NULL);
+}
+
+int captureReplayRun(captureRecording_t *rec, double speed, captureReplaySink_t sink, void *context,
+                     captureReplayResult_t *result)
+{
+    captureChannel_t channel;
+    captureBatch_t batch;
+    const uint8_t *bytes;
+    size_t length, consumed;
+    uint64_t micros, start, now;
+
+    if (captureChannelInit(&channel, REPLAY_QUEUE_CAPACITY, NULL, NULL) != 0)
+        return -1;
+
+    result->chunks = 0;
+    result->bytes = 0;
+    result->samples = 0;
+    captureRecordingRewind(rec);
+    start = monotonicTimeNanos();
+
+    while (captureRecordingNext(rec, &bytes, &length, &micros))
+    {
+        if (speed > 0)
+            sleepUntil(start + (uint64_t)((double)micros*1000.0/speed));
+        now = monotonicTimeNanos();
+
+        result->chunks++;
+        result->bytes += length;
+
+        // Drain after every pass; a full queue only pauses decoding.
+        do
+        {
+            consumed = captureChannelProduce(&channel, bytes, length, now);
+            bytes += consumed;
+            length -= consumed;
+
+            captureChannelBeginDrain(&channel);
+            while (captureChannelConsume(&channel, &batch))
+            {
+                result->samples += batch.count;
+                if (sink)
+                    sink(context, &batch);
+            }
+        } while (captureChannelEndDrain(&channel) || length > 0);
+    }
+
+    result->elapsedNanos = monotonicTimeNanos() - start;
+    result->crcErrors = channel.decoder.crcErrors;
+    captureChannelFree(&channel);
+    return 0;
+}
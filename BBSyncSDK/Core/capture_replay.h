@@ -0,0 +1,60 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _CAPTURE_REPLAY_H_
+#define _CAPTURE_REPLAY_H_
+
+#include <stdint.h>
+
+#include "capture_batch.h"
+#include "capture_recording.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Pass as the speed to replay as fast as the pipeline can go.
+#define CAPTURE_REPLAY_FLAT_OUT 0.0
+
+// Receives every decoded batch, on the thread running the replay.
+typedef void (*captureReplaySink_t)(void *context, const captureBatch_t *batch);
+
+typedef struct
+{
+    uint64_t chunks;
+    uint64_t bytes;
+    uint64_t samples;
+    uint64_t crcErrors;
+    uint64_t elapsedNanos;
+} captureReplayResult_t;
+
+// Feeds the recording through the same decoder and batching as a live
+// session. Samples are stamped with the time they are replayed at. A speed of
+// 1 keeps the recorded pace, 4 plays four times faster and
+// CAPTURE_REPLAY_FLAT_OUT never waits. Returns 0 on success, -1 if the decoder
+// could not be allocated.
+int captureReplayRun(captureRecording_t *rec, double speed, captureReplaySink_t sink, void *context,
+                     captureReplayResult_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CAPTURE_REPLAY_H_ */
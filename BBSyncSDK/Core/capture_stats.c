@@ -0,0 +1,76 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <string.h>
+
+#include "capture_stats.h"
+
+// Highest value that falls in the bucket.
+static uint64_t bucketHighestValue(size_t bucket)
+{
+    size_t exponent;
+
+    if (bucket < LATENCY_SUB_BUCKET_COUNT)
+        return bucket;
+
+    exponent = (bucket >> LATENCY_SUB_BUCKET_BITS) + LATENCY_SUB_BUCKET_BITS - 1;
+    return ((uint64_t)((bucket & (LATENCY_SUB_BUCKET_COUNT - 1)) + LATENCY_SUB_BUCKET_COUNT + 1) << (exponent - LATENCY_SUB_BUCKET_BITS)) - 1;
+}
+
+void latencyHistogramReset(latencyHistogram_t *h)
+{
+    memset(h, 0, sizeof(*h));
+    h->min = UINT64_MAX;
+}
+
+uint64_t latencyHistogramValueAtPercentile(const latencyHistogram_t *h, double percentile)
+{
+    uint64_t target, seen = 0;
+    size_t i;
+
+    if (h->total == 0)
+        return 0;
+    if (percentile >= 100.0)
+        return h->max;
+
+    target = (uint64_t)(percentile/100.0*(double)h->total + 0.5);
+    if (target == 0)
+        target = 1;
+
+    for (i = 0; i < LATENCY_BUCKET_COUNT; i++)
+    {
+        seen += h->counts[i];
+        if (seen >= target)
+        {
+            uint64_t value = bucketHighestValue(i);
+            return value < h->max ? value : h->max;
+        }
+    }
+    return h->max;
+}
+
+void captureStatsReset(captureStats_t *s)
+{
+    int i;
+
+    memset(s->rate, 0, sizeof(s->rate));
+    for (i = 0; i < CAPTURE_STAGE_COUNT; i++)
+        latencyHistogramReset(&s->latency[i]);
+}
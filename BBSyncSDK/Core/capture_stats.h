@@ -0,0 +1,151 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _CAPTURE_STATS_H_
+#define _CAPTURE_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Define as 0 to compile out all capture pipeline instrumentation.
+#ifndef CAPTURE_STATS_ENABLED
+#define CAPTURE_STATS_ENABLED 1
+#endif
+
+// Log-linear latency histogram in the style of HdrHistogram: every power of
+// two is split into 2^LATENCY_SUB_BUCKET_BITS linear buckets, so recorded
+// values keep about 6% precision from nanoseconds up to LATENCY_MAX_EXPONENT.
+// Recording is a couple of instructions and never allocates.
+#define LATENCY_SUB_BUCKET_BITS     4
+#define LATENCY_SUB_BUCKET_COUNT    (1 << LATENCY_SUB_BUCKET_BITS)
+#define LATENCY_MAX_EXPONENT        40      // 2^40 ns, about 18 minutes.
+#define LATENCY_BUCKET_COUNT        ((LATENCY_MAX_EXPONENT - LATENCY_SUB_BUCKET_BITS + 1)*LATENCY_SUB_BUCKET_COUNT)
+
+typedef struct
+{
+    uint64_t counts[LATENCY_BUCKET_COUNT];
+    uint64_t total;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+} latencyHistogram_t;
+
+void latencyHistogramReset(latencyHistogram_t *h);
+
+static inline size_t latencyHistogramBucket(uint64_t value)
+{
+    unsigned exponent;
+
+    if (value < LATENCY_SUB_BUCKET_COUNT)
+        return (size_t)value;
+    if (value >= (1ull << LATENCY_MAX_EXPONENT))
+        return LATENCY_BUCKET_COUNT - 1;
+
+    exponent = 63 - __builtin_clzll(value);
+    return (size_t)((exponent - LATENCY_SUB_BUCKET_BITS + 1) << LATENCY_SUB_BUCKET_BITS)
+         + (size_t)((value >> (exponent - LATENCY_SUB_BUCKET_BITS)) & (LATENCY_SUB_BUCKET_COUNT - 1));
+}
+
+static inline void latencyHistogramRecord(latencyHistogram_t *h, uint64_t value)
+{
+    h->counts[latencyHistogramBucket(value)]++;
+    h->total++;
+    h->sum += value;
+    if (value < h->min)
+        h->min = value;
+    if (value > h->max)
+        h->max = value;
+}
+
+// Returns the highest value equivalent to the bucket the given percentile
+// (0 to 100) falls in, or 0 if nothing was recorded.
+uint64_t latencyHistogramValueAtPercentile(const latencyHistogram_t *h, double percentile);
+
+// Counts samples through a stage and the rate over the last full window.
+#define RATE_WINDOW_NANOS   1000000000ull
+
+typedef struct
+{
+    uint64_t total;
+    uint64_t windowStart;
+    uint64_t windowCount;
+    double   perSecond;     // Rate over the last completed window.
+} rateCounter_t;
+
+static inline void rateCounterAdd(rateCounter_t *r, uint64_t now, uint64_t count)
+{
+    if (r->windowStart == 0)
+    {
+        r->windowStart = now;
+    }
+    else if (now - r->windowStart >= RATE_WINDOW_NANOS)
+    {
+        r->perSecond = (double)r->windowCount*1e9/(double)(now - r->windowStart);
+        r->windowStart = now;
+        r->windowCount = 0;
+    }
+    r->windowCount += count;
+    r->total += count;
+}
+
+// Stages of the capture pipeline. Each stage's latency is measured from the
+// previous stage's timestamp; CAPTURE_STAGE_TOTAL spans from the stream read
+// to the delegate returning.
+typedef enum
+{
+    CAPTURE_STAGE_DECODE = 0,   // Stream read to frame decoded and queued.
+    CAPTURE_STAGE_FILTER,       // Decoded to filter emitted its paths.
+    CAPTURE_STAGE_DISPATCH,     // Filter emitted to delegate callbacks returned.
+    CAPTURE_STAGE_TOTAL,
+    CAPTURE_STAGE_COUNT
+} captureStage_t;
+
+typedef struct
+{
+    latencyHistogram_t latency[CAPTURE_STAGE_COUNT];
+    rateCounter_t      rate[CAPTURE_STAGE_COUNT];
+} captureStats_t;
+
+void captureStatsReset(captureStats_t *s);
+
+// Records one sample that arrived at read, was decoded at decoded, filtered at
+// filtered and dispatched at dispatched.
+static inline void captureStatsRecord(captureStats_t *s, uint64_t read, uint64_t decoded,
+                                      uint64_t filtered, uint64_t dispatched)
+{
+    latencyHistogramRecord(&s->latency[CAPTURE_STAGE_DECODE], decoded - read);
+    latencyHistogramRecord(&s->latency[CAPTURE_STAGE_FILTER], filtered - decoded);
+    latencyHistogramRecord(&s->latency[CAPTURE_STAGE_DISPATCH], dispatched - filtered);
+    latencyHistogramRecord(&s->latency[CAPTURE_STAGE_TOTAL], dispatched - read);
+    rateCounterAdd(&s->rate[CAPTURE_STAGE_DECODE], decoded, 1);
+    rateCounterAdd(&s->rate[CAPTURE_STAGE_FILTER], filtered, 1);
+    rateCounterAdd(&s->rate[CAPTURE_STAGE_DISPATCH], dispatched, 1);
+    rateCounterAdd(&s->rate[CAPTURE_STAGE_TOTAL], dispatched, 1);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CAPTURE_STATS_H_ */
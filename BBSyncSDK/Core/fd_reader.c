@@ -0,0 +1,147 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "fd_reader.h"
+#include "monotonic_time.h"
+
+#define READ_BUFFER_SIZE    4096
+#define READ_SIZE           1024
+
+// Decodes buffered bytes until the ring is empty or the channel stalls.
+static void produce(fdReader_t *r, uint64_t timestamp)
+{
+    const uint8_t *bytes;
+    size_t length, consumed;
+
+    do
+    {
+        bytes = byteRingReadPointer(&r->ring, &length);
+        consumed = captureChannelProduce(r->channel, bytes, length, timestamp);
+        byteRingConsume(&r->ring, consumed);
+    } while (consumed > 0 && consumed == length && byteRingReadable(&r->ring) > 0);
+}
+
+static void *readerMain(void *context)
+{
+    fdReader_t *r = context;
+    struct pollfd fds[2];
+    uint8_t *space;
+    size_t length;
+    ssize_t n;
+    char wake;
+    int eof = 0;
+
+    fds[0].fd = r->wakeFds[0];
+    fds[0].events = POLLIN;
+
+    for (;;)
+    {
+        // After end of file stay around until the consumer has taken
+        // everything that was read.
+        if (eof && byteRingReadable(&r->ring) == 0 && r->channel->pending.count == 0)
+            break;
+
+        // While stalled leave the descriptor alone so the writer feels the
+        // back pressure instead of the ring growing without bound.
+        fds[1].fd = eof ? -1 : r->fd;
+        fds[1].events = byteRingReadable(&r->ring) > 0 ? 0 : POLLIN;
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        if (fds[0].revents & POLLIN)
+        {
+            while (read(r->wakeFds[0], &wake, 1) == 1)
+                ;
+            if (__atomic_load_n(&r->stopping, __ATOMIC_ACQUIRE))
+                break;
+            produce(r, monotonicTimeNanos());
+        }
+
+        if (fds[1].revents & (POLLIN | POLLHUP | POLLERR))
+        {
+            space = byteRingWritePointer(&r->ring, READ_SIZE, &length);
+            if (space == NULL)
+                break;
+            n = read(r->fd, space, length < READ_SIZE ? length : READ_SIZE);
+            if (n < 0 && (errno == EINTR || errno == EAGAIN))
+                continue;
+            if (n <= 0)
+            {
+                eof = 1;
+                continue;
+            }
+            byteRingCommit(&r->ring, (size_t)n);
+            produce(r, monotonicTimeNanos());
+        }
+    }
+    return NULL;
+}
+
+int fdReaderStart(fdReader_t *r, int fd, captureChannel_t *channel)
+{
+    r->fd = fd;
+    r->channel = channel;
+    r->stopping = 0;
+
+    if (byteRingInit(&r->ring, READ_BUFFER_SIZE) != 0)
+        return -1;
+    if (pipe(r->wakeFds) != 0)
+    {
+        byteRingFree(&r->ring);
+        return -1;
+    }
+    fcntl(r->wakeFds[0], F_SETFL, O_NONBLOCK);
+    if (pthread_create(&r->thread, NULL, readerMain, r) != 0)
+    {
+        close(r->wakeFds[0]);
+        close(r->wakeFds[1]);
+        byteRingFree(&r->ring);
+        return -1;
+    }
+    return 0;
+}
+
+void fdReaderWake(fdReader_t *r)
+{
+    char wake = 'w';
+    (void)write(r->wakeFds[1], &wake, 1);
+}
+
+void fdReaderStop(fdReader_t *r)
+{
+    char stop = 's';
+
+    __atomic_store_n(&r->stopping, 1, __ATOMIC_RELEASE);
+    (void)write(r->wakeFds[1], &stop, 1);
+    pthread_join(r->thread, NULL);
+
+    close(r->wakeFds[0]);
+    close(r->wakeFds[1]);
+    byteRingFree(&r->ring);
+}
@@ -0,0 +1,62 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _FD_READER_H_
+#define _FD_READER_H_
+
+#include <pthread.h>
+
+#include "byte_ring.h"
+#include "capture_channel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Dedicated I/O thread reading a HID byte stream from a file descriptor (a
+// socket, pipe or pty) into a capture channel. This is the portable
+// counterpart of the accessory stream thread, used wherever there is no
+// EASession.
+typedef struct
+{
+    int               fd;
+    int               wakeFds[2];
+    int               stopping;
+    pthread_t         thread;
+    byteRing_t        ring;
+    captureChannel_t *channel;
+} fdReader_t;
+
+// Starts the thread. The reader does not own fd or channel. Returns 0 on
+// success, -1 on failure.
+int fdReaderStart(fdReader_t *r, int fd, captureChannel_t *channel);
+
+// Wakes the thread after captureChannelEndDrain reported a stall.
+void fdReaderWake(fdReader_t *r);
+
+// Returns once the thread has exited, either because of this call or because
+// the descriptor reached end of file and everything read was consumed.
+void fdReaderStop(fdReader_t *r);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FD_READER_H_ */
@@ -0,0 +1,50 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _HID_CRC_H_
+#define _HID_CRC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Initial value of the CRC-16/X.25 used to protect HID frames. Running the CRC
+// over a frame followed by its little endian CRC leaves zero.
+#define HID_CRC_INIT    0xffff
+
+extern const uint16_t hidCRCTable[8][256];
+
+// Updates the CRC with a single byte, for use while unescaping.
+static inline uint16_t hidCRCUpdateByte(uint16_t crc, uint8_t b)
+{
+    return (crc >> 8) ^ hidCRCTable[0][(crc ^ b) & 0xff];
+}
+
+// Updates the CRC with a run of bytes, eight at a time.
+uint16_t hidCRCUpdate(uint16_t crc, const uint8_t *bytes, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HID_CRC_H_ */
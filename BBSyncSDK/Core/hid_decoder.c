@@ -0,0 +1,133 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <string.h>
+
+#include "hid_decoder.h"
+#include "hid_crc.h"
+#include "hid_slip.h"
+
+void hidDecoderReset(hidDecoder_t *d)
+{
+    d->length = 0;
+    d->crc = HID_CRC_INIT;
+    d->escaped = 0;
+    d->overflow = 0;
+    d->framesDecoded = 0;
+    d->crcErrors = 0;
+    d->overflows = 0;
+}
+
+// Handles a FEND, returns non-zero if the callback asked to stop.
+static int endFrame(hidDecoder_t *d, hidDecoderFrameCallback_t callback, void *context)
+{
+    int stop = 0;
+
+    if (d->overflow)
+    {
+        d->overflows++;
+    }
+    else if (d->length >= HID_FRAME_MIN_LENGTH)
+    {
+        // The CRC was updated while unescaping, running it over the data and
+        // its CRC leaves zero for a good frame.
+        if (d->crc == 0)
+        {
+            d->framesDecoded++;
+            stop = callback(context, d->frame, d->length - HID_CRC_LENGTH);
+        }
+        else
+        {
+            d->crcErrors++;
+        }
+    }
+
+    // Empty or runt frames between delimiters are simply dropped.
+    d->length = 0;
+    d->crc = HID_CRC_INIT;
+    d->escaped = 0;
+    d->overflow = 0;
+    return stop;
+}
+
+size_t hidDecoderFeed(hidDecoder_t *d, const uint8_t *bytes, size_t length,
+                      hidDecoderFrameCallback_t callback, void *context)
+{
+    size_t i = 0;
+
+    while (i < length)
+    {
+        uint8_t b;
+
+        // Copy the clean run up to the next FEND/FESC in one go.
+        if (!d->escaped)
+        {
+            size_t run = hidSlipFindSpecial(bytes + i, length - i);
+            if (run)
+            {
+                size_t space = HID_FRAME_MAX_LENGTH - d->length;
+                size_t copy = run < space ? run : space;
+                memcpy(d->frame + d->length, bytes + i, copy);
+                d->crc = hidCRCUpdate(d->crc, bytes + i, copy);
+                d->length += copy;
+                if (copy < run)
+                    d->overflow = 1;
+                i += run;
+                if (i == length)
+                    break;
+            }
+        }
+
+        b = bytes[i++];
+
+        if (b == HID_FEND)
+        {
+            if (endFrame(d, callback, context))
+                return i;
+            continue;
+        }
+
+        if (d->escaped)
+        {
+            d->escaped = 0;
+            if (b == HID_TFEND)
+                b = HID_FEND;
+            else if (b == HID_TFESC)
+                b = HID_FESC;
+        }
+        else if (b == HID_FESC)
+        {
+            d->escaped = 1;
+            continue;
+        }
+
+        if (d->length < HID_FRAME_MAX_LENGTH)
+        {
+            d->frame[d->length++] = b;
+            d->crc = hidCRCUpdateByte(d->crc, b);
+        }
+        else
+        {
+            d->overflow = 1;
+        }
+    }
+
+    return length;
+}
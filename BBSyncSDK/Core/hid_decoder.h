@@ -0,0 +1,64 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _HID_DECODER_H_
+#define _HID_DECODER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hid_protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Called for every complete frame that passed the CRC check. The frame is
+// unescaped and has the CRC removed; the memory is only valid for the duration
+// of the call. Return 0 to keep decoding, non-zero to stop after this frame.
+typedef int (*hidDecoderFrameCallback_t)(void *context, const uint8_t *frame, size_t length);
+
+// State of a streaming frame decoder. Partial frames are kept between calls so
+// a frame split across several stream reads is still decoded.
+typedef struct
+{
+    uint8_t  frame[HID_FRAME_MAX_LENGTH];
+    size_t   length;                // Unescaped bytes held for the current frame.
+    uint16_t crc;                   // CRC of the unescaped bytes so far.
+    uint8_t  escaped;               // Previous byte was FESC.
+    uint8_t  overflow;              // Current frame exceeded the buffer, drop until next FEND.
+    uint32_t framesDecoded;
+    uint32_t crcErrors;
+    uint32_t overflows;
+} hidDecoder_t;
+
+// Initializes (or resets) a decoder, discarding any partial frame.
+void hidDecoderReset(hidDecoder_t *d);
+
+// Decodes the bytes in a single pass. Returns the number of bytes consumed,
+// which is less than length only if the callback asked to stop.
+size_t hidDecoderFeed(hidDecoder_t *d, const uint8_t *bytes, size_t length,
+                      hidDecoderFrameCallback_t callback, void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HID_DECODER_H_ */
@@ -0,0 +1,40 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _HID_PROTOCOL_H_
+#define _HID_PROTOCOL_H_
+
+// SLIP style framing bytes used on the Sync's HID session.
+#define HID_FEND                0xC0    // Frame end.
+#define HID_FESC                0xDB    // Frame escape.
+#define HID_TFEND               0xDC    // Transposed frame end.
+#define HID_TFESC               0xDD    // Transposed frame escape.
+
+// Size of the CRC appended to the end of every frame.
+#define HID_CRC_LENGTH          2
+
+// Smallest frame that can be valid (channel, header and the CRC).
+#define HID_FRAME_MIN_LENGTH    4
+
+// Largest unescaped frame (including the CRC) the decoder will hold. Capture
+// reports are 12 bytes, get report responses are well below this limit.
+#define HID_FRAME_MAX_LENGTH    256
+
+#endif /* _HID_PROTOCOL_H_ */
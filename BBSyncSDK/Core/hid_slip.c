@@ -0,0 +1,158 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <string.h>
+
+#include "hid_slip.h"
+#include "hid_crc.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#define ONES    0x0101010101010101ull
+#define HIGHS   0x8080808080808080ull
+
+// Non-zero if any byte of the word is zero (exact, no false positives).
+static inline uint64_t hasZeroByte(uint64_t w)
+{
+    return ~(((w & ~HIGHS) + ~HIGHS) | w | ~HIGHS);
+}
+
+static inline size_t findSpecialScalar(const uint8_t *bytes, size_t i, size_t length)
+{
+    while (i < length && bytes[i] != HID_FEND && bytes[i] != HID_FESC)
+        i++;
+    return i;
+}
+
+size_t hidSlipFindSpecial(const uint8_t *bytes, size_t length)
+{
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i fend = _mm_set1_epi8((char)HID_FEND);
+    const __m128i fesc = _mm_set1_epi8((char)HID_FESC);
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(bytes + i));
+        int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, fend), _mm_cmpeq_epi8(v, fesc)));
+        if (mask)
+            return i + __builtin_ctz((unsigned)mask);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16_t fend = vdupq_n_u8(HID_FEND);
+    const uint8x16_t fesc = vdupq_n_u8(HID_FESC);
+    for (; i + 16 <= length; i += 16)
+    {
+        uint8x16_t v = vld1q_u8(bytes + i);
+        if (vmaxvq_u8(vorrq_u8(vceqq_u8(v, fend), vceqq_u8(v, fesc))))
+            return findSpecialScalar(bytes, i, i + 16);
+    }
+#endif
+
+    for (; i + 8 <= length; i += 8)
+    {
+        uint64_t w;
+        memcpy(&w, bytes + i, sizeof(w));
+        if (hasZeroByte(w ^ (HID_FEND*ONES)) | hasZeroByte(w ^ (HID_FESC*ONES)))
+            return findSpecialScalar(bytes, i, i + 8);
+    }
+
+    return findSpecialScalar(bytes, i, length);
+}
+
+size_t hidSlipEscape(const uint8_t *src, size_t length, uint8_t *dst)
+{
+    uint8_t *out = dst;
+
+    while (length)
+    {
+        // Copy the clean run in one go, then escape the special byte ending it.
+        size_t run = hidSlipFindSpecial(src, length);
+        memcpy(out, src, run);
+        out += run;
+        src += run;
+        length -= run;
+
+        if (length)
+        {
+            *out++ = HID_FESC;
+            *out++ = (*src == HID_FEND) ? HID_TFEND : HID_TFESC;
+            src++;
+            length--;
+        }
+    }
+
+    return out - dst;
+}
+
+size_t hidSlipUnescape(const uint8_t *src, size_t length, uint8_t *dst)
+{
+    uint8_t *out = dst;
+
+    while (length)
+    {
+        size_t run = hidSlipFindSpecial(src, length);
+        memmove(out, src, run);
+        out += run;
+        src += run;
+        length -= run;
+
+        if (length == 0)
+            break;
+
+        if (*src == HID_FESC && length > 1)
+        {
+            uint8_t b = src[1];
+            if (b == HID_TFEND)
+                b = HID_FEND;
+            else if (b == HID_TFESC)
+                b = HID_FESC;
+            *out++ = b;
+            src += 2;
+            length -= 2;
+        }
+        else
+        {
+            // Delimiter, or a dangling escape at the very end.
+            src++;
+            length--;
+        }
+    }
+
+    return out - dst;
+}
+
+size_t hidSlipEncodeFrame(const uint8_t *data, size_t length, uint8_t *dst)
+{
+    uint16_t crc = hidCRCUpdate(HID_CRC_INIT, data, length);
+    uint8_t crcBytes[HID_CRC_LENGTH] = {(uint8_t)(crc & 0xff), (uint8_t)(crc >> 8)};
+    uint8_t *out = dst;
+
+    *out++ = HID_FEND;
+    out += hidSlipEscape(data, length, out);
+    out += hidSlipEscape(crcBytes, HID_CRC_LENGTH, out);
+    *out++ = HID_FEND;
+
+    return out - dst;
+}
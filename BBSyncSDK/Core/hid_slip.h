@@ -0,0 +1,59 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _HID_SLIP_H_
+#define _HID_SLIP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hid_protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Worst case size of escaped data, every byte may need escaping.
+#define HID_SLIP_ESCAPED_MAX(length)    (2*(length))
+
+// Worst case size of a framed packet: both FENDs plus the escaped data and CRC.
+#define HID_SLIP_FRAME_MAX(length)      (HID_SLIP_ESCAPED_MAX((length) + HID_CRC_LENGTH) + 2)
+
+// Returns the index of the first FEND or FESC, or length if there is none.
+// Clean runs are scanned 16 (SSE2/NEON) or 8 (word) bytes at a time.
+size_t hidSlipFindSpecial(const uint8_t *bytes, size_t length);
+
+// Escapes FEND and FESC into dst, which must hold HID_SLIP_ESCAPED_MAX(length)
+// bytes. Returns the number of bytes written.
+size_t hidSlipEscape(const uint8_t *src, size_t length, uint8_t *dst);
+
+// Removes escape sequences and FEND delimiters into dst, which must hold
+// length bytes (dst may equal src). Returns the number of bytes written.
+size_t hidSlipUnescape(const uint8_t *src, size_t length, uint8_t *dst);
+
+// Frames data as FEND, escaped data, escaped little endian CRC, FEND into dst,
+// which must hold HID_SLIP_FRAME_MAX(length) bytes. Returns the frame length.
+size_t hidSlipEncodeFrame(const uint8_t *data, size_t length, uint8_t *dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HID_SLIP_H_ */
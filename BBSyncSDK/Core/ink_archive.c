@@ -0,0 +1,689 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ink_archive.h"
+#include "varint.h"
+
+#define INDEX_INITIAL_CAPACITY  16
+#define DECODE_POINTS           64
+
+// Longest encodings of a sample, the fields of a chunk and a stroke header.
+#define SAMPLE_MAX_LENGTH       (VARINT_MAX_LENGTH + 3*3 + 2)
+#define FIELDS_MAX_LENGTH       (5*VARINT_MAX_LENGTH)
+#define STROKE_MAX_HEADER       (6*VARINT_MAX_LENGTH)
+
+static inline int intersects(const inkRect_t *a, const inkRect_t *b)
+{
+    return a->minX <= b->maxX && b->minX <= a->maxX && a->minY <= b->maxY && b->minY <= a->maxY;
+}
+
+static inline void addBounds(inkRect_t *r, const inkRect_t *b)
+{
+    if (b->minX < r->minX)
+        r->minX = b->minX;
+    if (b->minY < r->minY)
+        r->minY = b->minY;
+    if (b->maxX > r->maxX)
+        r->maxX = b->maxX;
+    if (b->maxY > r->maxY)
+        r->maxY = b->maxY;
+}
+
+static inline size_t encodeSigned(int64_t value, uint8_t *dst)
+{
+    return varintEncode(zigzagEncode(value), dst);
+}
+
+static void resetBuffer(inkArchiveBuffer_t *b)
+{
+    b->length = 0;
+    b->items = 0;
+    b->micros = 0;
+    b->bounds.minX = b->bounds.minY = UINT16_MAX;
+    b->bounds.maxX = b->bounds.maxY = 0;
+    b->x = b->y = b->pressure = 0;
+    b->flags = b->reportId = 0;
+}
+
+static int reserveBuffer(inkArchiveBuffer_t *b, size_t extra)
+{
+    uint8_t *bytes;
+    size_t capacity;
+
+    if (b->length + extra <= b->capacity)
+        return 0;
+    capacity = b->capacity ? b->capacity : INK_ARCHIVE_CHUNK_LENGTH;
+    while (capacity < b->length + extra)
+        capacity *= 2;
+    bytes = realloc(b->bytes, capacity);
+    if (bytes == NULL)
+        return -1;
+    b->bytes = bytes;
+    b->capacity = capacity;
+    return 0;
+}
+
+// The fields of a chunk, which its header and its index entry share.
+static size_t encodeFields(const inkArchiveChunk_t *chunk, uint8_t *dst)
+{
+    size_t n = varintEncode(chunk->items, dst);
+
+    if (chunk->kind == INK_ARCHIVE_SAMPLES)
+    {
+        n += varintEncode(chunk->micros, dst + n);
+    }
+    else if (chunk->kind == INK_ARCHIVE_STROKES)
+    {
+        n += varintEncode(chunk->bounds.minX, dst + n);
+        n += varintEncode(chunk->bounds.minY, dst + n);
+        n += varintEncode(chunk->bounds.maxX - chunk->bounds.minX, dst + n);
+        n += varintEncode(chunk->bounds.maxY - chunk->bounds.minY, dst + n);
+    }
+    return n;
+}
+
+static int writeBytes(inkArchiveWriter_t *w, const uint8_t *bytes, size_t length)
+{
+    if (fwrite(bytes, 1, length, w->file) != length)
+        return -1;
+    w->offset += length;
+    return 0;
+}
+
+// Writes the chunk being built, if it holds anything, and starts over.
+static int flushChunk(inkArchiveWriter_t *w, inkArchiveBuffer_t *b, uint8_t kind)
+{
+    uint8_t header[1 + VARINT_MAX_LENGTH + FIELDS_MAX_LENGTH], fields[FIELDS_MAX_LENGTH];
+    inkArchiveChunk_t chunk, *chunks;
+    size_t n, m, capacity;
+
+    if (b->items == 0)
+        return 0;
+
+    if (w->chunkCount == w->chunkCapacity)
+    {
+        capacity = w->chunkCapacity ? w->chunkCapacity*2 : INDEX_INITIAL_CAPACITY;
+        chunks = realloc(w->chunks, capacity*sizeof(inkArchiveChunk_t));
+        if (chunks == NULL)
+            return -1;
+        w->chunks = chunks;
+        w->chunkCapacity = capacity;
+    }
+
+    chunk.kind = kind;
+    chunk.length = (uint32_t)b->length;
+    chunk.items = b->items;
+    chunk.micros = b->micros;
+    chunk.bounds = b->bounds;
+    m = encodeFields(&chunk, fields);
+
+    header[0] = kind;
+    n = 1 + varintEncode(m + b->length, header + 1);
+    memcpy(header + n, fields, m);
+    n += m;
+    chunk.offset = w->offset + n;
+
+    if (writeBytes(w, header, n) != 0 || writeBytes(w, b->bytes, b->length) != 0)
+        return -1;
+    w->chunks[w->chunkCount++] = chunk;
+    resetBuffer(b);
+    return 0;
+}
+
+int inkArchiveWriterOpen(inkArchiveWriter_t *w, const char *path)
+{
+    uint8_t header[INK_ARCHIVE_HEADER_LENGTH];
+
+    memset(w, 0, sizeof(*w));
+    resetBuffer(&w->sampleChunk);
+    resetBuffer(&w->strokeChunk);
+
+    memcpy(header, INK_ARCHIVE_MAGIC, 4);
+    header[4] = INK_ARCHIVE_VERSION;
+    w->file = fopen(path, "wb");
+    if (w->file == NULL)
+        return -1;
+    if (writeBytes(w, header, sizeof(header)) != 0)
+    {
+        fclose(w->file);
+        w->file = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+int inkArchiveWriteSamples(inkArchiveWriter_t *w, const captureBatch_t *batch)
+{
+    inkArchiveBuffer_t *b = &w->sampleChunk;
+    uint64_t micros, delta;
+    uint8_t *p;
+    size_t i;
+
+    if (w->file == NULL)
+        return -1;
+    if (batch->count == 0)
+        return 0;
+    if (reserveBuffer(b, batch->count*SAMPLE_MAX_LENGTH) != 0)
+        return -1;
+
+    // The first sample starts the clock.
+    if (w->samples == 0)
+        w->start = batch->timestamp[0];
+
+    p = b->bytes + b->length;
+    for (i = 0; i < batch->count; i++)
+    {
+        micros = batch->timestamp[i] > w->start ? (batch->timestamp[i] - w->start)/1000 : 0;
+        if (micros < w->micros)
+            micros = w->micros;
+        if (b->items == 0)
+            b->micros = micros;
+        delta = b->items == 0 ? 0 : micros - w->micros;
+        w->micros = micros;
+
+        p += varintEncode(delta << 2 | (batch->reportId[i] != b->reportId) << 1 | (batch->flags[i] != b->flags), p);
+        p += encodeSigned((int64_t)batch->x[i] - b->x, p);
+        p += encodeSigned((int64_t)batch->y[i] - b->y, p);
+        p += encodeSigned((int64_t)batch->pressure[i] - b->pressure, p);
+        if (batch->flags[i] != b->flags)
+            *p++ = b->flags = batch->flags[i];
+        if (batch->reportId[i] != b->reportId)
+            *p++ = b->reportId = batch->reportId[i];
+        b->x = batch->x[i];
+        b->y = batch->y[i];
+        b->pressure = batch->pressure[i];
+        b->items++;
+    }
+    b->length = p - b->bytes;
+    w->samples += batch->count;
+
+    if (b->length >= INK_ARCHIVE_CHUNK_LENGTH)
+        return flushChunk(w, b, INK_ARCHIVE_SAMPLES);
+    return 0;
+}
+
+size_t inkArchiveEncodeStroke(const inkStroke_t *s, uint8_t *dst)
+{
+    uint8_t header[STROKE_MAX_HEADER], *points = dst + STROKE_MAX_HEADER;
+    inkRect_t bounds = inkStrokeInkBounds(s);
+    int32_t width, lastWidth = 0;
+    uint16_t x = 0, y = 0;
+    size_t n, m = 0;
+    uint32_t i;
+
+    // Points go after room for the header, which needs their length.
+    for (i = 0; i < s->count; i++)
+    {
+        width = (int32_t)lrintf(s->widths[i]*INK_ARCHIVE_WIDTH_SCALE);
+        m += encodeSigned((int64_t)s->points[i].x - x, points + m);
+        m += encodeSigned((int64_t)s->points[i].y - y, points + m);
+        m += encodeSigned((int64_t)width - lastWidth, points + m);
+        x = s->points[i].x;
+        y = s->points[i].y;
+        lastWidth = width;
+    }
+
+    n = varintEncode(s->count, header);
+    n += varintEncode(bounds.minX, header + n);
+    n += varintEncode(bounds.minY, header + n);
+    n += varintEncode(bounds.maxX - bounds.minX, header + n);
+    n += varintEncode(bounds.maxY - bounds.minY, header + n);
+    n += varintEncode(m, header + n);
+    memcpy(dst, header, n);
+    memmove(dst + n, points, m);
+    return n + m;
+}
+
+int inkArchiveWriteStroke(inkArchiveWriter_t *w, const inkStroke_t *s)
+{
+    inkArchiveBuffer_t *b = &w->strokeChunk;
+    inkRect_t bounds;
+
+    if (w->file == NULL)
+        return -1;
+    if (s->count == 0)
+        return 0;
+    if (reserveBuffer(b, INK_ARCHIVE_STROKE_MAX_LENGTH(s->count)) != 0)
+        return -1;
+
+    b->length += inkArchiveEncodeStroke(s, b->bytes + b->length);
+    bounds = inkStrokeInkBounds(s);
+    addBounds(&b->bounds, &bounds);
+    b->items++;
+    w->strokes++;
+
+    if (b->length >= INK_ARCHIVE_CHUNK_LENGTH)
+        return flushChunk(w, b, INK_ARCHIVE_STROKES);
+    return 0;
+}
+
+int inkArchiveWriterClose(inkArchiveWriter_t *w)
+{
+    uint8_t entry[1 + 2*VARINT_MAX_LENGTH + FIELDS_MAX_LENGTH], header[1 + VARINT_MAX_LENGTH];
+    uint8_t footer[INK_ARCHIVE_FOOTER_LENGTH];
+    inkArchiveBuffer_t *index = &w->sampleChunk;
+    uint64_t indexOffset, previous = 0;
+    size_t i, n;
+    int result = 0;
+
+    if (w->file == NULL)
+        return -1;
+
+    if (flushChunk(w, &w->sampleChunk, INK_ARCHIVE_SAMPLES) != 0 ||
+        flushChunk(w, &w->strokeChunk, INK_ARCHIVE_STROKES) != 0)
+        result = -1;
+
+    // The sample buffer is free now and builds the index.
+    n = varintEncode(w->chunkCount, entry);
+    if (result == 0 && reserveBuffer(index, n) == 0)
+    {
+        memcpy(index->bytes, entry, n);
+        index->length = n;
+        for (i = 0; i < w->chunkCount && result == 0; i++)
+        {
+            entry[0] = w->chunks[i].kind;
+            n = 1 + varintEncode(w->chunks[i].offset - previous, entry + 1);
+            n += varintEncode(w->chunks[i].length, entry + n);
+            n += encodeFields(&w->chunks[i], entry + n);
+            previous = w->chunks[i].offset;
+            if (reserveBuffer(index, n) != 0)
+                result = -1;
+            else
+            {
+                memcpy(index->bytes + index->length, entry, n);
+                index->length += n;
+            }
+        }
+
+        indexOffset = w->offset;
+        header[0] = INK_ARCHIVE_INDEX;
+        n = 1 + varintEncode(index->length, header + 1);
+        for (i = 0; i < 8; i++)
+            footer[i] = (uint8_t)(indexOffset >> (8*i));
+        memcpy(footer + 8, INK_ARCHIVE_INDEX_MAGIC, 4);
+        if (result != 0 || writeBytes(w, header, n) != 0 || writeBytes(w, index->bytes, index->length) != 0 ||
+            writeBytes(w, footer, sizeof(footer)) != 0)
+            result = -1;
+    }
+    else
+        result = -1;
+
+    if (fclose(w->file) != 0)
+        result = -1;
+    w->file = NULL;
+    free(w->sampleChunk.bytes);
+    free(w->strokeChunk.bytes);
+    free(w->chunks);
+    w->sampleChunk.bytes = w->strokeChunk.bytes = NULL;
+    w->sampleChunk.capacity = w->strokeChunk.capacity = 0;
+    w->chunks = NULL;
+    w->chunkCount = w->chunkCapacity = 0;
+    return result;
+}
+
+// Reads a varint no longer than 32 bits, advancing p. Returns 0 if there is
+// none before end.
+static inline int readUInt32(const uint8_t **p, const uint8_t *end, uint32_t *value)
+{
+    uint64_t v;
+    size_t n = varintDecode(*p, end - *p, &v);
+
+    if (n == 0 || v > UINT32_MAX)
+        return 0;
+    *p += n;
+    *value = (uint32_t)v;
+    return 1;
+}
+
+static inline int readUInt64(const uint8_t **p, const uint8_t *end, uint64_t *value)
+{
+    size_t n = varintDecode(*p, end - *p, value);
+
+    *p += n;
+    return n != 0;
+}
+
+static int readBounds(const uint8_t **p, const uint8_t *end, inkRect_t *r)
+{
+    uint32_t minX, minY, width, height;
+
+    if (!readUInt32(p, end, &minX) || !readUInt32(p, end, &minY) || !readUInt32(p, end, &width) ||
+        !readUInt32(p, end, &height) || minX + width > UINT16_MAX || minY + height > UINT16_MAX)
+        return 0;
+    r->minX = (uint16_t)minX;
+    r->minY = (uint16_t)minY;
+    r->maxX = (uint16_t)(minX + width);
+    r->maxY = (uint16_t)(minY + height);
+    return 1;
+}
+
+static int readFields(const uint8_t **p, const uint8_t *end, inkArchiveChunk_t *chunk)
+{
+    chunk->micros = 0;
+    chunk->bounds.minX = chunk->bounds.minY = UINT16_MAX;
+    chunk->bounds.maxX = chunk->bounds.maxY = 0;
+    if (!readUInt32(p, end, &chunk->items))
+        return 0;
+    if (chunk->kind == INK_ARCHIVE_SAMPLES)
+        return readUInt64(p, end, &chunk->micros);
+    if (chunk->kind == INK_ARCHIVE_STROKES)
+        return readBounds(p, end, &chunk->bounds);
+    return 1;
+}
+
+static int addChunk(inkArchive_t *a, const inkArchiveChunk_t *chunk, size_t *capacity)
+{
+    inkArchiveChunk_t *chunks;
+
+    if (a->chunkCount == *capacity)
+    {
+        *capacity = *capacity ? *capacity*2 : INDEX_INITIAL_CAPACITY;
+        chunks = realloc(a->chunks, *capacity*sizeof(inkArchiveChunk_t));
+        if (chunks == NULL)
+            return -1;
+        a->chunks = chunks;
+    }
+    a->chunks[a->chunkCount++] = *chunk;
+    if (chunk->kind == INK_ARCHIVE_SAMPLES)
+        a->samples += chunk->items;
+    else if (chunk->kind == INK_ARCHIVE_STROKES)
+        a->strokes += chunk->items;
+    return 0;
+}
+
+static void clearChunks(inkArchive_t *a)
+{
+    free(a->chunks);
+    a->chunks = NULL;
+    a->chunkCount = 0;
+    a->samples = a->strokes = 0;
+}
+
+// Reads the index the footer points at. Returns 0, or -1 if there is none or
+// it does not match the file.
+static int readIndex(inkArchive_t *a)
+{
+    const uint8_t *p, *end, *footer = a->data + a->length - INK_ARCHIVE_FOOTER_LENGTH;
+    inkArchiveChunk_t chunk;
+    uint64_t offset = 0, length;
+    uint32_t count, i;
+    size_t capacity = 0;
+
+    if (a->length < INK_ARCHIVE_HEADER_LENGTH + INK_ARCHIVE_FOOTER_LENGTH ||
+        memcmp(footer + 8, INK_ARCHIVE_INDEX_MAGIC, 4) != 0)
+        return -1;
+    for (i = 8; i > 0; i--)
+        offset = offset << 8 | footer[i - 1];
+
+    if (offset < INK_ARCHIVE_HEADER_LENGTH || offset >= (uint64_t)(footer - a->data) ||
+        a->data[offset] != INK_ARCHIVE_INDEX)
+        return -1;
+    p = a->data + offset + 1;
+    if (!readUInt64(&p, footer, &length) || length != (uint64_t)(footer - p))
+        return -1;
+    end = footer;
+
+    if (!readUInt32(&p, end, &count))
+        return -1;
+    chunk.offset = 0;
+    for (i = 0; i < count; i++)
+    {
+        if (p == end)
+            goto corrupt;
+        chunk.kind = *p++;
+        if (!readUInt64(&p, end, &length) || length > offset - chunk.offset)
+            goto corrupt;
+        chunk.offset += length;
+        if (!readUInt32(&p, end, &chunk.length) || chunk.length > offset - chunk.offset ||
+            !readFields(&p, end, &chunk) || addChunk(a, &chunk, &capacity) != 0)
+            goto corrupt;
+    }
+    return 0;
+
+corrupt:
+    clearChunks(a);
+    return -1;
+}
+
+// Finds the chunks of an archive without an index, up to the first one cut
+// short.
+static int scanChunks(inkArchive_t *a)
+{
+    const uint8_t *p = a->data + INK_ARCHIVE_HEADER_LENGTH, *end = a->data + a->length, *start;
+    inkArchiveChunk_t chunk;
+    uint64_t length;
+    size_t capacity = 0;
+
+    while (p < end && *p != INK_ARCHIVE_INDEX)
+    {
+        chunk.kind = *p++;
+        if (!readUInt64(&p, end, &length) || length > (uint64_t)(end - p))
+            break;
+        start = p;
+        if (!readFields(&p, start + length, &chunk))
+            break;
+        chunk.offset = p - a->data;
+        chunk.length = (uint32_t)(length - (p - start));
+        if (addChunk(a, &chunk, &capacity) != 0)
+            return -1;
+        p = start + length;
+    }
+    return 0;
+}
+
+int inkArchiveOpen(inkArchive_t *a, const char *path)
+{
+    struct stat st;
+    void *map;
+    int fd;
+
+    memset(a, 0, sizeof(*a));
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    if (fstat(fd, &st) != 0 || st.st_size < INK_ARCHIVE_HEADER_LENGTH)
+    {
+        close(fd);
+        return -1;
+    }
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return -1;
+
+    a->data = map;
+    a->length = (size_t)st.st_size;
+    if (memcmp(a->data, INK_ARCHIVE_MAGIC, 4) != 0 || a->data[4] != INK_ARCHIVE_VERSION ||
+        (readIndex(a) != 0 && scanChunks(a) != 0))
+    {
+        inkArchiveClose(a);
+        return -1;
+    }
+    return 0;
+}
+
+void inkArchiveClose(inkArchive_t *a)
+{
+    if (a->data)
+        munmap((void *)a->data, a->length);
+    clearChunks(a);
+    a->data = NULL;
+    a->length = 0;
+}
+
+void inkArchiveCursorInit(inkArchiveCursor_t *c, const inkArchive_t *a)
+{
+    memset(c, 0, sizeof(*c));
+    c->archive = a;
+}
+
+// Moves on to the next chunk of a kind, and with ink in rect if it is not
+// NULL. Returns 0 after the last one.
+static int nextChunk(inkArchiveCursor_t *c, uint8_t kind, const inkRect_t *rect)
+{
+    const inkArchiveChunk_t *chunk;
+
+    while (c->chunk < c->archive->chunkCount)
+    {
+        chunk = &c->archive->chunks[c->chunk++];
+        if (chunk->kind != kind || chunk->items == 0 || (rect && !intersects(&chunk->bounds, rect)))
+            continue;
+        c->next = c->archive->data + chunk->offset;
+        c->end = c->next + chunk->length;
+        c->left = chunk->items;
+        c->micros = chunk->micros;
+        c->x = c->y = c->pressure = 0;
+        c->flags = c->reportId = 0;
+        return 1;
+    }
+    return 0;
+}
+
+int inkArchiveReadStroke(const uint8_t **p, const uint8_t *end, inkArchiveStroke_t *stroke)
+{
+    uint32_t length;
+
+    if (!readUInt32(p, end, &stroke->count) || !readBounds(p, end, &stroke->bounds) ||
+        !readUInt32(p, end, &length) || length > (size_t)(end - *p))
+        return 0;
+    stroke->points = *p;
+    stroke->length = length;
+    *p += length;
+    return 1;
+}
+
+int inkArchiveNextStroke(inkArchiveCursor_t *c, const inkRect_t *rect, inkArchiveStroke_t *stroke)
+{
+    for (;;)
+    {
+        if (c->left == 0 && !nextChunk(c, INK_ARCHIVE_STROKES, rect))
+            return 0;
+
+        // A corrupt stroke ends its chunk.
+        c->left--;
+        if (!inkArchiveReadStroke(&c->next, c->end, stroke))
+        {
+            c->left = 0;
+            continue;
+        }
+        if (rect == NULL || intersects(&stroke->bounds, rect))
+            return 1;
+    }
+}
+
+int inkArchiveDecodeStroke(const inkArchiveStroke_t *stroke, inkStroke_t *s)
+{
+    inkPoint_t points[DECODE_POINTS];
+    float widths[DECODE_POINTS];
+    const uint8_t *p = stroke->points, *end = p + stroke->length;
+    int64_t x = 0, y = 0, width = 0;
+    uint64_t dx, dy, dw;
+    size_t n, m, k;
+    uint32_t i;
+
+    inkStrokeReset(s);
+    for (i = 0; i < stroke->count; i += n)
+    {
+        n = stroke->count - i < DECODE_POINTS ? stroke->count - i : DECODE_POINTS;
+        for (k = 0; k < n; k++)
+        {
+            if ((m = varintDecode(p, end - p, &dx)) == 0)
+                return -1;
+            p += m;
+            if ((m = varintDecode(p, end - p, &dy)) == 0)
+                return -1;
+            p += m;
+            if ((m = varintDecode(p, end - p, &dw)) == 0)
+                return -1;
+            p += m;
+
+            x += zigzagDecode(dx);
+            y += zigzagDecode(dy);
+            width += zigzagDecode(dw);
+            if (x < 0 || x > UINT16_MAX || y < 0 || y > UINT16_MAX)
+                return -1;
+            points[k].x = (uint16_t)x;
+            points[k].y = (uint16_t)y;
+            widths[k] = width/INK_ARCHIVE_WIDTH_SCALE;
+        }
+        if (inkStrokeAppendPoints(s, points, widths, n) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+size_t inkArchiveNextSamples(inkArchiveCursor_t *c, captureBatch_t *batch)
+{
+    uint64_t head, dx, dy, dp;
+    size_t n, m, o;
+
+    captureBatchClear(batch);
+    while (!captureBatchIsFull(batch))
+    {
+        if (c->left == 0 && !nextChunk(c, INK_ARCHIVE_SAMPLES, NULL))
+            break;
+
+        if ((n = varintDecode(c->next, c->end - c->next, &head)) == 0 ||
+            (m = varintDecode(c->next + n, c->end - c->next - n, &dx)) == 0 ||
+            (o = varintDecode(c->next + n + m, c->end - c->next - n - m, &dy)) == 0)
+        {
+            c->left = 0;
+            continue;
+        }
+        c->next += n + m + o;
+        if ((n = varintDecode(c->next, c->end - c->next, &dp)) == 0 ||
+            (size_t)(c->end - c->next) < n + (head & 1) + (head >> 1 & 1))
+        {
+            c->left = 0;
+            continue;
+        }
+        c->next += n;
+        if (head & 1)
+            c->flags = *c->next++;
+        if (head & 2)
+            c->reportId = *c->next++;
+
+        c->micros += head >> 2;
+        c->x += (uint16_t)zigzagDecode(dx);
+        c->y += (uint16_t)zigzagDecode(dy);
+        c->pressure += (uint16_t)zigzagDecode(dp);
+        c->left--;
+
+        batch->x[batch->count] = c->x;
+        batch->y[batch->count] = c->y;
+        batch->pressure[batch->count] = c->pressure;
+        batch->flags[batch->count] = c->flags;
+        batch->reportId[batch->count] = c->reportId;
+        batch->timestamp[batch->count] = c->micros*1000;
+        batch->count++;
+    }
+    batch->decoded = batch->count ? batch->timestamp[batch->count - 1] : 0;
+    return batch->count;
+}
@@ -0,0 +1,212 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_ARCHIVE_H_
+#define _INK_ARCHIVE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "capture_batch.h"
+#include "ink_stroke.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// An archive holds the capture samples of a session and the strokes filtered
+// from them, both compressed with deltas and varints. Numbers are varints,
+// zz() is a zigzag varint of a signed delta:
+//
+//   header: "BBIA" version(1)
+//   chunk:  kind(1) varint(length) fields payload
+//   index:  'X' varint(length) varint(chunks) per chunk: kind(1)
+//           varint(payload offset - previous one) varint(payload length)
+//           fields
+//   footer: offset of the index as 8 bytes little endian, "BBIX"
+//
+// where the length of a chunk counts its fields and payload, and the fields
+// depend on the kind:
+//
+//   'S' samples: varint(samples) varint(microseconds of the first sample)
+//   'K' strokes: varint(strokes) varint(minX) varint(minY)
+//                varint(maxX - minX) varint(maxY - minY)
+//
+// Each sample is varint(microseconds since the previous one << 2 | report id
+// changed << 1 | flags changed) zz(x) zz(y) zz(pressure), then the flags and
+// the report id if they changed. Each stroke is a header, varint(points)
+// varint(minX) varint(minY) varint(maxX - minX) varint(maxY - minY)
+// varint(length of the points), then zz(x) zz(y) zz(width) for every point,
+// widths in 1/INK_ARCHIVE_WIDTH_SCALE digitizer units. Deltas start from 0
+// and from the first sample's time at the start of every chunk, so chunks
+// decode on their own, and the header bounds the ink of the stroke, so a
+// reader can skip strokes and whole chunks without decoding points.
+//
+// Chunks are appended as they fill. An archive cut short before its index is
+// still readable up to its last complete chunk.
+#define INK_ARCHIVE_MAGIC           "BBIA"
+#define INK_ARCHIVE_INDEX_MAGIC     "BBIX"
+#define INK_ARCHIVE_VERSION         1
+#define INK_ARCHIVE_HEADER_LENGTH   5
+#define INK_ARCHIVE_FOOTER_LENGTH   12
+
+#define INK_ARCHIVE_SAMPLES         'S'
+#define INK_ARCHIVE_STROKES         'K'
+#define INK_ARCHIVE_INDEX           'X'
+
+// Widths are stored in 1/32 digitizer units.
+#define INK_ARCHIVE_WIDTH_SCALE     32.0f
+
+// Bytes a chunk is allowed to grow to before it is written out.
+#define INK_ARCHIVE_CHUNK_LENGTH    (64*1024)
+
+// Longest encoding of a stroke of count points: its header and three zigzag
+// varints of 32 bits per point.
+#define INK_ARCHIVE_STROKE_MAX_LENGTH(count)    (60 + (size_t)(count)*15)
+
+// A chunk as found in the index.
+typedef struct
+{
+    uint8_t   kind;
+    uint64_t  offset;                   // Of the first byte of its payload.
+    uint32_t  length;                   // Of its payload.
+    uint32_t  items;                    // Samples or strokes.
+    uint64_t  micros;                   // Time of the first sample.
+    inkRect_t bounds;                   // Ink bounds of the strokes.
+} inkArchiveChunk_t;
+
+// A chunk being built.
+typedef struct
+{
+    uint8_t  *bytes;
+    size_t    length;
+    size_t    capacity;
+    uint32_t  items;
+    uint64_t  micros;
+    inkRect_t bounds;
+    uint16_t  x;                        // Previous sample.
+    uint16_t  y;
+    uint16_t  pressure;
+    uint8_t   flags;
+    uint8_t   reportId;
+} inkArchiveBuffer_t;
+
+typedef struct
+{
+    FILE               *file;
+    uint64_t            offset;         // Bytes written.
+    uint64_t            start;          // Monotonic ns of the first sample.
+    uint64_t            micros;         // Of the previous sample.
+    uint64_t            samples;
+    uint64_t            strokes;
+    inkArchiveBuffer_t  sampleChunk;
+    inkArchiveBuffer_t  strokeChunk;
+    inkArchiveChunk_t  *chunks;         // Written so far.
+    size_t              chunkCount;
+    size_t              chunkCapacity;
+} inkArchiveWriter_t;
+
+// Creates the file and writes the header. Returns 0 on success, -1 on failure.
+int inkArchiveWriterOpen(inkArchiveWriter_t *w, const char *path);
+
+// Appends the samples of a batch. Returns 0 on success, -1 on failure.
+int inkArchiveWriteSamples(inkArchiveWriter_t *w, const captureBatch_t *batch);
+
+// Appends a stroke, normally once it is finished. Returns 0 on success, -1 on
+// failure.
+int inkArchiveWriteStroke(inkArchiveWriter_t *w, const inkStroke_t *s);
+
+// Writes out what is buffered, the index and the footer, and closes the file.
+// Returns 0 on success, -1 if any of it could not be written.
+int inkArchiveWriterClose(inkArchiveWriter_t *w);
+
+// Encodes a stroke, header and points, into dst, which has room for
+// INK_ARCHIVE_STROKE_MAX_LENGTH(s->count) bytes. Returns the bytes written.
+// Lets other stores keep strokes the way archives do.
+size_t inkArchiveEncodeStroke(const inkStroke_t *s, uint8_t *dst);
+
+// Read-only view of an archive mapped into memory.
+typedef struct
+{
+    const uint8_t     *data;
+    size_t             length;
+    inkArchiveChunk_t *chunks;
+    size_t             chunkCount;
+    uint64_t           samples;
+    uint64_t           strokes;
+} inkArchive_t;
+
+// Maps the file and reads its index, or finds its chunks if it has none.
+// Returns 0 on success, -1 if it cannot be read or is not an archive.
+int inkArchiveOpen(inkArchive_t *a, const char *path);
+
+void inkArchiveClose(inkArchive_t *a);
+
+// A stroke inside the mapping, not decoded yet.
+typedef struct
+{
+    inkRect_t      bounds;
+    uint32_t       count;               // Points.
+    const uint8_t *points;
+    size_t         length;
+} inkArchiveStroke_t;
+
+// Reads the header of an encoded stroke at *p and moves *p past its points.
+// Returns 0 if the stroke does not fit before end.
+int inkArchiveReadStroke(const uint8_t **p, const uint8_t *end, inkArchiveStroke_t *stroke);
+
+// Position in the chunks of one kind.
+typedef struct
+{
+    const inkArchive_t *archive;
+    size_t              chunk;          // Next chunk to look at.
+    const uint8_t      *next;           // Next item of the current chunk.
+    const uint8_t      *end;
+    uint32_t            left;           // Items left in the current chunk.
+    uint64_t            micros;         // Previous sample.
+    uint16_t            x;
+    uint16_t            y;
+    uint16_t            pressure;
+    uint8_t             flags;
+    uint8_t             reportId;
+} inkArchiveCursor_t;
+
+// Starts before the first chunk. Use a cursor for either strokes or samples.
+void inkArchiveCursorInit(inkArchiveCursor_t *c, const inkArchive_t *a);
+
+// Finds the next stroke whose ink bounds intersect rect, or the next stroke if
+// rect is NULL, without decoding its points. Chunks and strokes outside rect
+// are skipped by their bounds. Returns 0 after the last one.
+int inkArchiveNextStroke(inkArchiveCursor_t *c, const inkRect_t *rect, inkArchiveStroke_t *stroke);
+
+// Decodes the points of a stroke into s, replacing what s held. Returns 0, or
+// -1 if memory ran out or the stroke is corrupt.
+int inkArchiveDecodeStroke(const inkArchiveStroke_t *stroke, inkStroke_t *s);
+
+// Decodes up to a batch of samples. Timestamps are nanoseconds from the first
+// sample of the archive. Returns the number of samples, 0 after the last one.
+size_t inkArchiveNextSamples(inkArchiveCursor_t *c, captureBatch_t *batch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_ARCHIVE_H_ */
@@ -0,0 +1,427 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Curve fitting follows Philip J. Schneider, "An Algorithm for Automatically
+// Fitting Digitized Curves", Graphics Gems, 1990, with the width fitted as a
+// fourth coordinate using the same parameters.
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ink_curve.h"
+
+#define CURVES_INITIAL_CAPACITY 16
+#define MAX_REPARAMETERIZATIONS 4
+#define FLATTEN_CHUNK           64
+
+typedef struct
+{
+    float x;
+    float y;
+} vector_t;
+
+typedef struct
+{
+    float x;
+    float y;
+    float width;
+} point_t;
+
+typedef struct
+{
+    inkCurves_t   *curves;
+    const point_t *points;              // Stroke points without repeats.
+    float         *u;                   // Parameter of each point on its curve.
+    float          tolerance;
+} fit_t;
+
+void inkCurvesInit(inkCurves_t *c)
+{
+    c->points = NULL;
+    c->count = 0;
+    c->capacity = 0;
+}
+
+void inkCurvesFree(inkCurves_t *c)
+{
+    free(c->points);
+    inkCurvesInit(c);
+}
+
+size_t inkCurvesMemory(const inkCurves_t *c)
+{
+    return c->capacity*sizeof(inkCurvePoint_t);
+}
+
+static inline vector_t direction(const point_t *from, const point_t *to)
+{
+    vector_t v = {to->x - from->x, to->y - from->y};
+    float length = sqrtf(v.x*v.x + v.y*v.y);
+
+    if (length > 0.0f)
+    {
+        v.x /= length;
+        v.y /= length;
+    }
+    return v;
+}
+
+static inline float distance(const point_t *a, const point_t *b)
+{
+    return sqrtf((a->x - b->x)*(a->x - b->x) + (a->y - b->y)*(a->y - b->y));
+}
+
+static inline point_t bezier(const point_t *b, float t)
+{
+    float s = 1.0f - t;
+    float b0 = s*s*s, b1 = 3*s*s*t, b2 = 3*s*t*t, b3 = t*t*t;
+    point_t p;
+
+    p.x = b0*b[0].x + b1*b[1].x + b2*b[2].x + b3*b[3].x;
+    p.y = b0*b[0].y + b1*b[1].y + b2*b[2].y + b3*b[3].y;
+    p.width = b0*b[0].width + b1*b[1].width + b2*b[2].width + b3*b[3].width;
+    return p;
+}
+
+static inline int16_t toShort(float value)
+{
+    value = value < 0.0f ? value - 0.5f : value + 0.5f;
+    return value < INT16_MIN ? INT16_MIN : (value > INT16_MAX ? INT16_MAX : (int16_t)value);
+}
+
+static inline point_t fromCurvePoint(const inkCurvePoint_t *p)
+{
+    point_t q = {p->x, p->y, p->width/INK_CURVE_WIDTH_SCALE};
+    return q;
+}
+
+static int addCurve(inkCurves_t *c, const point_t *b)
+{
+    inkCurvePoint_t *points, *p;
+    uint32_t needed = c->count ? 3*c->count + 4 : 4, capacity;
+    int i;
+
+    if (needed > c->capacity)
+    {
+        capacity = c->capacity ? c->capacity : CURVES_INITIAL_CAPACITY;
+        while (capacity < needed)
+            capacity *= 2;
+        points = realloc(c->points, capacity*sizeof(inkCurvePoint_t));
+        if (points == NULL)
+            return -1;
+        c->points = points;
+        c->capacity = capacity;
+    }
+
+    // Curves share their ends.
+    p = c->points + (c->count ? 3*c->count + 1 : 0);
+    for (i = c->count ? 1 : 0; i < 4; i++, p++)
+    {
+        p->x = toShort(b[i].x);
+        p->y = toShort(b[i].y);
+        p->width = toShort(b[i].width*INK_CURVE_WIDTH_SCALE);
+    }
+    c->count++;
+    return 0;
+}
+
+static void chordLengthParameterize(fit_t *f, int first, int last)
+{
+    int i;
+
+    f->u[first] = 0.0f;
+    for (i = first + 1; i <= last; i++)
+        f->u[i] = f->u[i - 1] + distance(&f->points[i], &f->points[i - 1]);
+    for (i = first + 1; i <= last; i++)
+        f->u[i] /= f->u[last];
+}
+
+// Control points a third of the way along the end tangents, and widths a
+// third of the way between the ends.
+static void heuristicCurve(const fit_t *f, int first, int last, vector_t t1, vector_t t2, point_t *b)
+{
+    float third = distance(&f->points[first], &f->points[last])/3;
+    float w0 = f->points[first].width, w3 = f->points[last].width;
+
+    b[0] = f->points[first];
+    b[3] = f->points[last];
+    b[1].x = b[0].x + t1.x*third;
+    b[1].y = b[0].y + t1.y*third;
+    b[2].x = b[3].x + t2.x*third;
+    b[2].y = b[3].y + t2.y*third;
+    b[1].width = w0 + (w3 - w0)/3;
+    b[2].width = w0 + 2*(w3 - w0)/3;
+}
+
+// Least squares curve through the points at their parameters, with the ends
+// fixed and the inner control points on the end tangents.
+static void generateCurve(const fit_t *f, int first, int last, vector_t t1, vector_t t2, point_t *b)
+{
+    const point_t *p0 = &f->points[first], *p3 = &f->points[last];
+    double a00 = 0, a01 = 0, a11 = 0, x0 = 0, x1 = 0, v0 = 0, v1 = 0;
+    double c01, det, alpha1 = 0, alpha2 = 0, rx, ry, rw, s, t, b0, b1, b2, b3;
+    float epsilon = distance(p0, p3)*1e-6f;
+    int i;
+
+    for (i = first; i <= last; i++)
+    {
+        t = f->u[i];
+        s = 1 - t;
+        b0 = s*s*s;
+        b1 = 3*s*s*t;
+        b2 = 3*s*t*t;
+        b3 = t*t*t;
+        a00 += b1*b1;
+        a01 += b1*b2;
+        a11 += b2*b2;
+
+        // What the inner control points have to make up for.
+        rx = f->points[i].x - (b0 + b1)*p0->x - (b2 + b3)*p3->x;
+        ry = f->points[i].y - (b0 + b1)*p0->y - (b2 + b3)*p3->y;
+        rw = f->points[i].width - b0*p0->width - b3*p3->width;
+        x0 += b1*(rx*t1.x + ry*t1.y);
+        x1 += b2*(rx*t2.x + ry*t2.y);
+        v0 += b1*rw;
+        v1 += b2*rw;
+    }
+
+    heuristicCurve(f, first, last, t1, t2, b);
+
+    // Distances along the tangents, whose cross term carries t1 . t2.
+    c01 = a01*(t1.x*t2.x + t1.y*t2.y);
+    det = a00*a11 - c01*c01;
+    if (fabs(det) > 1e-12)
+    {
+        alpha1 = (x0*a11 - x1*c01)/det;
+        alpha2 = (a00*x1 - c01*x0)/det;
+    }
+    if (alpha1 > epsilon && alpha2 > epsilon)
+    {
+        b[1].x = p0->x + t1.x*(float)alpha1;
+        b[1].y = p0->y + t1.y*(float)alpha1;
+        b[2].x = p3->x + t2.x*(float)alpha2;
+        b[2].y = p3->y + t2.y*(float)alpha2;
+    }
+
+    // Inner widths, a plain least squares fit.
+    det = a00*a11 - a01*a01;
+    if (fabs(det) > 1e-12)
+    {
+        b[1].width = (float)((v0*a11 - v1*a01)/det);
+        b[2].width = (float)((a00*v1 - a01*v0)/det);
+    }
+}
+
+// Largest distance, in position or width, from a point to the curve at its
+// parameter, and the point where it is.
+static float maxError(const fit_t *f, int first, int last, const point_t *b, int *split)
+{
+    point_t q;
+    float error, worst = 0.0f;
+    int i;
+
+    *split = (first + last)/2;
+    for (i = first + 1; i < last; i++)
+    {
+        q = bezier(b, f->u[i]);
+        error = distance(&q, &f->points[i]);
+        if (fabsf(q.width - f->points[i].width) > error)
+            error = fabsf(q.width - f->points[i].width);
+        if (error > worst)
+        {
+            worst = error;
+            *split = i;
+        }
+    }
+    return worst;
+}
+
+// One Newton step towards the parameter of the curve point closest to each
+// point.
+static void reparameterize(fit_t *f, int first, int last, const point_t *b)
+{
+    float t, s, qx, qy, d1x, d1y, d2x, d2y, numerator, denominator;
+    int i;
+
+    for (i = first; i <= last; i++)
+    {
+        t = f->u[i];
+        s = 1.0f - t;
+        qx = s*s*s*b[0].x + 3*s*s*t*b[1].x + 3*s*t*t*b[2].x + t*t*t*b[3].x - f->points[i].x;
+        qy = s*s*s*b[0].y + 3*s*s*t*b[1].y + 3*s*t*t*b[2].y + t*t*t*b[3].y - f->points[i].y;
+        d1x = 3*(s*s*(b[1].x - b[0].x) + 2*s*t*(b[2].x - b[1].x) + t*t*(b[3].x - b[2].x));
+        d1y = 3*(s*s*(b[1].y - b[0].y) + 2*s*t*(b[2].y - b[1].y) + t*t*(b[3].y - b[2].y));
+        d2x = 6*(s*(b[2].x - 2*b[1].x + b[0].x) + t*(b[3].x - 2*b[2].x + b[1].x));
+        d2y = 6*(s*(b[2].y - 2*b[1].y + b[0].y) + t*(b[3].y - 2*b[2].y + b[1].y));
+
+        numerator = qx*d1x + qy*d1y;
+        denominator = d1x*d1x + d1y*d1y + qx*d2x + qy*d2y;
+        if (denominator != 0.0f)
+        {
+            t -= numerator/denominator;
+            f->u[i] = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        }
+    }
+}
+
+static int fitCubic(fit_t *f, int first, int last, vector_t t1, vector_t t2)
+{
+    point_t b[4];
+    vector_t center;
+    float error;
+    int split, i;
+
+    if (last - first == 1)
+    {
+        heuristicCurve(f, first, last, t1, t2, b);
+        return addCurve(f->curves, b);
+    }
+
+    chordLengthParameterize(f, first, last);
+    generateCurve(f, first, last, t1, t2, b);
+    error = maxError(f, first, last, b, &split);
+    if (error <= f->tolerance)
+        return addCurve(f->curves, b);
+
+    // Close enough that better parameters may do.
+    if (error <= 4*f->tolerance)
+    {
+        for (i = 0; i < MAX_REPARAMETERIZATIONS; i++)
+        {
+            reparameterize(f, first, last, b);
+            generateCurve(f, first, last, t1, t2, b);
+            error = maxError(f, first, last, b, &split);
+            if (error <= f->tolerance)
+                return addCurve(f->curves, b);
+        }
+    }
+
+    // Split where the fit is worst, keeping the tangent smooth there.
+    center = direction(&f->points[split + 1], &f->points[split - 1]);
+    if (center.x == 0.0f && center.y == 0.0f)
+        center = direction(&f->points[split], &f->points[split - 1]);
+
+    if (fitCubic(f, first, split, t1, center) != 0)
+        return -1;
+    center.x = -center.x;
+    center.y = -center.y;
+    return fitCubic(f, split, last, center, t2);
+}
+
+int inkCurvesFit(inkCurves_t *c, const inkStroke_t *s, float tolerance)
+{
+    point_t *points, b[4];
+    fit_t f;
+    uint32_t i;
+    int n = 0, result;
+
+    c->count = 0;
+    if (s->count == 0)
+        return 0;
+
+    points = malloc(s->count*(sizeof(point_t) + sizeof(float)));
+    if (points == NULL)
+        return -1;
+
+    // Points that repeat add nothing to the shape, keep the widest width.
+    for (i = 0; i < s->count; i++)
+    {
+        if (n > 0 && points[n - 1].x == s->points[i].x && points[n - 1].y == s->points[i].y)
+        {
+            if (s->widths[i] > points[n - 1].width)
+                points[n - 1].width = s->widths[i];
+            continue;
+        }
+        points[n].x = s->points[i].x;
+        points[n].y = s->points[i].y;
+        points[n].width = s->widths[i];
+        n++;
+    }
+
+    if (n == 1)
+    {
+        // A dot.
+        b[0] = b[1] = b[2] = b[3] = points[0];
+        result = addCurve(c, b);
+    }
+    else
+    {
+        f.curves = c;
+        f.points = points;
+        f.u = (float *)(points + s->count);
+        f.tolerance = tolerance;
+        result = fitCubic(&f, 0, n - 1, direction(&points[0], &points[1]), direction(&points[n - 1], &points[n - 2]));
+    }
+
+    free(points);
+    return result;
+}
+
+int inkCurvesFlatten(const inkCurves_t *c, float tolerance, inkStroke_t *s)
+{
+    inkSegment_t segments[FLATTEN_CHUNK];
+    point_t b[4], p, last;
+    float ddx, ddy, dd;
+    uint32_t i;
+    int j, steps, n = 0;
+
+    inkStrokeReset(s);
+    if (c->count == 0)
+        return 0;
+
+    last = fromCurvePoint(&c->points[0]);
+    for (i = 0; i < c->count; i++)
+    {
+        for (j = 0; j < 4; j++)
+            b[j] = fromCurvePoint(&c->points[3*i + j]);
+
+        // Uniform steps keep within tolerance when they are at least
+        // sqrt(3/4*L/tolerance), L the largest second difference.
+        ddx = fabsf(b[0].x - 2*b[1].x + b[2].x) > fabsf(b[1].x - 2*b[2].x + b[3].x) ?
+              b[0].x - 2*b[1].x + b[2].x : b[1].x - 2*b[2].x + b[3].x;
+        ddy = fabsf(b[0].y - 2*b[1].y + b[2].y) > fabsf(b[1].y - 2*b[2].y + b[3].y) ?
+              b[0].y - 2*b[1].y + b[2].y : b[1].y - 2*b[2].y + b[3].y;
+        dd = sqrtf(ddx*ddx + ddy*ddy);
+        steps = (int)ceilf(sqrtf(0.75f*dd/tolerance));
+        if (steps < 1)
+            steps = 1;
+
+        for (j = 1; j <= steps; j++)
+        {
+            p = j == steps ? b[3] : bezier(b, (float)j/steps);
+            segments[n].x1 = (uint16_t)(last.x + 0.5f);
+            segments[n].y1 = (uint16_t)(last.y + 0.5f);
+            segments[n].x2 = (uint16_t)(p.x > 0.0f ? p.x + 0.5f : 0.0f);
+            segments[n].y2 = (uint16_t)(p.y > 0.0f ? p.y + 0.5f : 0.0f);
+            segments[n].width = p.width > 0.0f ? p.width : 0.0f;
+            last = p;
+            last.x = segments[n].x2;
+            last.y = segments[n].y2;
+            if (++n == FLATTEN_CHUNK)
+            {
+                if (inkStrokeAppendSegments(s, segments, n) != 0)
+                    return -1;
+                n = 0;
+            }
+        }
+    }
+    return inkStrokeAppendSegments(s, segments, n);
+}
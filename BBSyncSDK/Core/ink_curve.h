@@ -0,0 +1,81 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_CURVE_H_
+#define _INK_CURVE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ink_stroke.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Widths of control points are stored in 1/32 digitizer units.
+#define INK_CURVE_WIDTH_SCALE   32.0f
+
+// Control point of a curve in whole digitizer units, which control points can
+// fall outside of. Width is the fourth coordinate of the curve, so it varies
+// along it as smoothly as the position.
+typedef struct
+{
+    int16_t x;
+    int16_t y;
+    int16_t width;
+} inkCurvePoint_t;
+
+// A stroke as a chain of cubic Beziers, each starting where the one before
+// ends. points holds the start of the first curve and then the two control
+// points and the end of each curve, 3*count + 1 in all.
+typedef struct
+{
+    inkCurvePoint_t *points;
+    uint32_t         count;
+    uint32_t         capacity;          // Points with storage.
+} inkCurves_t;
+
+void inkCurvesInit(inkCurves_t *c);
+void inkCurvesFree(inkCurves_t *c);
+
+// Fits curves to a finished stroke, replacing any the curves held. Every point
+// of the stroke lies within tolerance of the curves, and its width within
+// tolerance of theirs, in digitizer units, give or take rounding the control
+// points. Returns 0, or -1 if memory ran out.
+int inkCurvesFit(inkCurves_t *c, const inkStroke_t *s, float tolerance);
+
+// Turns the curves back into a polyline in s, no further than tolerance from
+// the curves, replacing what s held. Returns 0, or -1 if memory ran out.
+int inkCurvesFlatten(const inkCurves_t *c, float tolerance, inkStroke_t *s);
+
+// Share of the error allowed for drawn ink that goes to fitting curves, the
+// rest to flattening them, so the polyline drawn stays within the total of the
+// filtered points, give or take rounding to digitizer units.
+#define INK_CURVE_FIT_SHARE     0.5f
+
+// Bytes of memory held by the curves.
+size_t inkCurvesMemory(const inkCurves_t *c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_CURVE_H_ */
@@ -0,0 +1,328 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <math.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ink_export.h"
+
+// Digitizer units per mm, and PDF points per digitizer unit as 72/2540.
+#define UNITS_PER_MM        100
+#define POINTS_PER_INCH     72
+#define UNITS_PER_INCH      2540
+
+// Longest text written for a segment or ahead of the ink.
+#define SEGMENT_MAX_LENGTH  96
+#define PROLOGUE_MAX_LENGTH 512
+
+// Writes value/10^decimals with its decimals. printf is avoided for numbers
+// with a fraction, whose decimal point follows the locale.
+static int formatFixed(char *dst, size_t size, uint64_t value, int decimals)
+{
+    uint64_t unit = 1;
+    int i;
+
+    for (i = 0; i < decimals; i++)
+        unit *= 10;
+    if (decimals == 0)
+        return snprintf(dst, size, "%llu", (unsigned long long)value);
+    return snprintf(dst, size, "%llu.%0*llu", (unsigned long long)(value/unit), decimals,
+                    (unsigned long long)(value%unit));
+}
+
+static int writeBytes(inkExportWriter_t *w, const char *bytes, size_t length)
+{
+    if (fwrite(bytes, 1, length, w->file) != length)
+        return -1;
+    w->offset += length;
+    return 0;
+}
+
+static int writeText(inkExportWriter_t *w, const char *text)
+{
+    return writeBytes(w, text, strlen(text));
+}
+
+// Ends the open path, if any.
+static int endPath(inkExportWriter_t *w)
+{
+    if (w->pathWidth < 0)
+        return 0;
+    w->pathWidth = -1;
+    return writeText(w, w->format == INK_EXPORT_SVG ? "\"/>\n" : "S\n");
+}
+
+// Number formatting for segments, which snprintf makes several times slower
+// than filtering them.
+static inline char *appendUnsigned(char *p, uint32_t value)
+{
+    char digits[10];
+    int n = 0;
+
+    do
+    {
+        digits[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+    while (n > 0)
+        *p++ = digits[--n];
+    return p;
+}
+
+static inline char *appendText(char *p, const char *text)
+{
+    while (*text)
+        *p++ = *text++;
+    return p;
+}
+
+static inline char *appendPoint(char *p, uint16_t x, uint16_t y)
+{
+    p = appendUnsigned(p, x);
+    *p++ = ' ';
+    return appendUnsigned(p, y);
+}
+
+// Widths are in tenths.
+static inline char *appendWidth(char *p, int32_t width)
+{
+    p = appendUnsigned(p, (uint32_t)width/10);
+    *p++ = '.';
+    *p++ = '0' + width % 10;
+    return p;
+}
+
+static int writeSegment(inkExportWriter_t *w, const inkSegment_t *s)
+{
+    char text[SEGMENT_MAX_LENGTH], *p = text;
+    int32_t width = s->width > 0 ? (int32_t)lrintf(s->width*10) : 0;
+
+    // A segment continuing the open path at its width is one more point.
+    if (width == w->pathWidth && s->x1 == w->x && s->y1 == w->y)
+    {
+        if (w->format == INK_EXPORT_SVG)
+        {
+            *p++ = ' ';
+            p = appendPoint(p, s->x2, s->y2);
+        }
+        else
+        {
+            p = appendPoint(p, s->x2, s->y2);
+            p = appendText(p, " l\n");
+        }
+    }
+    else
+    {
+        if (endPath(w) != 0)
+            return -1;
+        if (w->format == INK_EXPORT_SVG)
+        {
+            p = appendText(p, "<path stroke-width=\"");
+            p = appendWidth(p, width);
+            p = appendText(p, "\" d=\"M");
+            p = appendPoint(p, s->x1, s->y1);
+            *p++ = 'L';
+            p = appendPoint(p, s->x2, s->y2);
+        }
+        else
+        {
+            // The line width is part of the graphics state and outlives paths.
+            if (width != w->lineWidth)
+            {
+                p = appendWidth(p, width);
+                p = appendText(p, " w\n");
+                w->lineWidth = width;
+            }
+            p = appendPoint(p, s->x1, s->y1);
+            p = appendText(p, " m\n");
+            p = appendPoint(p, s->x2, s->y2);
+            p = appendText(p, " l\n");
+        }
+        w->pathWidth = width;
+    }
+    w->x = s->x2;
+    w->y = s->y2;
+    w->segments++;
+    return writeBytes(w, text, p - text);
+}
+
+static int writeSVGPrologue(inkExportWriter_t *w)
+{
+    char text[PROLOGUE_MAX_LENGTH], width[32], height[32];
+
+    formatFixed(width, sizeof(width), INK_DIGITIZER_MAX_X, 2);
+    formatFixed(height, sizeof(height), INK_DIGITIZER_MAX_Y, 2);
+    snprintf(text, sizeof(text),
+             "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+             "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%smm\" height=\"%smm\" viewBox=\"0 0 %d %d\">\n"
+             "<g fill=\"none\" stroke=\"#000\" stroke-linecap=\"round\" stroke-linejoin=\"round\">\n",
+             width, height, INK_DIGITIZER_MAX_X, INK_DIGITIZER_MAX_Y);
+    return writeText(w, text);
+}
+
+static int writePDFPrologue(inkExportWriter_t *w)
+{
+    char text[PROLOGUE_MAX_LENGTH], width[32], height[32], scale[32];
+    const char *objects[INK_EXPORT_PDF_OBJECTS - 1];
+    int i;
+
+    // The page is the digitizer in points, and its content is drawn in
+    // digitizer units with y flipped so the origin is top left.
+    formatFixed(width, sizeof(width), (uint64_t)INK_DIGITIZER_MAX_X*POINTS_PER_INCH*1000/UNITS_PER_INCH, 3);
+    formatFixed(height, sizeof(height), (uint64_t)INK_DIGITIZER_MAX_Y*POINTS_PER_INCH*1000/UNITS_PER_INCH, 3);
+    formatFixed(scale, sizeof(scale), (uint64_t)POINTS_PER_INCH*10000000/UNITS_PER_INCH, 7);
+
+    if (writeText(w, "%PDF-1.4\n%\xe2\xe3\xcf\xd3\n") != 0)
+        return -1;
+    objects[0] = "1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n";
+    objects[1] = "2 0 obj\n<< /Type /Pages /Kids [3 0 R] /Count 1 >>\nendobj\n";
+    objects[2] = text;
+    objects[3] = "4 0 obj\n<< /Length 5 0 R >>\nstream\n";
+    snprintf(text, sizeof(text),
+             "3 0 obj\n<< /Type /Page /Parent 2 0 R /MediaBox [0 0 %s %s] /Resources << >> /Contents 4 0 R >>\nendobj\n",
+             width, height);
+    for (i = 0; i < INK_EXPORT_PDF_OBJECTS - 1; i++)
+    {
+        w->objectOffsets[i] = w->offset;
+        if (writeText(w, objects[i]) != 0)
+            return -1;
+    }
+
+    w->streamOffset = w->offset;
+    snprintf(text, sizeof(text), "%s 0 0 -%s 0 %s cm\n1 J\n1 j\n", scale, scale, height);
+    return writeText(w, text);
+}
+
+int inkExportWriterOpen(inkExportWriter_t *w, const char *path, inkExportFormat_t format)
+{
+    int result;
+
+    memset(w, 0, sizeof(*w));
+    w->format = format;
+    w->pathWidth = -1;
+    w->lineWidth = -1;
+
+    w->file = fopen(path, "wb");
+    if (w->file == NULL)
+        return -1;
+    result = format == INK_EXPORT_SVG ? writeSVGPrologue(w) : writePDFPrologue(w);
+    if (result != 0)
+    {
+        fclose(w->file);
+        w->file = NULL;
+        return -1;
+    }
+    w->inkOffset = w->offset;
+    return 0;
+}
+
+int inkExportWriteSegments(inkExportWriter_t *w, const inkSegment_t *segments, size_t count)
+{
+    size_t i;
+
+    if (w->file == NULL)
+        return -1;
+    for (i = 0; i < count; i++)
+    {
+        if (writeSegment(w, &segments[i]) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+int inkExportWriteStroke(inkExportWriter_t *w, const inkStroke_t *s, uint32_t from, uint32_t to)
+{
+    inkSegment_t segment;
+    uint32_t i;
+
+    if (w->file == NULL)
+        return -1;
+    for (i = from > 0 ? from : 1; i < to && i < s->count; i++)
+    {
+        segment.x1 = s->points[i - 1].x;
+        segment.y1 = s->points[i - 1].y;
+        segment.x2 = s->points[i].x;
+        segment.y2 = s->points[i].y;
+        segment.width = s->widths[i];
+        if (writeSegment(w, &segment) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+int inkExportClear(inkExportWriter_t *w)
+{
+    if (w->file == NULL)
+        return -1;
+
+    w->pathWidth = -1;
+    w->lineWidth = -1;
+    w->offset = w->inkOffset;
+    if (fflush(w->file) != 0 || ftruncate(fileno(w->file), (off_t)w->inkOffset) != 0 ||
+        fseeko(w->file, (off_t)w->inkOffset, SEEK_SET) != 0)
+        return -1;
+    return 0;
+}
+
+int inkExportWriterClose(inkExportWriter_t *w)
+{
+    char text[PROLOGUE_MAX_LENGTH];
+    uint64_t length, xref;
+    int result = 0, i, n;
+
+    if (w->file == NULL)
+        return -1;
+
+    if (endPath(w) != 0)
+        result = -1;
+    if (w->format == INK_EXPORT_SVG)
+    {
+        if (writeText(w, "</g>\n</svg>\n") != 0)
+            result = -1;
+    }
+    else
+    {
+        // The length of the stream, then the cross-reference table, all of
+        // them a fixed size. The end of line ahead of endstream is not part
+        // of the stream.
+        length = w->offset - w->streamOffset;
+        if (writeText(w, "\nendstream\nendobj\n") != 0)
+            result = -1;
+        w->objectOffsets[INK_EXPORT_PDF_OBJECTS - 1] = w->offset;
+        snprintf(text, sizeof(text), "5 0 obj\n%llu\nendobj\n", (unsigned long long)length);
+        if (writeText(w, text) != 0)
+            result = -1;
+
+        xref = w->offset;
+        n = snprintf(text, sizeof(text), "xref\n0 %d\n0000000000 65535 f \n", INK_EXPORT_PDF_OBJECTS + 1);
+        for (i = 0; i < INK_EXPORT_PDF_OBJECTS; i++)
+            n += snprintf(text + n, sizeof(text) - n, "%010llu 00000 n \n", (unsigned long long)w->objectOffsets[i]);
+        n += snprintf(text + n, sizeof(text) - n, "trailer\n<< /Size %d /Root 1 0 R >>\nstartxref\n%llu\n%%%%EOF\n",
+                      INK_EXPORT_PDF_OBJECTS + 1, (unsigned long long)xref);
+        if (writeBytes(w, text, n) != 0)
+            result = -1;
+    }
+
+    if (fclose(w->file) != 0)
+        result = -1;
+    w->file = NULL;
+    return result;
+}
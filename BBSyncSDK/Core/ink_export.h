@@ -0,0 +1,94 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_EXPORT_H_
+#define _INK_EXPORT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "ink_filter.h"
+#include "ink_stroke.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Vector documents written as the ink is filtered. Segments are appended to
+// the open path while they continue it at the same width, otherwise the path
+// is ended and a new one started, so a trace becomes a handful of paths. Pages
+// are the digitizer at its true size, in digitizer units with the origin top
+// left, lines round capped and joined, widths in tenths of a unit.
+//
+// Nothing after the ink depends on it: SVG ends with two closing tags, and a
+// PDF's content stream takes its length from an object written after it and
+// the page objects are written ahead of it with known offsets. Closing
+// therefore writes a fixed amount whatever the page holds.
+typedef enum
+{
+    INK_EXPORT_SVG,
+    INK_EXPORT_PDF
+} inkExportFormat_t;
+
+// Objects of an exported PDF: catalog, pages, page, content stream, length.
+#define INK_EXPORT_PDF_OBJECTS      5
+
+typedef struct
+{
+    FILE              *file;
+    inkExportFormat_t  format;
+    uint64_t           offset;          // Bytes written.
+    uint64_t           inkOffset;       // Of the first path, clearing truncates back to it.
+    uint64_t           streamOffset;    // Of the PDF content stream.
+    uint64_t           objectOffsets[INK_EXPORT_PDF_OBJECTS];
+    int32_t            pathWidth;       // Of the open path, -1 if none is open.
+    int32_t            lineWidth;       // PDF line width set last, -1 if none.
+    uint16_t           x;               // End of the open path.
+    uint16_t           y;
+    uint64_t           segments;
+} inkExportWriter_t;
+
+// Creates the file and writes everything ahead of the ink. Returns 0 on
+// success, -1 on failure.
+int inkExportWriterOpen(inkExportWriter_t *w, const char *path, inkExportFormat_t format);
+
+// Appends segments as the filter reports them. Returns 0 on success, -1 on
+// failure.
+int inkExportWriteSegments(inkExportWriter_t *w, const inkSegment_t *segments, size_t count);
+
+// Appends the segments ending at points[from] up to points[to - 1] of a
+// stroke, e.g. the ink already on screen when the export starts. Returns 0 on
+// success, -1 on failure.
+int inkExportWriteStroke(inkExportWriter_t *w, const inkStroke_t *s, uint32_t from, uint32_t to);
+
+// Drops the ink written so far, as the Sync's erase does, by truncating the
+// file back to where it started. Returns 0 on success, -1 on failure.
+int inkExportClear(inkExportWriter_t *w);
+
+// Ends the open path, writes what follows the ink and closes the file.
+// Returns 0 on success, -1 if any of it could not be written.
+int inkExportWriterClose(inkExportWriter_t *w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_EXPORT_H_ */
@@ -0,0 +1,581 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <math.h>
+#include <string.h>
+
+#include "ink_filter.h"
+#include "ink_width_grid.h"
+
+#define CONTACT_FLAGS   (CAPTURE_FLAG_READY | CAPTURE_FLAG_TIP_SWITCH)
+
+// Set distance threshold for drawing a new segment (10*0.01mm = 0.1mm).
+#define DISTANCE_THRESHOLD_SQUARED (10*10)
+
+// Dynamic filter Proportional and Derivative controller gains
+// (includes effects of mass and sample time (K*T/mass)).
+#define KPP     1229   // 1229/8192 = 0.1500 ~0.15f
+#define KDD     4915   // 4915/8192 = 0.6000 ~0.6f
+
+// Profiles built into the SDK, the default one first. The line width grid is
+// generated for the constants of ink_width_table.h, the default ones; other
+// sample periods and pen angles are converted to its units on lookup, and
+// other scales applied to the widths it returns.
+//
+//   id          name           gains       threshold                   ms/sample      pen angle      scale
+#define FILTER_PROFILES(P) \
+    P(sync,       "sync",        KPP, KDD,   DISTANCE_THRESHOLD_SQUARED, MS_PER_SAMPLE, PEN_ANGLE_COS, SCALE) \
+    P(syncActual, "sync-actual", KPP, KDD,   DISTANCE_THRESHOLD_SQUARED, MS_PER_SAMPLE, PEN_ANGLE_COS, 1.0f) \
+    P(syncFine,   "sync-fine",   KPP, KDD,   5*5,                        MS_PER_SAMPLE, PEN_ANGLE_COS, SCALE)
+
+// The filter is written once below, taking the constants of a profile, and
+// forced inline into the entry points of every profile, where the constants
+// fold into the code just as the macros above do. Each profile gets its own
+// specialized copy and nothing is read from the profile per sample.
+#if defined(__GNUC__)
+#define SPECIALIZED static inline __attribute__((always_inline))
+#else
+#define SPECIALIZED static inline
+#endif
+
+// Segments held back by inkFilterApplySamples so their widths can be looked
+// up together.
+#define WIDTH_QUEUE_LENGTH 64
+
+typedef struct
+{
+    float   dist[WIDTH_QUEUE_LENGTH];
+    float   pressure[WIDTH_QUEUE_LENGTH];
+    uint8_t restart[WIDTH_QUEUE_LENGTH];    // A trace started before this segment.
+    size_t  count;
+    uint8_t restartPending;                 // A trace started after the last segment.
+} widthQueue_t;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function:  resetLineWidthFilter
+// Purpose:   Clears line width filter for start of a new trace.
+// Inputs:    f - filter context
+//            q - queue of segments waiting for widths, or NULL
+// Outputs:   None
+// Notes:     Queued segments still belong to the previous trace, so the reset
+//            is recorded in the queue instead.
+///////////////////////////////////////////////////////////////////////////////
+static void resetLineWidthFilter(inkFilter_t *f, widthQueue_t *q)
+{
+    if (q)
+        q->restartPending = 1;
+    else
+        f->oldLW = -1.0f;
+}
+
+// Distance btw. successive samples in digitizer units, saturated at the range
+// we have data for.
+SPECIALIZED float lineWidthDistance(inkFilterConstants_t k, float vel)
+{
+    float rate = k.msPerSample/MS_PER_SAMPLE;   // Table distances are per sample of its period.
+    float dist;
+
+    if (vel < 0)
+        dist = 75.0f*TICKS_PER_MM*k.msPerSample/1000;   // Don't know real speed if only have one point => Assume a mid-level (V2D(75.0f)).
+    else
+        dist = vel;
+
+    if (dist < inkWidthTable[0].distance*rate)
+        dist = inkWidthTable[0].distance*rate;
+    else if (dist > inkWidthTable[INK_WIDTH_TABLE_SPEEDS-1].distance*rate)
+        dist = inkWidthTable[INK_WIDTH_TABLE_SPEEDS-1].distance*rate;
+
+    return dist;
+}
+
+// Converts a distance and a pressure of the profile to the units of the line
+// width grid.
+SPECIALIZED float gridDistance(inkFilterConstants_t k, float dist)
+{
+    return dist*(MS_PER_SAMPLE/k.msPerSample);
+}
+
+SPECIALIZED float gridPressure(inkFilterConstants_t k, float pressure)
+{
+    if (k.penAngleCos == PEN_ANGLE_COS)
+        return pressure;
+    return (pressure - 0.5f)*(PEN_ANGLE_COS/k.penAngleCos) + 0.5f;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Function:  smoothLineWidth
+// Purpose:   Filters the line width looked up for a segment against the width
+//            of the previous segment of the trace.
+// Inputs:    k - constants of the profile
+//            pOldLW - line width filter state, negative at trace start
+//            dist - saturated distance btw. successive samples
+//            lw - line width from the table
+// Outputs:   Filtered line width.
+///////////////////////////////////////////////////////////////////////////////
+SPECIALIZED float smoothLineWidth(inkFilterConstants_t k, float *pOldLW, float dist, float lw)
+{
+    float maxLW = 45.0f*(k.scale/SCALE);
+    float oldLW = *pOldLW;
+
+    // Initialize filter if needed.
+    // (The max value helps eliminate ink blobs at the start of traces due to impact pressures and/or low speeds.)
+    if (oldLW < 0)
+        oldLW = (lw > maxLW ? maxLW : lw);
+
+    //  Filter A:  (LW changes too quickly for close samples and too slowly for far samples.)
+    //  lw = (lw + 7*oldLW)/8;
+
+    //  Filter B:
+    //  if (dist <= oldLW)
+    //    {
+    //      lw = 0.1*lw + 0.9*oldLW;
+    //    }
+    //  else if (dist <= 5*oldLW)
+    //    {
+    //      float alpha = 0.1 + 0.9*(dist-oldLW)/(4*oldLW);
+    //      lw = alpha*lw + (1 - alpha)*oldLW;
+    //    }
+
+    //  Filter C:  ** Seems to perform the best.
+    lw = (2*dist*lw + oldLW*oldLW)/(2*dist + oldLW);
+
+    //  Filter D:
+    //  lw = (2*dist + oldLW)/(2*dist + lw)*lw;
+
+    // Remember last linewidth for filtering.
+    *pOldLW = lw;
+
+    return lw;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Function:  computeLineWidth
+// Purpose:   Convert stylus pressure/speed into a linewidth value expressed
+//            in digitizer units.
+// Inputs:    k - constants of the profile
+//            f - filter context holding the line width filter state
+//            vel - velocity expressed in digitizer units per sample interval
+//            pressure - digitizer pressure reading
+// Outputs:   Line width.
+// Note:      If vel < 0, the stylus was lifted after a single contact point.
+///////////////////////////////////////////////////////////////////////////////
+SPECIALIZED float computeLineWidth(inkFilterConstants_t k, inkFilter_t *f, float vel, float pressure)
+{
+    float dist = lineWidthDistance(k, vel);
+    float lw = inkWidthGridLookup(gridDistance(k, dist), gridPressure(k, pressure))*(k.scale/SCALE);
+
+    return smoothLineWidth(k, &f->oldLW, dist, lw);
+}
+
+// Computes the widths of the queued segments, which were written to out, and
+// empties the queue.
+SPECIALIZED void flushLineWidths(inkFilterConstants_t k, inkFilter_t *f, widthQueue_t *q, inkSegment_t *out)
+{
+    float lw[WIDTH_QUEUE_LENGTH];
+    float dist[WIDTH_QUEUE_LENGTH];
+    float pressure[WIDTH_QUEUE_LENGTH];
+    size_t i;
+
+    if (k.msPerSample == MS_PER_SAMPLE && k.penAngleCos == PEN_ANGLE_COS)
+    {
+        inkWidthGridLookupBatch(q->dist, q->pressure, lw, q->count);
+    }
+    else
+    {
+        for (i = 0; i < q->count; i++)
+        {
+            dist[i] = gridDistance(k, q->dist[i]);
+            pressure[i] = gridPressure(k, q->pressure[i]);
+        }
+        inkWidthGridLookupBatch(dist, pressure, lw, q->count);
+    }
+
+    for (i = 0; i < q->count; i++)
+    {
+        if (q->restart[i])
+            f->oldLW = -1.0f;
+        out[i].width = smoothLineWidth(k, &f->oldLW, q->dist[i], lw[i]*(k.scale/SCALE));
+    }
+    if (q->restartPending)
+        f->oldLW = -1.0f;
+
+    q->count = 0;
+    q->restartPending = 0;
+}
+
+// Initializes a provided dynamic filter with the first point in a trace.
+static void filterSetPos(inkDynamics_t *f, const inkSample_t *pCoord)
+{
+    f->last.x = f->cur.x = (int16_t)pCoord->x;
+    f->last.y = f->cur.y = (int16_t)pCoord->y;
+    f->last.p = f->cur.p = (int16_t)pCoord->p;
+
+    f->vel.x = f->vel.y = f->vel.p = 0;
+    f->t = 0;
+}
+
+// Notifies a provided dynamic filter that a new segment has been drawn.
+static void filterSetLast(inkDynamics_t *f)
+{
+    f->last.x = f->cur.x;
+    f->last.y = f->cur.y;
+    f->last.p = f->cur.p;
+    f->t = 0;
+}
+
+// Updates dynamic filter state based on new reference coordinate.
+SPECIALIZED uint32_t filterApply(inkFilterConstants_t k, inkDynamics_t *f, const inkSample_t *pCoord)
+{
+    int32_t ax, ay, ap;
+    uint32_t dist_sq;
+
+    // Update delta time (samples) since last segment drawn (threshold met).
+    if (f->t < 255)
+        f->t++;
+
+    // Calculate 8192 (= 2^13) x acceleration.
+    ax = k.kpp*((int32_t)pCoord->x - f->cur.x) - k.kdd*f->vel.x;
+    ay = k.kpp*((int32_t)pCoord->y - f->cur.y) - k.kdd*f->vel.y;
+    ap = k.kpp*((int32_t)pCoord->p - f->cur.p) - k.kdd*f->vel.p;
+
+    // Calculate new position.
+    f->cur.x += f->vel.x;
+    f->cur.y += f->vel.y;
+    f->cur.p += f->vel.p;
+
+    // Calculate new velocity.
+    f->vel.x = (((int32_t)f->vel.x << 13) + ax) >> 13;
+    f->vel.y = (((int32_t)f->vel.y << 13) + ay) >> 13;
+    f->vel.p = (((int32_t)f->vel.p << 13) + ap) >> 13;
+
+    // Calculate squared distance of current point from "last" point.
+    dist_sq = ((f->cur.x - f->last.x)*(f->cur.x - f->last.x) + (f->cur.y - f->last.y)*(f->cur.y - f->last.y));
+
+    return dist_sq;
+}
+
+// The filter overshoots at the digitizer edges, segments stay on it.
+SPECIALIZED uint16_t clampCoord(int32_t v, int32_t max)
+{
+    return (uint16_t)(v < 0 ? 0 : (v > max ? max : v));
+}
+
+// Writes the segment from the last drawn position to the current one. Its
+// width is computed now, or later if a queue is given.
+SPECIALIZED void emitSegment(inkFilterConstants_t k, inkFilter_t *f, float vel, float pressure, inkSegment_t *out, widthQueue_t *q)
+{
+    out->x1 = clampCoord(f->currFilter.last.x, INK_DIGITIZER_MAX_X);
+    out->y1 = clampCoord(f->currFilter.last.y, INK_DIGITIZER_MAX_Y);
+    out->x2 = clampCoord(f->currFilter.cur.x, INK_DIGITIZER_MAX_X);
+    out->y2 = clampCoord(f->currFilter.cur.y, INK_DIGITIZER_MAX_Y);
+
+    if (q)
+    {
+        q->dist[q->count] = lineWidthDistance(k, vel);
+        q->pressure[q->count] = pressure;
+        q->restart[q->count] = q->restartPending;
+        q->restartPending = 0;
+        q->count++;
+    }
+    else
+    {
+        out->width = computeLineWidth(k, f, vel, pressure);
+    }
+}
+
+static void beginTrace(inkFilter_t *f, const inkSample_t *pCoord, widthQueue_t *q)
+{
+    // Have first point.
+    f->pathState = INK_ONE_PT;
+
+    // Initialize the dynamic filter.
+    filterSetPos(&f->currFilter, pCoord);
+
+    // Reset filter for line width.
+    resetLineWidthFilter(f, q);
+}
+
+SPECIALIZED size_t endTrace(inkFilterConstants_t k, inkFilter_t *f, inkSegment_t *out, widthQueue_t *q)
+{
+    inkDynamics_t *currFilter = &f->currFilter;
+    uint32_t dist_sq;
+    float velAvg, pressAvg;
+    size_t count = 0;
+    uint8_t i;
+
+    switch (f->pathState)
+    {
+        case INK_NO_PTS:
+            break;
+
+        case INK_ONE_PT:
+            // Draw the dot/period for the single point.
+            velAvg = -1.0f;
+            pressAvg = currFilter->cur.p;
+            emitSegment(k, f, velAvg, pressAvg, &out[count++], q);
+            break;
+
+        case INK_MULTIPLE_PTS:
+            // Will use fixed (current) velocity to compute line width during final convergence
+            // to prevent artificial blobbing at the end of traces (due to artificial slowdown
+            // induced by repeating final digitizer coordinate).
+            velAvg = sqrt(currFilter->vel.x*currFilter->vel.x + currFilter->vel.y*currFilter->vel.y);
+
+            // Provide filter final coordinate multiple times to converge on pen up point.
+            for (i = 0; i < 4; i++)
+            {
+                // Apply filter and get distance**2 of filtered position from last rendered position.
+                dist_sq = filterApply(k, currFilter, &f->lastCoord);
+
+                // Render new position if sufficiently far from last rendered position.
+                if (dist_sq >= k.distanceThresholdSquared)
+                {
+                    // Compute line width.
+                    pressAvg = ((float)currFilter->last.p + currFilter->cur.p)/2;
+                    emitSegment(k, f, velAvg, pressAvg, &out[count++], q);
+
+                    // Reset "last" point for filter.
+                    filterSetLast(currFilter);
+                }
+            }
+            break;
+    }
+
+    f->pathState = INK_NO_PTS;
+    return count;
+}
+
+SPECIALIZED size_t applySample(inkFilterConstants_t k, inkFilter_t *f, const inkSample_t *pCoord, inkSegment_t *out, widthQueue_t *q)
+{
+    inkDynamics_t *currFilter = &f->currFilter;
+    uint32_t dist_sq;
+    float velAvg, pressAvg;
+    size_t count = 0;
+
+    if (!inkFilterIsContact(pCoord->flags))  // No contact.
+    {
+        count = endTrace(k, f, out, q);
+    }
+    else if (f->pathState == INK_NO_PTS)
+    {
+        beginTrace(f, pCoord, q);
+    }
+    else
+    {
+        // Apply filter and get distance**2 of filtered position from last rendered position.
+        dist_sq = filterApply(k, currFilter, pCoord);
+
+        // Render new position if sufficiently far from last rendered position.
+        if (dist_sq >= k.distanceThresholdSquared)
+        {
+            f->pathState = INK_MULTIPLE_PTS;
+
+            // Compute the next trace segment.
+            velAvg = sqrt(dist_sq)/currFilter->t;
+            pressAvg = ((float)currFilter->last.p + currFilter->cur.p)/2;
+            emitSegment(k, f, velAvg, pressAvg, &out[count++], q);
+
+            // Reset "last" point for filter.
+            filterSetLast(currFilter);
+        }
+    }
+
+    // Store coordinate for finalizing trace at pen up.
+    f->lastCoord = *pCoord;
+
+    return count;
+}
+
+SPECIALIZED size_t applySamples(inkFilterConstants_t k, inkFilter_t *f, const uint16_t *x, const uint16_t *y,
+                                const uint16_t *p, const uint8_t *flags, size_t count, inkSegment_t *out,
+                                size_t capacity, uint8_t *segmentCounts, size_t *consumed)
+{
+    widthQueue_t q;
+    inkSample_t coord;
+    size_t i, n, total = 0, queued = 0;
+
+    // Segments are written as the samples are filtered but their widths are
+    // computed a queue at a time.
+    q.count = 0;
+    q.restartPending = 0;
+
+    for (i = 0; i < count && capacity - total >= INK_FILTER_MAX_SEGMENTS; i++)
+    {
+        if (q.count > WIDTH_QUEUE_LENGTH - INK_FILTER_MAX_SEGMENTS)
+        {
+            flushLineWidths(k, f, &q, out + queued);
+            queued = total;
+        }
+
+        coord.flags = flags[i];
+        coord.x = x[i];
+        coord.y = y[i];
+        coord.p = p[i];
+        n = applySample(k, f, &coord, out + total, &q);
+        if (segmentCounts)
+            segmentCounts[i] = (uint8_t)n;
+        total += n;
+    }
+    flushLineWidths(k, f, &q, out + queued);
+
+    if (consumed)
+        *consumed = i;
+    return total;
+}
+
+// Instantiates the filter for each profile.
+#define FILTER_ENTRY_POINTS(id, name, kpp, kdd, threshold, msPerSample, penAngleCos, scale) \
+    static size_t id##EndTrace(inkFilter_t *f, inkSegment_t *out) \
+    { \
+        const inkFilterConstants_t k = {kpp, kdd, threshold, msPerSample, penAngleCos, scale}; \
+        return endTrace(k, f, out, NULL); \
+    } \
+    static size_t id##Apply(inkFilter_t *f, const inkSample_t *sample, inkSegment_t *out) \
+    { \
+        const inkFilterConstants_t k = {kpp, kdd, threshold, msPerSample, penAngleCos, scale}; \
+        return applySample(k, f, sample, out, NULL); \
+    } \
+    static size_t id##ApplySamples(inkFilter_t *f, const uint16_t *x, const uint16_t *y, const uint16_t *p, \
+                                   const uint8_t *flags, size_t count, inkSegment_t *out, size_t capacity, \
+                                   uint8_t *segmentCounts, size_t *consumed) \
+    { \
+        const inkFilterConstants_t k = {kpp, kdd, threshold, msPerSample, penAngleCos, scale}; \
+        return applySamples(k, f, x, y, p, flags, count, out, capacity, segmentCounts, consumed); \
+    }
+
+#define FILTER_PROFILE(id, name, kpp, kdd, threshold, msPerSample, penAngleCos, scale) \
+    {name, {kpp, kdd, threshold, msPerSample, penAngleCos, scale}, id##EndTrace, id##Apply, id##ApplySamples},
+
+FILTER_PROFILES(FILTER_ENTRY_POINTS)
+
+const inkFilterProfile_t inkFilterProfiles[] =
+{
+    FILTER_PROFILES(FILTER_PROFILE)
+};
+
+const size_t inkFilterProfileCount = sizeof(inkFilterProfiles)/sizeof(inkFilterProfiles[0]);
+
+const inkFilterProfile_t *inkFilterProfileNamed(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < inkFilterProfileCount; i++)
+    {
+        if (strcmp(inkFilterProfiles[i].name, name) == 0)
+            return &inkFilterProfiles[i];
+    }
+    return NULL;
+}
+
+size_t inkFilterPredict(const inkFilter_t *f, float ms, inkSegment_t out[INK_FILTER_PREDICTED_SEGMENTS])
+{
+    const inkDynamics_t *d = &f->currFilter;
+    inkFilter_t ahead;
+    inkSample_t coord;
+    float samples, lw;
+    size_t count = 0;
+    int32_t i, n, x, y;
+
+    if (f->pathState == INK_NO_PTS)
+        return 0;
+
+    samples = ms/f->profile->constants.msPerSample + 0.5f;
+    n = samples < INK_FILTER_MAX_PREDICTED_SAMPLES ? (int32_t)samples : INK_FILTER_MAX_PREDICTED_SAMPLES;
+
+    // Run a copy of the filter on samples continuing from the last one at the
+    // filtered velocity, so the tail is drawn exactly as real ink would be.
+    ahead = *f;
+    coord = f->lastCoord;
+    for (i = 1; i <= n; i++)
+    {
+        x = f->lastCoord.x + i*d->vel.x;
+        y = f->lastCoord.y + i*d->vel.y;
+        if (x < 0 || x > INT16_MAX || y < 0 || y > INT16_MAX)
+            break;
+        coord.x = (uint16_t)x;
+        coord.y = (uint16_t)y;
+        count += f->profile->apply(&ahead, &coord, &out[count]);
+    }
+
+    // Then reach the tip, which lags less than the threshold behind.
+    d = &ahead.currFilter;
+    lw = count > 0 ? out[count - 1].width : ahead.oldLW;
+    if ((d->cur.x != d->last.x || d->cur.y != d->last.y) && lw > 0)
+    {
+        out[count].x1 = clampCoord(d->last.x, INK_DIGITIZER_MAX_X);
+        out[count].y1 = clampCoord(d->last.y, INK_DIGITIZER_MAX_Y);
+        out[count].x2 = clampCoord(d->cur.x, INK_DIGITIZER_MAX_X);
+        out[count].y2 = clampCoord(d->cur.y, INK_DIGITIZER_MAX_Y);
+        out[count].width = lw;
+        count++;
+    }
+
+    return count;
+}
+
+void inkFilterReset(inkFilter_t *f)
+{
+    inkFilterResetWithProfile(f, NULL);
+}
+
+void inkFilterResetWithProfile(inkFilter_t *f, const inkFilterProfile_t *profile)
+{
+    f->profile = profile ? profile : &inkFilterProfiles[0];
+    f->lastCoord.flags = 0;
+    f->lastCoord.x = f->lastCoord.y = f->lastCoord.p = 0;
+    f->pathState = INK_NO_PTS;
+    filterSetPos(&f->currFilter, &f->lastCoord);
+    resetLineWidthFilter(f, NULL);
+}
+
+void inkFilterBeginTrace(inkFilter_t *f, uint16_t x, uint16_t y, uint16_t p)
+{
+    inkSample_t coord = {CONTACT_FLAGS, x, y, p};
+
+    beginTrace(f, &coord, NULL);
+    f->lastCoord = coord;
+}
+
+size_t inkFilterEndTrace(inkFilter_t *f, inkSegment_t out[INK_FILTER_MAX_SEGMENTS])
+{
+    return f->profile->endTrace(f, out);
+}
+
+size_t inkFilterApply(inkFilter_t *f, uint16_t x, uint16_t y, uint16_t p, uint8_t flags,
+                      inkSegment_t out[INK_FILTER_MAX_SEGMENTS])
+{
+    inkSample_t coord = {flags, x, y, p};
+
+    return f->profile->apply(f, &coord, out);
+}
+
+size_t inkFilterApplySamples(inkFilter_t *f, const uint16_t *x, const uint16_t *y, const uint16_t *p,
+                             const uint8_t *flags, size_t count, inkSegment_t *out, size_t capacity,
+                             uint8_t *segmentCounts, size_t *consumed)
+{
+    return f->profile->applySamples(f, x, y, p, flags, count, out, capacity, segmentCounts, consumed);
+}
+
+size_t inkFilterApplyBatch(inkFilter_t *f, const captureBatch_t *b, inkSegment_t out[INK_FILTER_BATCH_SEGMENTS],
+                           uint8_t segmentCounts[CAPTURE_BATCH_CAPACITY])
+{
+    return f->profile->applySamples(f, b->x, b->y, b->pressure, b->flags, b->count, out, INK_FILTER_BATCH_SEGMENTS,
+                                    segmentCounts, NULL);
+}
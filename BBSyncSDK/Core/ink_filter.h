@@ -0,0 +1,190 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_FILTER_H_
+#define _INK_FILTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "capture_batch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Digitizer extent, kBBSyncCaptureMessageMaxX and kBBSyncCaptureMessageMaxY.
+#define INK_DIGITIZER_MAX_X     20280
+#define INK_DIGITIZER_MAX_Y     13942
+
+// Most segments produced by a single sample (the pen up convergence).
+#define INK_FILTER_MAX_SEGMENTS 4
+
+// Segments that always hold the output for a full capture batch.
+#define INK_FILTER_BATCH_SEGMENTS (CAPTURE_BATCH_CAPACITY*INK_FILTER_MAX_SEGMENTS)
+
+// Longest prediction in samples, about 220 ms on a Sync, and the segments
+// that always hold one.
+#define INK_FILTER_MAX_PREDICTED_SAMPLES    32
+#define INK_FILTER_PREDICTED_SEGMENTS       (INK_FILTER_MAX_PREDICTED_SAMPLES + 1)
+
+// A straight, round capped segment of a trace in digitizer units, clamped to
+// the digitizer where the filter overshoots its edges.
+typedef struct
+{
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+    float    width;
+} inkSegment_t;
+
+typedef enum {INK_NO_PTS, INK_ONE_PT, INK_MULTIPLE_PTS} inkPathState_t;
+
+typedef struct
+{
+    int16_t x;
+    int16_t y;
+    int16_t p;
+} inkCoord_t;
+
+typedef struct
+{
+    uint8_t  flags;
+    uint16_t x;
+    uint16_t y;
+    uint16_t p;
+} inkSample_t;
+
+// Dynamic (PD controller) position filter.
+typedef struct
+{
+    inkCoord_t last;                // Position the last segment was drawn to.
+    inkCoord_t cur;
+    inkCoord_t vel;
+    uint8_t    t;                   // Samples since the last segment was drawn.
+} inkDynamics_t;
+
+// Constants a filter is built for: the board it reads and the widths it
+// reports.
+typedef struct
+{
+    int32_t  kpp;                       // PD controller gains in 1/8192, including
+    int32_t  kdd;                       // the effects of mass and sample time.
+    uint32_t distanceThresholdSquared;  // Least length of a segment, squared.
+    float    msPerSample;               // Sample period of the board.
+    float    penAngleCos;               // Assumed stylus angle to the normal.
+    float    scale;                     // Reported widths against the device's.
+} inkFilterConstants_t;
+
+typedef struct inkFilterProfile_s inkFilterProfile_t;
+
+// All of the state of one trace filter. Contexts share nothing, so one can be
+// run per pen, board or thread.
+typedef struct
+{
+    const inkFilterProfile_t *profile;
+    inkSample_t    lastCoord;       // Previous sample, used to finalize at pen up.
+    inkPathState_t pathState;
+    inkDynamics_t  currFilter;
+    float          oldLW;           // Line width filter state, negative at trace start.
+} inkFilter_t;
+
+// A copy of the filter compiled for one set of constants, which fold into its
+// code as literals. A filter context runs the profile it was reset with, so
+// picking one per board costs a single indirect call per batch.
+struct inkFilterProfile_s
+{
+    const char           *name;
+    inkFilterConstants_t  constants;
+    size_t (*endTrace)(inkFilter_t *f, inkSegment_t *out);
+    size_t (*apply)(inkFilter_t *f, const inkSample_t *sample, inkSegment_t *out);
+    size_t (*applySamples)(inkFilter_t *f, const uint16_t *x, const uint16_t *y, const uint16_t *p,
+                           const uint8_t *flags, size_t count, inkSegment_t *out, size_t capacity,
+                           uint8_t *segmentCounts, size_t *consumed);
+};
+
+// Profiles built into the SDK, the default one first: "sync" for the Boogie
+// Board Sync as it always was, "sync-actual" reporting the widths the device
+// itself draws instead of sharper ones, and "sync-fine" drawing segments from
+// 0.05 mm instead of 0.1 mm for output at high resolutions. New profiles are
+// one line in ink_filter.c.
+extern const inkFilterProfile_t inkFilterProfiles[];
+extern const size_t inkFilterProfileCount;
+
+// Returns the built in profile with that name, or NULL if there is none.
+const inkFilterProfile_t *inkFilterProfileNamed(const char *name);
+
+// Returns non-zero if a sample with these flags has the stylus on the surface.
+// Traces begin and end exactly where this changes.
+static inline int inkFilterIsContact(uint8_t flags)
+{
+    return (flags & (CAPTURE_FLAG_READY | CAPTURE_FLAG_TIP_SWITCH)) == (CAPTURE_FLAG_READY | CAPTURE_FLAG_TIP_SWITCH);
+}
+
+// Initializes (or resets) a filter with the default profile, dropping any
+// trace in progress.
+void inkFilterReset(inkFilter_t *f);
+
+// Initializes (or resets) a filter with a profile, or the default profile if
+// it is NULL, dropping any trace in progress.
+void inkFilterResetWithProfile(inkFilter_t *f, const inkFilterProfile_t *profile);
+
+// Starts a trace at a contact point, dropping any trace in progress.
+void inkFilterBeginTrace(inkFilter_t *f, uint16_t x, uint16_t y, uint16_t p);
+
+// Finishes the trace in progress as if the pen was lifted after the last
+// sample. Returns the number of segments written to out.
+size_t inkFilterEndTrace(inkFilter_t *f, inkSegment_t out[INK_FILTER_MAX_SEGMENTS]);
+
+// Runs one capture sample through the filter, beginning and ending traces as
+// the pen touches and leaves the surface. Returns the number of segments
+// written to out.
+size_t inkFilterApply(inkFilter_t *f, uint16_t x, uint16_t y, uint16_t p, uint8_t flags,
+                      inkSegment_t out[INK_FILTER_MAX_SEGMENTS]);
+
+// Runs count samples held as packed arrays through the filter, writing their
+// segments one after another into out. Stops before a sample whose segments
+// might not fit in capacity. If segmentCounts is not NULL it receives the
+// number of segments each sample produced. Returns the number of segments
+// written and stores the number of samples filtered in consumed.
+size_t inkFilterApplySamples(inkFilter_t *f, const uint16_t *x, const uint16_t *y, const uint16_t *p,
+                             const uint8_t *flags, size_t count, inkSegment_t *out, size_t capacity,
+                             uint8_t *segmentCounts, size_t *consumed);
+
+// Runs a whole capture batch through the filter. Returns the number of
+// segments written to out.
+size_t inkFilterApplyBatch(inkFilter_t *f, const captureBatch_t *b, inkSegment_t out[INK_FILTER_BATCH_SEGMENTS],
+                           uint8_t segmentCounts[CAPTURE_BATCH_CAPACITY]);
+
+// Extrapolates the trace in progress ms milliseconds ahead, as the filter
+// would draw it if the stylus kept the velocity the filter tracks and its
+// pressure. The segments continue from the last one the filter produced, up
+// to where the tip would be, and are provisional: the filter is not changed,
+// and the next prediction replaces them once more samples have been filtered.
+// Returns the number of segments written to out, 0 if no trace is in
+// progress.
+size_t inkFilterPredict(const inkFilter_t *f, float ms, inkSegment_t out[INK_FILTER_PREDICTED_SEGMENTS]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_FILTER_H_ */
@@ -0,0 +1,258 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ink_index.h"
+
+#define INDEX_INITIAL_CAPACITY  256
+#define NO_BLOCK                UINT32_MAX
+
+void inkIndexInit(inkIndex_t *index)
+{
+    memset(index->cells, 0, sizeof(index->cells));
+    index->blocks = NULL;
+    index->count = 0;
+    index->capacity = 0;
+    index->segments = 0;
+    index->generation = 1;
+}
+
+void inkIndexFree(inkIndex_t *index)
+{
+    free(index->blocks);
+    inkIndexInit(index);
+}
+
+void inkIndexClear(inkIndex_t *index)
+{
+    index->count = 0;
+    index->segments = 0;
+
+    // Cells from before are stale once the generation moves on. When it wraps
+    // they could look current again, so they are really emptied then.
+    if (++index->generation == 0)
+    {
+        memset(index->cells, 0, sizeof(index->cells));
+        index->generation = 1;
+    }
+}
+
+static inline unsigned column(unsigned x)
+{
+    x >>= INK_INDEX_CELL_SHIFT;
+    return x < INK_INDEX_COLUMNS ? x : INK_INDEX_COLUMNS - 1;
+}
+
+static inline unsigned row(unsigned y)
+{
+    y >>= INK_INDEX_CELL_SHIFT;
+    return y < INK_INDEX_ROWS ? y : INK_INDEX_ROWS - 1;
+}
+
+static inkRect_t entryBounds(const inkIndexEntry_t *e)
+{
+    int half = (int)(e->radius + 1);
+    inkRect_t r;
+
+    r.minX = e->x1 < e->x2 ? e->x1 : e->x2;
+    r.minY = e->y1 < e->y2 ? e->y1 : e->y2;
+    r.maxX = e->x1 > e->x2 ? e->x1 : e->x2;
+    r.maxY = e->y1 > e->y2 ? e->y1 : e->y2;
+
+    r.minX = r.minX > half ? r.minX - half : 0;
+    r.minY = r.minY > half ? r.minY - half : 0;
+    r.maxX = r.maxX < UINT16_MAX - half ? r.maxX + half : UINT16_MAX;
+    r.maxY = r.maxY < UINT16_MAX - half ? r.maxY + half : UINT16_MAX;
+    return r;
+}
+
+// Returns a block with room in the cell, or NULL if memory ran out.
+static inkIndexBlock_t *cellBlock(inkIndex_t *index, inkIndexCell_t *cell)
+{
+    inkIndexBlock_t *blocks, *block;
+    size_t capacity;
+
+    if (cell->generation == index->generation)
+    {
+        block = &index->blocks[cell->head];
+        if (block->count < INK_INDEX_BLOCK_ENTRIES)
+            return block;
+    }
+
+    if (index->count == index->capacity)
+    {
+        capacity = index->capacity ? index->capacity*2 : INDEX_INITIAL_CAPACITY;
+        blocks = realloc(index->blocks, capacity*sizeof(inkIndexBlock_t));
+        if (blocks == NULL)
+            return NULL;
+        index->blocks = blocks;
+        index->capacity = capacity;
+    }
+
+    block = &index->blocks[index->count];
+    block->count = 0;
+    block->next = cell->generation == index->generation ? cell->head : NO_BLOCK;
+    cell->head = (uint32_t)index->count++;
+    cell->generation = index->generation;
+    return block;
+}
+
+int inkIndexInsert(inkIndex_t *index, const inkIndexEntry_t *entry)
+{
+    inkRect_t bounds = entryBounds(entry);
+    unsigned c0 = column(bounds.minX), c1 = column(bounds.maxX);
+    unsigned r0 = row(bounds.minY), r1 = row(bounds.maxY);
+    inkIndexBlock_t *block;
+    inkIndexEntry_t *e;
+    unsigned r, c;
+
+    for (r = r0; r <= r1; r++)
+    {
+        for (c = c0; c <= c1; c++)
+        {
+            block = cellBlock(index, &index->cells[r*INK_INDEX_COLUMNS + c]);
+            if (block == NULL)
+                return -1;
+            e = &block->entries[block->count++];
+            *e = *entry;
+            e->bounds = bounds;
+        }
+    }
+    index->segments++;
+    return 0;
+}
+
+int inkIndexAddSegments(inkIndex_t *index, uint32_t stroke, const inkPoint_t *points, const float *widths,
+                        uint32_t from, uint32_t to)
+{
+    inkIndexEntry_t e;
+    uint32_t i;
+
+    e.stroke = stroke;
+    for (i = from > 0 ? from : 1; i < to; i++)
+    {
+        e.x1 = points[i - 1].x;
+        e.y1 = points[i - 1].y;
+        e.x2 = points[i].x;
+        e.y2 = points[i].y;
+        e.radius = widths[i]/2;
+        e.point = i;
+        if (inkIndexInsert(index, &e) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+size_t inkIndexQueryRect(const inkIndex_t *index, const inkRect_t *rect, inkIndexVisitor_t visitor, void *context)
+{
+    unsigned c0 = column(rect->minX), c1 = column(rect->maxX);
+    unsigned r0 = row(rect->minY), r1 = row(rect->maxY);
+    const inkIndexCell_t *cell;
+    const inkIndexBlock_t *block;
+    const inkIndexEntry_t *e;
+    unsigned r, c;
+    uint32_t b, i;
+    size_t visited = 0;
+
+    for (r = r0; r <= r1; r++)
+    {
+        for (c = c0; c <= c1; c++)
+        {
+            cell = &index->cells[r*INK_INDEX_COLUMNS + c];
+            if (cell->generation != index->generation)
+                continue;
+
+            for (b = cell->head; b != NO_BLOCK; b = block->next)
+            {
+                block = &index->blocks[b];
+                for (i = 0; i < block->count; i++)
+                {
+                    e = &block->entries[i];
+                    if (e->bounds.maxX < rect->minX || e->bounds.minX > rect->maxX ||
+                        e->bounds.maxY < rect->minY || e->bounds.minY > rect->maxY)
+                    {
+                        continue;
+                    }
+
+                    // A segment in several cells is only reported by the cell
+                    // holding the corner of its overlap with the rectangle.
+                    if (column(e->bounds.minX > rect->minX ? e->bounds.minX : rect->minX) != c ||
+                        row(e->bounds.minY > rect->minY ? e->bounds.minY : rect->minY) != r)
+                    {
+                        continue;
+                    }
+
+                    visitor(context, e);
+                    visited++;
+                }
+            }
+        }
+    }
+    return visited;
+}
+
+typedef struct
+{
+    float    x;
+    float    y;
+    float    slop;
+    float    best;
+    uint32_t stroke;
+    uint32_t point;
+} hitTest_t;
+
+static void hitTestSegment(void *context, const inkIndexEntry_t *e)
+{
+    hitTest_t *h = context;
+    float d = inkSegmentDistance(e->x1, e->y1, e->x2, e->y2, h->x, h->y) - e->radius;
+
+    if (d <= h->slop && d < h->best)
+    {
+        h->best = d;
+        h->stroke = e->stroke;
+        h->point = e->point;
+    }
+}
+
+int inkIndexHitTest(const inkIndex_t *index, float x, float y, float slop, uint32_t *stroke, uint32_t *point)
+{
+    hitTest_t h = {x, y, slop, INFINITY, 0, 0};
+    inkRect_t rect;
+
+    rect.minX = x > slop ? (uint16_t)(x - slop) : 0;
+    rect.minY = y > slop ? (uint16_t)(y - slop) : 0;
+    rect.maxX = x + slop < UINT16_MAX ? (uint16_t)(x + slop + 1) : UINT16_MAX;
+    rect.maxY = y + slop < UINT16_MAX ? (uint16_t)(y + slop + 1) : UINT16_MAX;
+
+    inkIndexQueryRect(index, &rect, hitTestSegment, &h);
+    if (h.best == INFINITY)
+        return 0;
+
+    *stroke = h.stroke;
+    *point = h.point;
+    return 1;
+}
+
+size_t inkIndexMemory(const inkIndex_t *index)
+{
+    return sizeof(inkIndex_t) + index->capacity*sizeof(inkIndexBlock_t);
+}
@@ -0,0 +1,132 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_INDEX_H_
+#define _INK_INDEX_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ink_stroke.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Uniform grid of 256 unit (about 9 mm) cells over the digitizer. Segments are
+// short next to a cell, so most of them land in one or two cells.
+#define INK_INDEX_CELL_SHIFT    8
+#define INK_INDEX_COLUMNS       ((INK_DIGITIZER_MAX_X >> INK_INDEX_CELL_SHIFT) + 1)
+#define INK_INDEX_ROWS          ((INK_DIGITIZER_MAX_Y >> INK_INDEX_CELL_SHIFT) + 1)
+
+// A segment of a stroke, from points[point - 1] to points[point], with half
+// of its width and the bounds of its ink.
+typedef struct
+{
+    inkRect_t bounds;
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+    float    radius;
+    uint32_t stroke;
+    uint32_t point;
+} inkIndexEntry_t;
+
+// Cells hold their segments in chains of 512 byte blocks so that queries
+// read memory in order.
+#define INK_INDEX_BLOCK_ENTRIES 18
+
+typedef struct
+{
+    inkIndexEntry_t entries[INK_INDEX_BLOCK_ENTRIES];
+    uint32_t        count;
+    uint32_t        next;
+} inkIndexBlock_t;
+
+typedef struct
+{
+    uint32_t head;                      // Block being filled, the rest follow.
+    uint32_t generation;                // Cell is empty unless it matches the index.
+} inkIndexCell_t;
+
+// Spatial index over the segments of a page. Segments are added as strokes
+// grow and all of them are dropped at once in O(1) when the Sync is erased.
+typedef struct
+{
+    inkIndexCell_t   cells[INK_INDEX_ROWS*INK_INDEX_COLUMNS];
+    inkIndexBlock_t *blocks;
+    size_t           count;             // Blocks in use.
+    size_t           capacity;
+    size_t           segments;
+    uint32_t         generation;
+} inkIndex_t;
+
+typedef void (*inkIndexVisitor_t)(void *context, const inkIndexEntry_t *entry);
+
+void inkIndexInit(inkIndex_t *index);
+void inkIndexFree(inkIndex_t *index);
+
+// Drops every segment, keeping the memory.
+void inkIndexClear(inkIndex_t *index);
+
+// Adds a segment, to every cell its ink reaches. The entry's bounds are
+// filled in by the index. Returns 0, or -1 if memory ran out.
+int inkIndexInsert(inkIndex_t *index, const inkIndexEntry_t *entry);
+
+// Adds the segments ending at points[from] up to points[to - 1] of a stroke
+// with the given points and widths. Returns 0, or -1 if memory ran out.
+int inkIndexAddSegments(inkIndex_t *index, uint32_t stroke, const inkPoint_t *points, const float *widths,
+                        uint32_t from, uint32_t to);
+
+// Visits every segment whose ink bounds intersect the inclusive rectangle,
+// each once and in no particular order. Returns the number visited.
+size_t inkIndexQueryRect(const inkIndex_t *index, const inkRect_t *rect, inkIndexVisitor_t visitor, void *context);
+
+// Finds the segment whose ink passes closest to (x, y), if any passes within
+// slop. Returns 1 and fills in stroke and point, or 0.
+int inkIndexHitTest(const inkIndex_t *index, float x, float y, float slop, uint32_t *stroke, uint32_t *point);
+
+// Bytes of memory held by the index.
+size_t inkIndexMemory(const inkIndex_t *index);
+
+// Distance from (x, y) to the segment from (x1, y1) to (x2, y2).
+static inline float inkSegmentDistance(float x1, float y1, float x2, float y2, float x, float y)
+{
+    float dx = x2 - x1, dy = y2 - y1;
+    float px = x - x1, py = y - y1;
+    float lengthSquared = dx*dx + dy*dy, t = 0.0f;
+
+    if (lengthSquared > 0.0f)
+    {
+        t = (px*dx + py*dy)/lengthSquared;
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    }
+    px -= t*dx;
+    py -= t*dy;
+    return sqrtf(px*px + py*py);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_INDEX_H_ */
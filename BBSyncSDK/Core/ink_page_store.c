@@ -0,0 +1,302 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ink_archive.h"
+#include "ink_page_store.h"
+
+#define PAGES_INITIAL_CAPACITY  16
+
+static void resetBuilding(inkPageStore_t *store)
+{
+    store->building.length = 0;
+    store->building.strokes = 0;
+    store->building.points = 0;
+    store->building.bounds.minX = store->building.bounds.minY = UINT16_MAX;
+    store->building.bounds.maxX = store->building.bounds.maxY = 0;
+}
+
+int inkPageStoreInit(inkPageStore_t *store, const char *spillPath, size_t budget)
+{
+    memset(store, 0, sizeof(*store));
+    store->budget = budget;
+    store->fd = -1;
+    resetBuilding(store);
+    if (spillPath)
+    {
+        store->spillPath = strdup(spillPath);
+        if (store->spillPath == NULL)
+            return -1;
+    }
+    return 0;
+}
+
+void inkPageStoreFree(inkPageStore_t *store)
+{
+    size_t i;
+
+    for (i = 0; i < store->count; i++)
+        free(store->pages[i].bytes);
+    free(store->pages);
+    free(store->building.bytes);
+    if (store->fd >= 0)
+    {
+        close(store->fd);
+        unlink(store->spillPath);
+    }
+    free(store->spillPath);
+    memset(store, 0, sizeof(*store));
+    store->fd = -1;
+}
+
+int inkPageStoreAddStroke(inkPageStore_t *store, const inkStroke_t *s)
+{
+    inkStoredPage_t *b = &store->building;
+    size_t needed = b->length + INK_ARCHIVE_STROKE_MAX_LENGTH(s->count), capacity;
+    inkRect_t r;
+    uint8_t *bytes;
+
+    if (s->count == 0)
+        return 0;
+    if (needed > store->buildingCapacity)
+    {
+        capacity = store->buildingCapacity ? store->buildingCapacity : 4096;
+        while (capacity < needed)
+            capacity *= 2;
+        bytes = realloc(b->bytes, capacity);
+        if (bytes == NULL)
+            return -1;
+        b->bytes = bytes;
+        store->buildingCapacity = capacity;
+    }
+
+    b->length += inkArchiveEncodeStroke(s, b->bytes + b->length);
+    b->strokes++;
+    b->points += s->count;
+    r = inkStrokeInkBounds(s);
+    if (r.minX < b->bounds.minX)
+        b->bounds.minX = r.minX;
+    if (r.minY < b->bounds.minY)
+        b->bounds.minY = r.minY;
+    if (r.maxX > b->bounds.maxX)
+        b->bounds.maxX = r.maxX;
+    if (r.maxY > b->bounds.maxY)
+        b->bounds.maxY = r.maxY;
+    return 0;
+}
+
+// Writes the oldest pages in memory to the spill file until the rest fit the
+// budget.
+static int spill(inkPageStore_t *store)
+{
+    inkStoredPage_t *p;
+    ssize_t n;
+    size_t done;
+
+    if (store->spillPath == NULL)
+        return 0;
+    while (store->resident > store->budget && store->spilled < store->count)
+    {
+        if (store->fd < 0)
+        {
+            store->fd = open(store->spillPath, O_RDWR | O_CREAT | O_TRUNC, 0600);
+            if (store->fd < 0)
+                return -1;
+        }
+
+        p = &store->pages[store->spilled];
+        for (done = 0; done < p->length; done += n)
+        {
+            n = pwrite(store->fd, p->bytes + done, p->length - done, (off_t)(store->spillLength + done));
+            if (n <= 0)
+                return -1;
+        }
+        p->offset = store->spillLength;
+        store->spillLength += p->length;
+        store->resident -= p->length;
+        free(p->bytes);
+        p->bytes = NULL;
+        store->spilled++;
+    }
+    return 0;
+}
+
+int inkPageStoreEndPage(inkPageStore_t *store, int reason)
+{
+    inkStoredPage_t *pages, *p;
+    size_t capacity;
+
+    if (store->count == store->capacity)
+    {
+        capacity = store->capacity ? store->capacity*2 : PAGES_INITIAL_CAPACITY;
+        pages = realloc(store->pages, capacity*sizeof(inkStoredPage_t));
+        if (pages == NULL)
+            return -1;
+        store->pages = pages;
+        store->capacity = capacity;
+    }
+
+    // The page keeps just its bytes, the building buffer is reused.
+    p = &store->pages[store->count];
+    *p = store->building;
+    p->reason = reason;
+    p->offset = 0;
+    p->bytes = malloc(p->length ? p->length : 1);
+    if (p->bytes == NULL)
+        return -1;
+    memcpy(p->bytes, store->building.bytes, p->length);
+    store->count++;
+    store->resident += p->length;
+    resetBuilding(store);
+    return spill(store);
+}
+
+int inkPageStoreAddPage(inkPageStore_t *store, const inkPage_t *page, int reason)
+{
+    size_t i, finished = page->open ? page->count - 1 : page->count;
+
+    for (i = 0; i < finished; i++)
+    {
+        if (inkPageStoreAddStroke(store, &page->strokes[i]) != 0)
+            return -1;
+    }
+    return inkPageStoreEndPage(store, reason);
+}
+
+// Copies samples from up to to of a batch.
+static void copyRun(const captureBatch_t *b, size_t from, size_t to, captureBatch_t *run)
+{
+    run->count = to - from;
+    memcpy(run->x, b->x + from, run->count*sizeof(run->x[0]));
+    memcpy(run->y, b->y + from, run->count*sizeof(run->y[0]));
+    memcpy(run->pressure, b->pressure + from, run->count*sizeof(run->pressure[0]));
+    memcpy(run->flags, b->flags + from, run->count*sizeof(run->flags[0]));
+    memcpy(run->reportId, b->reportId + from, run->count*sizeof(run->reportId[0]));
+    memcpy(run->timestamp, b->timestamp + from, run->count*sizeof(run->timestamp[0]));
+    run->decoded = b->decoded;
+}
+
+int inkPageStoreAppendBatch(inkPageStore_t *store, inkPage_t *page, inkFilter_t *f, const captureBatch_t *b)
+{
+    static const uint8_t boundaries = CAPTURE_FLAG_SAVE | CAPTURE_FLAG_ERASE;
+    captureBatch_t run;
+    size_t start = 0, i;
+    uint8_t flags;
+    int result = 0;
+
+    for (i = 0; i < b->count; i++)
+    {
+        flags = b->flags[i];
+        if (!(flags & boundaries))
+            continue;
+
+        // Up to and including the sample, without letting it clear the page
+        // before it is stored.
+        copyRun(b, start, i + 1, &run);
+        run.flags[run.count - 1] &= ~CAPTURE_FLAG_ERASE;
+        if (inkPageAppendBatch(page, f, &run) != 0)
+            result = -1;
+        start = i + 1;
+
+        if (flags & CAPTURE_FLAG_SAVE)
+        {
+            if (inkPageStoreAddPage(store, page, INK_PAGE_SAVED) != 0)
+                result = -1;
+            store->saved = (uint32_t)page->count;
+        }
+        if (flags & CAPTURE_FLAG_ERASE)
+        {
+            if (page->count > store->saved && inkPageStoreAddPage(store, page, INK_PAGE_ERASED) != 0)
+                result = -1;
+            inkPageClear(page);
+            store->saved = 0;
+        }
+    }
+
+    if (start == 0)
+        return inkPageAppendBatch(page, f, b);
+    if (start < b->count)
+    {
+        copyRun(b, start, b->count, &run);
+        if (inkPageAppendBatch(page, f, &run) != 0)
+            result = -1;
+    }
+    return result;
+}
+
+int inkPageStoreSetBudget(inkPageStore_t *store, size_t budget)
+{
+    store->budget = budget;
+    return spill(store);
+}
+
+int inkPageStoreLoad(const inkPageStore_t *store, size_t index, inkPage_t *page)
+{
+    const inkStoredPage_t *p;
+    inkArchiveStroke_t stroke;
+    const uint8_t *next, *end;
+    uint8_t *bytes = NULL;
+    inkStroke_t *s;
+    ssize_t n;
+    size_t done;
+    int result = 0;
+
+    inkPageClear(page);
+    if (index >= store->count)
+        return -1;
+    p = &store->pages[index];
+
+    if (p->bytes == NULL)
+    {
+        bytes = malloc(p->length ? p->length : 1);
+        if (bytes == NULL)
+            return -1;
+        for (done = 0; done < p->length; done += n)
+        {
+            n = pread(store->fd, bytes + done, p->length - done, (off_t)(p->offset + done));
+            if (n <= 0)
+            {
+                free(bytes);
+                return -1;
+            }
+        }
+    }
+
+    next = bytes ? bytes : p->bytes;
+    end = next + p->length;
+    while (next < end && result == 0)
+    {
+        if (!inkArchiveReadStroke(&next, end, &stroke) || (s = inkPageBeginStroke(page)) == NULL ||
+            inkArchiveDecodeStroke(&stroke, s) != 0)
+            result = -1;
+    }
+    inkPageEndStroke(page);
+    free(bytes);
+    return result;
+}
+
+size_t inkPageStoreMemory(const inkPageStore_t *store)
+{
+    return store->resident + store->capacity*sizeof(inkStoredPage_t) + store->buildingCapacity;
+}
@@ -0,0 +1,109 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_PAGE_STORE_H_
+#define _INK_PAGE_STORE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "capture_batch.h"
+#include "ink_filter.h"
+#include "ink_stroke.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Why a page was stored. The Sync keeps the ink on screen when it saves, so a
+// saved page is stored again on erase only if ink was added after the save.
+#define INK_PAGE_SAVED      1
+#define INK_PAGE_ERASED     2
+
+// A page of the session, its strokes encoded as in an archive stroke chunk.
+typedef struct
+{
+    uint8_t  *bytes;                    // NULL once spilled.
+    size_t    length;
+    uint64_t  offset;                   // In the spill file, once spilled.
+    uint32_t  strokes;
+    uint64_t  points;
+    inkRect_t bounds;                   // Ink bounds of the strokes.
+    int       reason;
+} inkStoredPage_t;
+
+// Every page of a session in bounded memory. Pages are encoded as they are
+// stored, at about half the size of their strokes, and once they take more
+// than the budget the oldest ones are written to a spill file and loaded from
+// it when asked for.
+typedef struct
+{
+    inkStoredPage_t *pages;
+    size_t           count;
+    size_t           capacity;
+    size_t           budget;            // Bytes of encoded pages kept in memory.
+    size_t           resident;          // Bytes of encoded pages in memory.
+    size_t           spilled;           // Pages in the spill file, the oldest ones.
+    char            *spillPath;
+    int              fd;
+    uint64_t         spillLength;
+    inkStoredPage_t  building;          // Page being stored.
+    size_t           buildingCapacity;
+    uint32_t         saved;             // Strokes of the page on screen stored by a save.
+} inkPageStore_t;
+
+// Pages are spilled to a file at spillPath, created when first needed and
+// removed by inkPageStoreFree. With a NULL spillPath they all stay in memory.
+// Returns 0, or -1 if memory ran out.
+int inkPageStoreInit(inkPageStore_t *store, const char *spillPath, size_t budget);
+void inkPageStoreFree(inkPageStore_t *store);
+
+// Adds a stroke to the page being stored. Returns 0, or -1 if memory ran out.
+int inkPageStoreAddStroke(inkPageStore_t *store, const inkStroke_t *s);
+
+// Stores the page built so far, spilling the oldest pages past the budget.
+// Returns 0, or -1 if memory ran out or the spill file could not be written,
+// in which case pages stay in memory.
+int inkPageStoreEndPage(inkPageStore_t *store, int reason);
+
+// Stores the finished strokes of a page.
+int inkPageStoreAddPage(inkPageStore_t *store, const inkPage_t *page, int reason);
+
+// Appends a batch to a page like inkPageAppendBatch, storing the page where
+// the Sync saves it or erases it.
+int inkPageStoreAppendBatch(inkPageStore_t *store, inkPage_t *page, inkFilter_t *f, const captureBatch_t *b);
+
+// Changes the budget, spilling pages at once if it shrank. Returns 0, or -1 if
+// the spill file could not be written.
+int inkPageStoreSetBudget(inkPageStore_t *store, size_t budget);
+
+// Decodes a stored page into page, replacing what it held, from memory or from
+// the spill file. Returns 0, or -1 if memory ran out or the page could not be
+// read.
+int inkPageStoreLoad(const inkPageStore_t *store, size_t index, inkPage_t *page);
+
+// Bytes of memory held by the store.
+size_t inkPageStoreMemory(const inkPageStore_t *store);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_PAGE_STORE_H_ */
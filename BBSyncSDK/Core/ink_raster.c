@@ -0,0 +1,311 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ink_raster.h"
+#include "ink_width_table.h"
+
+#define MM_PER_INCH             25.4f
+#define TILE_BYTES              (INK_RASTER_TILE_SIZE*INK_RASTER_TILE_SIZE)
+
+int inkCanvasInit(inkCanvas_t *c, float dpi)
+{
+    size_t count;
+
+    c->scale = dpi/MM_PER_INCH/TICKS_PER_MM;
+    c->width = (unsigned)ceilf((INK_DIGITIZER_MAX_X + 1)*c->scale);
+    c->height = (unsigned)ceilf((INK_DIGITIZER_MAX_Y + 1)*c->scale);
+    c->columns = (c->width + INK_RASTER_TILE_SIZE - 1) >> INK_RASTER_TILE_SHIFT;
+    c->rows = (c->height + INK_RASTER_TILE_SIZE - 1) >> INK_RASTER_TILE_SHIFT;
+    c->dirtyCount = 0;
+
+    count = (size_t)c->columns*c->rows;
+    c->tiles = calloc(count, sizeof(uint8_t *));
+    c->dirty = calloc(count, sizeof(uint8_t));
+    c->dirtyList = malloc(count*sizeof(uint32_t));
+    if (c->tiles == NULL || c->dirty == NULL || c->dirtyList == NULL)
+    {
+        inkCanvasFree(c);
+        return -1;
+    }
+    return 0;
+}
+
+void inkCanvasFree(inkCanvas_t *c)
+{
+    size_t i;
+
+    if (c->tiles != NULL)
+    {
+        for (i = 0; i < (size_t)c->columns*c->rows; i++)
+            free(c->tiles[i]);
+    }
+    free(c->tiles);
+    free(c->dirty);
+    free(c->dirtyList);
+    c->tiles = NULL;
+    c->dirty = NULL;
+    c->dirtyList = NULL;
+    c->dirtyCount = 0;
+}
+
+static inline void markDirty(inkCanvas_t *c, uint32_t tile)
+{
+    if (!c->dirty[tile])
+    {
+        c->dirty[tile] = 1;
+        c->dirtyList[c->dirtyCount++] = tile;
+    }
+}
+
+void inkCanvasClear(inkCanvas_t *c)
+{
+    uint32_t i;
+
+    // Tiles stay allocated, the next page is likely to be inked in the same
+    // places.
+    for (i = 0; i < c->columns*c->rows; i++)
+    {
+        if (c->tiles[i] != NULL)
+        {
+            memset(c->tiles[i], 0, TILE_BYTES);
+            markDirty(c, i);
+        }
+    }
+}
+
+// Narrows [*lo, *hi] to the x where lo <= k*x + m <= hi.
+static inline void clipLinear(float k, float m, float lo, float hi, float *spanLo, float *spanHi)
+{
+    float x1, x2;
+
+    if (k == 0.0f)
+    {
+        if (m < lo || m > hi)
+            *spanHi = -INFINITY;
+        return;
+    }
+
+    x1 = (lo - m)/k;
+    x2 = (hi - m)/k;
+    if (x1 > x2)
+    {
+        float t = x1;
+        x1 = x2;
+        x2 = t;
+    }
+    *spanLo = x1 > *spanLo ? x1 : *spanLo;
+    *spanHi = x2 < *spanHi ? x2 : *spanHi;
+}
+
+// Widens [*lo, *hi] by the chord of a circle of radius squared rr at height y
+// above its center cx.
+static inline void addChord(float cx, float y, float rr, float *lo, float *hi)
+{
+    float h = rr - y*y;
+
+    if (h > 0.0f)
+    {
+        h = sqrtf(h);
+        *lo = cx - h < *lo ? cx - h : *lo;
+        *hi = cx + h > *hi ? cx + h : *hi;
+    }
+}
+
+// Coverage of the pixels of one tile by a capsule from a to a + d, in pixels
+// relative to the tile. Pixel centers are at half pixels. A capsule is convex,
+// so each row of pixels only needs testing where it crosses the capsule.
+static void fillCapsule(uint8_t *tile, int x0, int y0, int x1, int y1,
+                        float ax, float ay, float dx, float dy, float inverseLengthSquared, float r)
+{
+    float outer = (r + 0.5f)*(r + 0.5f);
+    float length = inverseLengthSquared > 0.0f ? 1.0f/sqrtf(inverseLengthSquared) : 0.0f;
+    float px, py, t, ex, ey, coverage, lo, hi, bandLo, bandHi;
+    uint8_t *row, value;
+    int x, y, from, to;
+
+    for (y = y0; y <= y1; y++)
+    {
+        row = tile + (y << INK_RASTER_TILE_SHIFT);
+        py = y + 0.5f - ay;
+
+        // Where the row crosses the end circles and the band between them.
+        lo = INFINITY;
+        hi = -INFINITY;
+        addChord(0.0f, py, outer, &lo, &hi);
+        addChord(dx, py - dy, outer, &lo, &hi);
+        if (length > 0.0f)
+        {
+            bandLo = -INFINITY;
+            bandHi = INFINITY;
+            clipLinear(dy, -py*dx, -(r + 0.5f)*length, (r + 0.5f)*length, &bandLo, &bandHi);
+            clipLinear(dx, py*dy, 0.0f, length*length, &bandLo, &bandHi);
+            if (bandLo <= bandHi)
+            {
+                lo = bandLo < lo ? bandLo : lo;
+                hi = bandHi > hi ? bandHi : hi;
+            }
+        }
+        if (lo > hi)
+            continue;
+
+        from = (int)floorf(lo + ax - 0.5f);
+        to = (int)ceilf(hi + ax - 0.5f);
+        from = from > x0 ? from : x0;
+        to = to < x1 ? to : x1;
+
+        // Branch free so that the compiler can vectorize it; coverage clamps
+        // to 1 inside the rim and to 0 outside the ink.
+        for (x = from; x <= to; x++)
+        {
+            px = x + 0.5f - ax;
+            t = (px*dx + py*dy)*inverseLengthSquared;
+            t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+            ex = px - t*dx;
+            ey = py - t*dy;
+            coverage = r + 0.5f - sqrtf(ex*ex + ey*ey);
+            coverage = coverage < 0.0f ? 0.0f : (coverage > 1.0f ? 1.0f : coverage);
+            value = (uint8_t)(coverage*255.0f + 0.5f);
+            row[x] = value > row[x] ? value : row[x];
+        }
+    }
+}
+
+int inkCanvasDrawSegment(inkCanvas_t *c, float x1, float y1, float x2, float y2, float width)
+{
+    float ax = x1*c->scale, ay = y1*c->scale, bx = x2*c->scale, by = y2*c->scale;
+    float r = width*c->scale/2, dx = bx - ax, dy = by - ay;
+    float lengthSquared = dx*dx + dy*dy, inverseLengthSquared = lengthSquared > 0.0f ? 1.0f/lengthSquared : 0.0f;
+    int minX, minY, maxX, maxY, tx, ty, tx0, ty0, tx1, ty1, ox, oy;
+    uint32_t tile;
+
+    // Pixels any part of which the ink can reach.
+    minX = (int)floorf((ax < bx ? ax : bx) - r - 0.5f);
+    minY = (int)floorf((ay < by ? ay : by) - r - 0.5f);
+    maxX = (int)floorf((ax > bx ? ax : bx) + r + 0.5f);
+    maxY = (int)floorf((ay > by ? ay : by) + r + 0.5f);
+    minX = minX > 0 ? minX : 0;
+    minY = minY > 0 ? minY : 0;
+    maxX = maxX < (int)c->width - 1 ? maxX : (int)c->width - 1;
+    maxY = maxY < (int)c->height - 1 ? maxY : (int)c->height - 1;
+    if (minX > maxX || minY > maxY)
+        return 0;
+
+    tx0 = minX >> INK_RASTER_TILE_SHIFT;
+    ty0 = minY >> INK_RASTER_TILE_SHIFT;
+    tx1 = maxX >> INK_RASTER_TILE_SHIFT;
+    ty1 = maxY >> INK_RASTER_TILE_SHIFT;
+
+    for (ty = ty0; ty <= ty1; ty++)
+    {
+        for (tx = tx0; tx <= tx1; tx++)
+        {
+            tile = ty*c->columns + tx;
+            if (c->tiles[tile] == NULL)
+            {
+                c->tiles[tile] = calloc(TILE_BYTES, 1);
+                if (c->tiles[tile] == NULL)
+                    return -1;
+            }
+
+            ox = tx << INK_RASTER_TILE_SHIFT;
+            oy = ty << INK_RASTER_TILE_SHIFT;
+            fillCapsule(c->tiles[tile],
+                        (minX > ox ? minX : ox) - ox, (minY > oy ? minY : oy) - oy,
+                        (maxX < ox + INK_RASTER_TILE_SIZE - 1 ? maxX : ox + INK_RASTER_TILE_SIZE - 1) - ox,
+                        (maxY < oy + INK_RASTER_TILE_SIZE - 1 ? maxY : oy + INK_RASTER_TILE_SIZE - 1) - oy,
+                        ax - ox, ay - oy, dx, dy, inverseLengthSquared, r);
+            markDirty(c, tile);
+        }
+    }
+    return 0;
+}
+
+int inkCanvasDrawStroke(inkCanvas_t *c, const inkStroke_t *s, uint32_t from, uint32_t to)
+{
+    uint32_t i;
+
+    for (i = from > 0 ? from : 1; i < to; i++)
+    {
+        if (inkCanvasDrawSegment(c, s->points[i - 1].x, s->points[i - 1].y,
+                                 s->points[i].x, s->points[i].y, s->widths[i]) != 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+size_t inkCanvasTakeDirty(inkCanvas_t *c, uint32_t *tiles, size_t capacity)
+{
+    size_t i, count = c->dirtyCount < capacity ? c->dirtyCount : capacity;
+
+    // Taken from the end so the rest stay where they are.
+    for (i = 0; i < count; i++)
+    {
+        tiles[i] = c->dirtyList[--c->dirtyCount];
+        c->dirty[tiles[i]] = 0;
+    }
+    return count;
+}
+
+void inkCanvasCopyPixels(const inkCanvas_t *c, uint8_t *pixels)
+{
+    const uint8_t *tile;
+    unsigned row, column, y, rows, width;
+    uint8_t *dst;
+
+    for (row = 0; row < c->rows; row++)
+    {
+        rows = c->height - row*INK_RASTER_TILE_SIZE;
+        if (rows > INK_RASTER_TILE_SIZE)
+            rows = INK_RASTER_TILE_SIZE;
+        for (column = 0; column < c->columns; column++)
+        {
+            width = c->width - column*INK_RASTER_TILE_SIZE;
+            if (width > INK_RASTER_TILE_SIZE)
+                width = INK_RASTER_TILE_SIZE;
+            tile = inkCanvasTile(c, column, row);
+            dst = pixels + (size_t)row*INK_RASTER_TILE_SIZE*c->width + column*INK_RASTER_TILE_SIZE;
+            for (y = 0; y < rows; y++, dst += c->width)
+            {
+                if (tile != NULL)
+                    memcpy(dst, tile + y*INK_RASTER_TILE_SIZE, width);
+                else
+                    memset(dst, 0, width);
+            }
+        }
+    }
+}
+
+size_t inkCanvasMemory(const inkCanvas_t *c)
+{
+    size_t i, bytes = (size_t)c->columns*c->rows*(sizeof(uint8_t *) + sizeof(uint8_t) + sizeof(uint32_t));
+
+    for (i = 0; i < (size_t)c->columns*c->rows; i++)
+    {
+        if (c->tiles[i] != NULL)
+            bytes += TILE_BYTES;
+    }
+    return bytes;
+}
@@ -0,0 +1,92 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_RASTER_H_
+#define _INK_RASTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ink_stroke.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define INK_RASTER_TILE_SHIFT   8
+#define INK_RASTER_TILE_SIZE    (1 << INK_RASTER_TILE_SHIFT)
+
+// Grayscale page covering the digitizer, as 256x256 tiles of 8 bit ink
+// coverage with 0 as blank paper. Tiles are allocated when ink first reaches
+// them. Drawing marks the tiles it changed as dirty, so a consumer redrawing
+// the page only has to copy those, and the cost of keeping the page current
+// follows the new ink rather than the ink on the page.
+typedef struct
+{
+    uint8_t  **tiles;                   // rows*columns, NULL while blank.
+    uint8_t   *dirty;                   // Whether each tile is in dirtyList.
+    uint32_t  *dirtyList;
+    size_t     dirtyCount;
+    unsigned   width;                   // Size of the page in pixels.
+    unsigned   height;
+    unsigned   columns;
+    unsigned   rows;
+    float      scale;                   // Pixels per digitizer unit.
+} inkCanvas_t;
+
+// Creates a blank page at the given resolution in dots per inch. Returns 0, or
+// -1 if memory ran out.
+int inkCanvasInit(inkCanvas_t *c, float dpi);
+void inkCanvasFree(inkCanvas_t *c);
+
+// Blanks the page, marking the tiles that had ink as dirty.
+void inkCanvasClear(inkCanvas_t *c);
+
+// Draws a segment in digitizer units with round caps, antialiased. Ink is
+// opaque: overlapping ink keeps the highest coverage. Returns 0, or -1 if
+// memory ran out.
+int inkCanvasDrawSegment(inkCanvas_t *c, float x1, float y1, float x2, float y2, float width);
+
+// Draws the segments ending at points[from] up to points[to - 1] of a stroke.
+int inkCanvasDrawStroke(inkCanvas_t *c, const inkStroke_t *s, uint32_t from, uint32_t to);
+
+// Moves up to capacity dirty tiles, as row*columns + column, into tiles and
+// marks them clean. Returns the number moved.
+size_t inkCanvasTakeDirty(inkCanvas_t *c, uint32_t *tiles, size_t capacity);
+
+// Pixels of a tile, INK_RASTER_TILE_SIZE bytes per row, or NULL while the
+// tile is blank. Tiles on the right and bottom edges extend past the page.
+static inline const uint8_t *inkCanvasTile(const inkCanvas_t *c, unsigned column, unsigned row)
+{
+    return c->tiles[row*c->columns + column];
+}
+
+// Copies the whole page into pixels, width bytes per row and height rows,
+// e.g. to keep it as an image. Blank tiles are written as 0.
+void inkCanvasCopyPixels(const inkCanvas_t *c, uint8_t *pixels);
+
+// Bytes of memory held by the page.
+size_t inkCanvasMemory(const inkCanvas_t *c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_RASTER_H_ */
@@ -0,0 +1,619 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "capture_channel.h"
+#include "capture_recording.h"
+#include "ink_archive.h"
+#include "ink_refilter.h"
+#include "monotonic_time.h"
+
+// Decoded batches that can wait while a recording is read.
+#define DECODE_QUEUE_CAPACITY   4
+
+#define MAX_THREADS             256
+
+// Rounds of looking for work before an idle worker starts sleeping between
+// them, and how long it sleeps.
+#define IDLE_SPINS              64
+#define IDLE_SLEEP_NANOS        100000
+
+typedef enum {TASK_LOAD, TASK_RUN} taskKind_t;
+
+typedef struct
+{
+    taskKind_t            kind;
+    size_t                index;        // Of the input to load, or of the run to filter.
+    inkRefilterSession_t *session;
+} task_t;
+
+// Tasks of one worker. The owner pushes and pops at the back, thieves take
+// from the front.
+typedef struct
+{
+    pthread_mutex_t lock;
+    task_t         *tasks;
+    size_t          head;
+    size_t          tail;
+    size_t          capacity;
+} taskDeque_t;
+
+typedef struct refilterPool_s refilterPool_t;
+
+typedef struct
+{
+    refilterPool_t     *pool;
+    unsigned            id;
+    pthread_t           thread;
+    int                 started;
+    taskDeque_t         deque;
+    inkFilter_t         filter;
+    inkRefilterResult_t result;         // Counted by this worker alone.
+} worker_t;
+
+struct refilterPool_s
+{
+    const char *const          *paths;
+    const inkRefilterOptions_t *options;
+    worker_t                   *workers;
+    unsigned                    count;
+    size_t                      pending;    // Tasks queued or running.
+};
+
+static void dequeInit(taskDeque_t *d)
+{
+    pthread_mutex_init(&d->lock, NULL);
+    d->tasks = NULL;
+    d->head = d->tail = d->capacity = 0;
+}
+
+static void dequeFree(taskDeque_t *d)
+{
+    pthread_mutex_destroy(&d->lock);
+    free(d->tasks);
+}
+
+static int dequePush(taskDeque_t *d, const task_t *task)
+{
+    task_t *tasks;
+    size_t capacity;
+    int result = 0;
+
+    pthread_mutex_lock(&d->lock);
+    if (d->tail == d->capacity && d->head > 0)
+    {
+        memmove(d->tasks, d->tasks + d->head, (d->tail - d->head)*sizeof(task_t));
+        d->tail -= d->head;
+        d->head = 0;
+    }
+    if (d->tail == d->capacity)
+    {
+        capacity = d->capacity ? d->capacity*2 : 64;
+        tasks = realloc(d->tasks, capacity*sizeof(task_t));
+        if (tasks == NULL)
+        {
+            result = -1;
+            goto done;
+        }
+        d->tasks = tasks;
+        d->capacity = capacity;
+    }
+    d->tasks[d->tail++] = *task;
+done:
+    pthread_mutex_unlock(&d->lock);
+    return result;
+}
+
+static int dequePop(taskDeque_t *d, task_t *task)
+{
+    int found = 0;
+
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head)
+    {
+        *task = d->tasks[--d->tail];
+        found = 1;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+static int dequeSteal(taskDeque_t *d, task_t *task)
+{
+    int found = 0;
+
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head)
+    {
+        *task = d->tasks[d->head++];
+        found = 1;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+static void freeSession(inkRefilterSession_t *s)
+{
+    size_t i;
+
+    for (i = 0; i < s->runCount; i++)
+        inkPageFree(&s->runs[i]);
+    free(s->runs);
+    free(s->runStarts);
+    free(s->x);
+    free(s->y);
+    free(s->pressure);
+    free(s->flags);
+    free(s->reportId);
+    free(s->timestamp);
+    free(s);
+}
+
+static int growSamples(inkRefilterSession_t *s, size_t capacity)
+{
+    void *p;
+
+#define GROW(field) \
+    if ((p = realloc(s->field, capacity*sizeof(*s->field))) == NULL) \
+        return -1; \
+    s->field = p;
+
+    GROW(x);
+    GROW(y);
+    GROW(pressure);
+    GROW(flags);
+    GROW(reportId);
+    GROW(timestamp);
+#undef GROW
+
+    s->capacity = capacity;
+    return 0;
+}
+
+static int appendBatch(inkRefilterSession_t *s, const captureBatch_t *b)
+{
+    size_t capacity = s->capacity ? s->capacity : 4096;
+
+    while (capacity < s->count + b->count)
+        capacity *= 2;
+    if (capacity != s->capacity && growSamples(s, capacity) != 0)
+        return -1;
+
+    memcpy(s->x + s->count, b->x, b->count*sizeof(uint16_t));
+    memcpy(s->y + s->count, b->y, b->count*sizeof(uint16_t));
+    memcpy(s->pressure + s->count, b->pressure, b->count*sizeof(uint16_t));
+    memcpy(s->flags + s->count, b->flags, b->count);
+    memcpy(s->reportId + s->count, b->reportId, b->count);
+    memcpy(s->timestamp + s->count, b->timestamp, b->count*sizeof(uint64_t));
+    s->count += b->count;
+    return 0;
+}
+
+// Decodes a recording the way a live session would, stamping the samples
+// with the time their bytes were recorded at.
+static int readRecording(inkRefilterSession_t *s, captureRecording_t *rec)
+{
+    captureChannel_t channel;
+    captureBatch_t batch;
+    const uint8_t *bytes;
+    size_t length, consumed;
+    uint64_t micros;
+    int result = 0;
+
+    if (captureChannelInit(&channel, DECODE_QUEUE_CAPACITY, NULL, NULL) != 0)
+        return -1;
+
+    while (captureRecordingNext(rec, &bytes, &length, &micros))
+    {
+        do
+        {
+            consumed = captureChannelProduce(&channel, bytes, length, micros*1000);
+            bytes += consumed;
+            length -= consumed;
+
+            captureChannelBeginDrain(&channel);
+            while (captureChannelConsume(&channel, &batch))
+            {
+                if (appendBatch(s, &batch) != 0)
+                    result = -1;
+            }
+        } while (captureChannelEndDrain(&channel) || length > 0);
+    }
+
+    captureChannelFree(&channel);
+    return result;
+}
+
+static int readArchiveSamples(inkRefilterSession_t *s, const inkArchive_t *a)
+{
+    inkArchiveCursor_t c;
+    captureBatch_t batch;
+
+    inkArchiveCursorInit(&c, a);
+    while (inkArchiveNextSamples(&c, &batch) > 0)
+    {
+        if (appendBatch(s, &batch) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+static int readSession(inkRefilterSession_t *s)
+{
+    captureRecording_t rec;
+    inkArchive_t archive;
+    int result;
+
+    if (captureRecordingOpen(&rec, s->path) == 0)
+    {
+        result = readRecording(s, &rec);
+        captureRecordingClose(&rec);
+        return result;
+    }
+    if (inkArchiveOpen(&archive, s->path) == 0)
+    {
+        result = readArchiveSamples(s, &archive);
+        inkArchiveClose(&archive);
+        return result;
+    }
+    return -1;
+}
+
+// Cuts the session into runs of at least INK_REFILTER_RUN_SAMPLES samples,
+// each starting after a sample with the stylus up.
+static int cutRuns(inkRefilterSession_t *s)
+{
+    size_t i, start = 0, count = 0;
+
+    s->runStarts = malloc((s->count/INK_REFILTER_RUN_SAMPLES + 1)*sizeof(size_t));
+    if (s->runStarts == NULL)
+        return -1;
+
+    if (s->count > 0)
+        s->runStarts[count++] = 0;
+    for (i = 1; i < s->count; i++)
+    {
+        if (i - start >= INK_REFILTER_RUN_SAMPLES && !inkFilterIsContact(s->flags[i - 1]))
+        {
+            s->runStarts[count++] = i;
+            start = i;
+        }
+    }
+
+    s->runs = calloc(count ? count : 1, sizeof(inkPage_t));
+    if (s->runs == NULL)
+        return -1;
+    for (i = 0; i < count; i++)
+        inkPageInit(&s->runs[i]);
+    s->runCount = s->runsLeft = count;
+    return 0;
+}
+
+static void finishSession(worker_t *w, inkRefilterSession_t *s)
+{
+    const inkRefilterOptions_t *options = w->pool->options;
+    size_t i, j;
+
+    if (!s->failed && options->sink && options->sink(options->context, s) != 0)
+        __atomic_store_n(&s->failed, 1, __ATOMIC_RELAXED);
+
+    if (s->failed)
+    {
+        w->result.failed++;
+    }
+    else
+    {
+        w->result.sessions++;
+        for (i = 0; i < s->runCount; i++)
+        {
+            w->result.strokes += s->runs[i].count;
+            for (j = 0; j < s->runs[i].count; j++)
+                w->result.points += s->runs[i].strokes[j].count;
+        }
+    }
+    freeSession(s);
+}
+
+static void loadSession(worker_t *w, size_t index)
+{
+    refilterPool_t *pool = w->pool;
+    inkRefilterSession_t *s;
+    task_t task;
+    size_t i;
+
+    s = calloc(1, sizeof(inkRefilterSession_t));
+    if (s == NULL)
+    {
+        w->result.failed++;
+        return;
+    }
+    s->path = pool->paths[index];
+    s->index = index;
+
+    if (readSession(s) != 0 || cutRuns(s) != 0)
+    {
+        w->result.failed++;
+        freeSession(s);
+        return;
+    }
+    w->result.samples += s->count;
+    if (s->runCount == 0)
+    {
+        finishSession(w, s);
+        return;
+    }
+
+    // Queued last to first so this worker starts on the first run, others
+    // steal from the end of the session.
+    __atomic_add_fetch(&pool->pending, s->runCount, __ATOMIC_ACQ_REL);
+    task.kind = TASK_RUN;
+    task.session = s;
+    for (i = s->runCount; i-- > 0; )
+    {
+        task.index = i;
+        if (dequePush(&w->deque, &task) != 0)
+        {
+            // The run is dropped and the session counted as failed.
+            __atomic_sub_fetch(&pool->pending, 1, __ATOMIC_ACQ_REL);
+            __atomic_store_n(&s->failed, 1, __ATOMIC_RELAXED);
+            if (__atomic_sub_fetch(&s->runsLeft, 1, __ATOMIC_ACQ_REL) == 0)
+                finishSession(w, s);
+        }
+    }
+}
+
+// Filters the samples of a run and assembles them into strokes, like
+// inkPageAppendBatch but keeping the strokes across erases.
+static void filterRun(worker_t *w, inkRefilterSession_t *s, size_t run)
+{
+    inkSegment_t segments[INK_FILTER_BATCH_SEGMENTS];
+    uint8_t segmentCounts[CAPTURE_BATCH_CAPACITY];
+    inkPage_t *page = &s->runs[run];
+    const inkSegment_t *segment;
+    size_t i, j, n, end;
+    int contact;
+
+    end = run + 1 < s->runCount ? s->runStarts[run + 1] : s->count;
+    inkFilterResetWithProfile(&w->filter, w->pool->options->profile);
+
+    for (i = s->runStarts[run]; i < end; i += n)
+    {
+        n = end - i < CAPTURE_BATCH_CAPACITY ? end - i : CAPTURE_BATCH_CAPACITY;
+        inkFilterApplySamples(&w->filter, s->x + i, s->y + i, s->pressure + i, s->flags + i, n,
+                              segments, INK_FILTER_BATCH_SEGMENTS, segmentCounts, NULL);
+
+        segment = segments;
+        for (j = 0; j < n; j++)
+        {
+            contact = inkFilterIsContact(s->flags[i + j]);
+            if (contact && !page->open && inkPageBeginStroke(page) == NULL)
+                __atomic_store_n(&s->failed, 1, __ATOMIC_RELAXED);
+            if (segmentCounts[j] > 0 && page->open &&
+                inkStrokeAppendSegments(&page->strokes[page->count - 1], segment, segmentCounts[j]) != 0)
+                __atomic_store_n(&s->failed, 1, __ATOMIC_RELAXED);
+            segment += segmentCounts[j];
+            if (!contact)
+                inkPageEndStroke(page);
+        }
+    }
+    inkPageEndStroke(page);
+
+    w->result.runs++;
+    if (__atomic_sub_fetch(&s->runsLeft, 1, __ATOMIC_ACQ_REL) == 0)
+        finishSession(w, s);
+}
+
+static int stealTask(worker_t *w, task_t *task)
+{
+    refilterPool_t *pool = w->pool;
+    unsigned i;
+
+    for (i = 1; i < pool->count; i++)
+    {
+        if (dequeSteal(&pool->workers[(w->id + i) % pool->count].deque, task))
+        {
+            w->result.steals++;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void *workerMain(void *arg)
+{
+    worker_t *w = arg;
+    refilterPool_t *pool = w->pool;
+    struct timespec idle = {0, IDLE_SLEEP_NANOS};
+    unsigned spins = 0;
+    task_t task;
+
+    for (;;)
+    {
+        if (!dequePop(&w->deque, &task) && !stealTask(w, &task))
+        {
+            // Work may still be queued by a worker that is loading a session.
+            if (__atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE) == 0)
+                break;
+            if (++spins < IDLE_SPINS)
+                sched_yield();
+            else
+                nanosleep(&idle, NULL);
+            continue;
+        }
+        spins = 0;
+
+        if (task.kind == TASK_LOAD)
+            loadSession(w, task.index);
+        else
+            filterRun(w, task.session, task.index);
+        __atomic_sub_fetch(&pool->pending, 1, __ATOMIC_ACQ_REL);
+    }
+    return NULL;
+}
+
+int inkRefilterRun(const char *const *paths, size_t count, const inkRefilterOptions_t *options,
+                   inkRefilterResult_t *result)
+{
+    refilterPool_t pool;
+    uint64_t start = monotonicTimeNanos();
+    long online;
+    worker_t *w;
+    task_t task;
+    size_t i;
+    unsigned n;
+
+    n = options->threads;
+    if (n == 0)
+    {
+        online = sysconf(_SC_NPROCESSORS_ONLN);
+        n = online > 0 ? (unsigned)online : 1;
+    }
+    if (n > MAX_THREADS)
+        n = MAX_THREADS;
+
+    pool.paths = paths;
+    pool.options = options;
+    pool.count = n;
+    pool.pending = count;
+    pool.workers = calloc(n, sizeof(worker_t));
+    if (pool.workers == NULL)
+        return -1;
+    for (n = 0; n < pool.count; n++)
+    {
+        pool.workers[n].pool = &pool;
+        pool.workers[n].id = n;
+        dequeInit(&pool.workers[n].deque);
+    }
+
+    // Sessions are dealt out last to first, so every worker starts on its
+    // earliest one.
+    task.kind = TASK_LOAD;
+    task.session = NULL;
+    for (i = count; i-- > 0; )
+    {
+        task.index = i;
+        if (dequePush(&pool.workers[i % pool.count].deque, &task) != 0)
+        {
+            for (n = 0; n < pool.count; n++)
+                dequeFree(&pool.workers[n].deque);
+            free(pool.workers);
+            return -1;
+        }
+    }
+
+    // A worker that cannot be started leaves its sessions to be stolen.
+    for (n = 1; n < pool.count; n++)
+    {
+        w = &pool.workers[n];
+        w->started = pthread_create(&w->thread, NULL, workerMain, w) == 0;
+    }
+    workerMain(&pool.workers[0]);
+
+    // Every worker is done before any deque goes, others may still look in it.
+    memset(result, 0, sizeof(*result));
+    result->threads = 1;
+    for (n = 1; n < pool.count; n++)
+    {
+        w = &pool.workers[n];
+        if (w->started)
+        {
+            pthread_join(w->thread, NULL);
+            result->threads++;
+        }
+    }
+    for (n = 0; n < pool.count; n++)
+    {
+        w = &pool.workers[n];
+        result->sessions += w->result.sessions;
+        result->failed += w->result.failed;
+        result->samples += w->result.samples;
+        result->runs += w->result.runs;
+        result->strokes += w->result.strokes;
+        result->points += w->result.points;
+        result->steals += w->result.steals;
+        dequeFree(&w->deque);
+    }
+    free(pool.workers);
+
+    result->elapsedNanos = monotonicTimeNanos() - start;
+    return 0;
+}
+
+int inkRefilterWriteArchive(const inkRefilterSession_t *session, const char *path)
+{
+    inkArchiveWriter_t w;
+    captureBatch_t batch;
+    size_t i, j;
+    int result = 0;
+
+    if (inkArchiveWriterOpen(&w, path) != 0)
+        return -1;
+
+    for (i = 0; i < session->count && result == 0; i += batch.count)
+    {
+        batch.count = session->count - i < CAPTURE_BATCH_CAPACITY ? session->count - i : CAPTURE_BATCH_CAPACITY;
+        memcpy(batch.x, session->x + i, batch.count*sizeof(uint16_t));
+        memcpy(batch.y, session->y + i, batch.count*sizeof(uint16_t));
+        memcpy(batch.pressure, session->pressure + i, batch.count*sizeof(uint16_t));
+        memcpy(batch.flags, session->flags + i, batch.count);
+        memcpy(batch.reportId, session->reportId + i, batch.count);
+        memcpy(batch.timestamp, session->timestamp + i, batch.count*sizeof(uint64_t));
+        result = inkArchiveWriteSamples(&w, &batch);
+    }
+    for (i = 0; i < session->runCount && result == 0; i++)
+    {
+        for (j = 0; j < session->runs[i].count && result == 0; j++)
+            result = inkArchiveWriteStroke(&w, &session->runs[i].strokes[j]);
+    }
+
+    if (inkArchiveWriterClose(&w) != 0)
+        result = -1;
+    return result;
+}
+
+int inkRefilterWriteDocument(const inkRefilterSession_t *session, const char *path, inkExportFormat_t format)
+{
+    inkExportWriter_t w;
+    const inkStroke_t *stroke;
+    size_t i, j;
+    int result = 0;
+
+    if (inkExportWriterOpen(&w, path, format) != 0)
+        return -1;
+
+    for (i = 0; i < session->runCount && result == 0; i++)
+    {
+        for (j = 0; j < session->runs[i].count && result == 0; j++)
+        {
+            stroke = &session->runs[i].strokes[j];
+            result = inkExportWriteStroke(&w, stroke, 0, stroke->count);
+        }
+    }
+
+    if (inkExportWriterClose(&w) != 0)
+        result = -1;
+    return result;
+}
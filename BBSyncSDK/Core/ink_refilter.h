@@ -0,0 +1,119 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_REFILTER_H_
+#define _INK_REFILTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ink_export.h"
+#include "ink_filter.h"
+#include "ink_stroke.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Offline re-filtering of recorded sessions on a pool of threads, for running
+// a whole collection again after the filter or the rendering changed.
+//
+// Each session, a recording made with captureRecorderWrite or the samples of
+// an ink archive, is read into memory and cut into runs of whole traces where
+// the stylus is up. A trace starts the filter from scratch, so the runs can
+// be filtered in any order, each worker with its own filter context, and the
+// strokes are exactly those a live session would have produced. Workers take
+// their own work newest first and steal the oldest work of others when they
+// run out, so new sessions are started by idle workers and the runs of one
+// long session spread over all of them at the end. Strokes are kept across
+// erases, and a trace still open at the end of a session is kept as it
+// stands.
+
+// Samples per run, cut at the first stylus up after that many.
+#define INK_REFILTER_RUN_SAMPLES    8192
+
+// A session read into memory, with its strokes once all runs are filtered.
+// Samples are packed arrays; timestamps are nanoseconds from the first one.
+typedef struct
+{
+    const char *path;
+    size_t      index;                  // Position of path in the inputs.
+    size_t      count;                  // Samples.
+    size_t      capacity;
+    uint16_t   *x;
+    uint16_t   *y;
+    uint16_t   *pressure;
+    uint8_t    *flags;
+    uint8_t    *reportId;
+    uint64_t   *timestamp;
+    inkPage_t  *runs;                   // Strokes of each run, in order.
+    size_t     *runStarts;              // First sample of each run.
+    size_t      runCount;
+    size_t      runsLeft;               // Runs still being filtered.
+    int         failed;                 // Memory ran out filtering a run.
+} inkRefilterSession_t;
+
+// Receives every session once all of its runs are filtered, on the worker
+// that filtered the last one. Sessions arrive in any order and different
+// sessions may arrive at the same time. Returns 0, or -1 if the session could
+// not be written.
+typedef int (*inkRefilterSink_t)(void *context, const inkRefilterSession_t *session);
+
+typedef struct
+{
+    const inkFilterProfile_t *profile;  // NULL for the default.
+    unsigned                  threads;  // 0 for one per online core.
+    inkRefilterSink_t         sink;     // May be NULL to only filter.
+    void                     *context;
+} inkRefilterOptions_t;
+
+typedef struct
+{
+    uint64_t sessions;                  // Handed to the sink.
+    uint64_t failed;                    // Unreadable, out of memory or not written.
+    uint64_t samples;
+    uint64_t runs;
+    uint64_t strokes;
+    uint64_t points;
+    uint64_t steals;                    // Tasks taken from another worker.
+    unsigned threads;
+    uint64_t elapsedNanos;
+} inkRefilterResult_t;
+
+// Re-filters the files at paths, each a recording or an ink archive as told
+// by its header, and hands each session to the sink. The calling thread is
+// one of the workers. Returns 0 once every session was handed on or counted
+// as failed, -1 if memory ran out before starting.
+int inkRefilterRun(const char *const *paths, size_t count, const inkRefilterOptions_t *options,
+                   inkRefilterResult_t *result);
+
+// Writes the samples and strokes of a session to a new ink archive. Returns 0
+// on success, -1 on failure.
+int inkRefilterWriteArchive(const inkRefilterSession_t *session, const char *path);
+
+// Writes the strokes of a session to a new SVG or PDF document, every stroke
+// of every run in order. Returns 0 on success, -1 on failure.
+int inkRefilterWriteDocument(const inkRefilterSession_t *session, const char *path, inkExportFormat_t format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_REFILTER_H_ */
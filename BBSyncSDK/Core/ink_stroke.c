@@ -0,0 +1,244 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <stdlib.h>
+
+#include "ink_stroke.h"
+
+#define STROKE_INITIAL_CAPACITY 64
+#define PAGE_INITIAL_CAPACITY   16
+
+void inkStrokeInit(inkStroke_t *s)
+{
+    s->points = NULL;
+    s->widths = NULL;
+    s->capacity = 0;
+    inkStrokeReset(s);
+}
+
+void inkStrokeFree(inkStroke_t *s)
+{
+    free(s->points);
+    free(s->widths);
+    inkStrokeInit(s);
+}
+
+void inkStrokeReset(inkStroke_t *s)
+{
+    s->count = 0;
+    s->bounds.minX = s->bounds.minY = UINT16_MAX;
+    s->bounds.maxX = s->bounds.maxY = 0;
+    s->maxWidth = 0;
+}
+
+static int reserve(inkStroke_t *s, size_t count)
+{
+    inkPoint_t *points;
+    float *widths;
+    size_t capacity;
+
+    if (count <= s->capacity)
+        return 0;
+    if (count > UINT32_MAX)
+        return -1;
+
+    capacity = s->capacity ? s->capacity : STROKE_INITIAL_CAPACITY;
+    while (capacity < count)
+        capacity *= 2;
+    if (capacity > UINT32_MAX)
+        capacity = UINT32_MAX;
+
+    points = realloc(s->points, capacity*sizeof(inkPoint_t));
+    if (points == NULL)
+        return -1;
+    s->points = points;
+
+    widths = realloc(s->widths, capacity*sizeof(float));
+    if (widths == NULL)
+        return -1;
+    s->widths = widths;
+
+    s->capacity = (uint32_t)capacity;
+    return 0;
+}
+
+static inline void addPoint(inkStroke_t *s, uint16_t x, uint16_t y, float width)
+{
+    s->points[s->count].x = x;
+    s->points[s->count].y = y;
+    s->widths[s->count] = width;
+    s->count++;
+
+    if (x < s->bounds.minX)
+        s->bounds.minX = x;
+    if (x > s->bounds.maxX)
+        s->bounds.maxX = x;
+    if (y < s->bounds.minY)
+        s->bounds.minY = y;
+    if (y > s->bounds.maxY)
+        s->bounds.maxY = y;
+    if (width > s->maxWidth)
+        s->maxWidth = width;
+}
+
+int inkStrokeAppendSegments(inkStroke_t *s, const inkSegment_t *segments, size_t count)
+{
+    size_t i;
+
+    if (count == 0)
+        return 0;
+    if (reserve(s, s->count + count + 1) != 0)
+        return -1;
+
+    // Consecutive segments of a trace share their end points, so only the
+    // first one adds its start.
+    if (s->count == 0)
+        addPoint(s, segments[0].x1, segments[0].y1, segments[0].width);
+
+    for (i = 0; i < count; i++)
+        addPoint(s, segments[i].x2, segments[i].y2, segments[i].width);
+
+    return 0;
+}
+
+int inkStrokeAppendPoints(inkStroke_t *s, const inkPoint_t *points, const float *widths, size_t count)
+{
+    size_t i;
+
+    if (reserve(s, s->count + count) != 0)
+        return -1;
+    for (i = 0; i < count; i++)
+        addPoint(s, points[i].x, points[i].y, widths[i]);
+    return 0;
+}
+
+inkRect_t inkStrokeInkBounds(const inkStroke_t *s)
+{
+    inkRect_t r = s->bounds;
+    int half = (int)(s->maxWidth/2 + 1);
+
+    if (s->count == 0)
+        return r;
+
+    r.minX = r.minX > half ? r.minX - half : 0;
+    r.minY = r.minY > half ? r.minY - half : 0;
+    r.maxX = r.maxX < UINT16_MAX - half ? r.maxX + half : UINT16_MAX;
+    r.maxY = r.maxY < UINT16_MAX - half ? r.maxY + half : UINT16_MAX;
+    return r;
+}
+
+size_t inkStrokeMemory(const inkStroke_t *s)
+{
+    return s->capacity*(sizeof(inkPoint_t) + sizeof(float));
+}
+
+void inkPageInit(inkPage_t *page)
+{
+    page->strokes = NULL;
+    page->count = 0;
+    page->capacity = 0;
+    page->open = 0;
+}
+
+void inkPageFree(inkPage_t *page)
+{
+    size_t i;
+
+    for (i = 0; i < page->capacity; i++)
+        inkStrokeFree(&page->strokes[i]);
+    free(page->strokes);
+    inkPageInit(page);
+}
+
+void inkPageClear(inkPage_t *page)
+{
+    page->count = 0;
+    page->open = 0;
+}
+
+inkStroke_t *inkPageBeginStroke(inkPage_t *page)
+{
+    inkStroke_t *strokes;
+    size_t capacity, i;
+
+    inkPageEndStroke(page);
+
+    if (page->count == page->capacity)
+    {
+        capacity = page->capacity ? page->capacity*2 : PAGE_INITIAL_CAPACITY;
+        strokes = realloc(page->strokes, capacity*sizeof(inkStroke_t));
+        if (strokes == NULL)
+            return NULL;
+        for (i = page->capacity; i < capacity; i++)
+            inkStrokeInit(&strokes[i]);
+        page->strokes = strokes;
+        page->capacity = capacity;
+    }
+
+    inkStrokeReset(&page->strokes[page->count]);
+    page->open = 1;
+    return &page->strokes[page->count++];
+}
+
+void inkPageEndStroke(inkPage_t *page)
+{
+    page->open = 0;
+}
+
+int inkPageAppendBatch(inkPage_t *page, inkFilter_t *f, const captureBatch_t *b)
+{
+    inkSegment_t segments[INK_FILTER_BATCH_SEGMENTS];
+    uint8_t segmentCounts[CAPTURE_BATCH_CAPACITY];
+    const inkSegment_t *s = segments;
+    int contact, result = 0;
+    size_t i;
+
+    inkFilterApplyBatch(f, b, segments, segmentCounts);
+
+    for (i = 0; i < b->count; i++)
+    {
+        contact = inkFilterIsContact(b->flags[i]);
+
+        // The filter starts a trace on the first contact sample, the segments
+        // that finish it come with the sample after the last one.
+        if (contact && !page->open && inkPageBeginStroke(page) == NULL)
+            result = -1;
+        if (segmentCounts[i] > 0 && page->open &&
+            inkStrokeAppendSegments(&page->strokes[page->count - 1], s, segmentCounts[i]) != 0)
+            result = -1;
+        s += segmentCounts[i];
+        if (!contact)
+            inkPageEndStroke(page);
+
+        if (b->flags[i] & CAPTURE_FLAG_ERASE)
+            inkPageClear(page);
+    }
+
+    return result;
+}
+
+size_t inkPageMemory(const inkPage_t *page)
+{
+    size_t i, bytes = page->capacity*sizeof(inkStroke_t);
+
+    for (i = 0; i < page->capacity; i++)
+        bytes += inkStrokeMemory(&page->strokes[i]);
+    return bytes;
+}
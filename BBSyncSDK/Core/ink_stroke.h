@@ -0,0 +1,116 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_STROKE_H_
+#define _INK_STROKE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "capture_batch.h"
+#include "ink_filter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+} inkPoint_t;
+
+// Axis aligned rectangle in digitizer units, inclusive. Empty if minX > maxX.
+typedef struct
+{
+    uint16_t minX;
+    uint16_t minY;
+    uint16_t maxX;
+    uint16_t maxY;
+} inkRect_t;
+
+// One pen down to pen up trace as a variable width polyline. widths[i] is the
+// width of the segment ending at points[i]; widths[0] repeats widths[1] so
+// both arrays have count entries. A dot is two points, possibly equal.
+typedef struct
+{
+    inkPoint_t *points;
+    float      *widths;
+    uint32_t    count;
+    uint32_t    capacity;
+    inkRect_t   bounds;             // Bounds of the points.
+    float       maxWidth;
+} inkStroke_t;
+
+void inkStrokeInit(inkStroke_t *s);
+void inkStrokeFree(inkStroke_t *s);
+
+// Empties a stroke, keeping its memory for reuse.
+void inkStrokeReset(inkStroke_t *s);
+
+// Extends the stroke with consecutive segments of its trace. Returns 0, or -1
+// if memory ran out.
+int inkStrokeAppendSegments(inkStroke_t *s, const inkSegment_t *segments, size_t count);
+
+// Extends the stroke with points and their widths, as read back from storage.
+// Returns 0, or -1 if memory ran out.
+int inkStrokeAppendPoints(inkStroke_t *s, const inkPoint_t *points, const float *widths, size_t count);
+
+// Bounds of the stroke including half of its widest segment on every side.
+inkRect_t inkStrokeInkBounds(const inkStroke_t *s);
+
+// Bytes of memory held by the stroke's points and widths.
+size_t inkStrokeMemory(const inkStroke_t *s);
+
+// Strokes drawn on a page, in order. Clearing the page (as the Sync's erase
+// does) is O(1): stroke storage stays allocated and is reused by the strokes
+// drawn after it.
+typedef struct
+{
+    inkStroke_t *strokes;
+    size_t       count;
+    size_t       capacity;          // Strokes with storage, count and above are unused.
+    int          open;              // The last stroke is still being drawn.
+} inkPage_t;
+
+void inkPageInit(inkPage_t *page);
+void inkPageFree(inkPage_t *page);
+void inkPageClear(inkPage_t *page);
+
+// Starts a new open stroke and returns it, or NULL if memory ran out.
+inkStroke_t *inkPageBeginStroke(inkPage_t *page);
+
+// Finishes the open stroke, if any.
+void inkPageEndStroke(inkPage_t *page);
+
+// Filters a capture batch and assembles its segments into strokes, starting
+// a stroke where the stylus touches the surface, ending it where it lifts,
+// and clearing the page after a sample with CAPTURE_FLAG_ERASE. Returns 0, or
+// -1 if memory ran out.
+int inkPageAppendBatch(inkPage_t *page, inkFilter_t *f, const captureBatch_t *b);
+
+// Bytes of memory held by the page, including unused stroke storage.
+size_t inkPageMemory(const inkPage_t *page);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_STROKE_H_ */
@@ -0,0 +1,306 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "ink_tessellator.h"
+
+#define MESH_INITIAL_CAPACITY   256
+#define MIN_TOLERANCE           0.01f
+#define HALF_PI                 1.57079632679f
+
+void inkMeshInit(inkMesh_t *m, float tolerance)
+{
+    m->vertices = NULL;
+    m->capacity = 0;
+    m->tolerance = tolerance > MIN_TOLERANCE ? tolerance : MIN_TOLERANCE;
+    inkMeshReset(m);
+}
+
+void inkMeshFree(inkMesh_t *m)
+{
+    free(m->vertices);
+    inkMeshInit(m, m->tolerance);
+}
+
+void inkMeshReset(inkMesh_t *m)
+{
+    m->count = 0;
+    m->firstChanged = 0;
+    m->stableCount = 0;
+    m->points = 0;
+    m->lastPoint = 0;
+    m->r = 0.0f;
+    m->length = 0.0f;
+    m->dx = 1.0f;
+    m->dy = 0.0f;
+    m->started = 0;
+    m->hasDirection = 0;
+}
+
+size_t inkMeshMemory(const inkMesh_t *m)
+{
+    return m->capacity*sizeof(inkVertex_t);
+}
+
+static int reserve(inkMesh_t *m, size_t extra)
+{
+    inkVertex_t *vertices;
+    size_t capacity;
+
+    if (m->count + extra <= m->capacity)
+        return 0;
+
+    capacity = m->capacity ? m->capacity : MESH_INITIAL_CAPACITY;
+    while (capacity < m->count + extra)
+        capacity *= 2;
+
+    vertices = realloc(m->vertices, capacity*sizeof(inkVertex_t));
+    if (vertices == NULL)
+        return -1;
+    m->vertices = vertices;
+    m->capacity = capacity;
+    return 0;
+}
+
+// Appends a left/right pair. Space must have been reserved.
+static inline void addPair(inkMesh_t *m, float lx, float ly, float rx, float ry)
+{
+    inkVertex_t *v = m->vertices + m->count;
+
+    v[0].x = lx;
+    v[0].y = ly;
+    v[1].x = rx;
+    v[1].y = ry;
+    m->count += 2;
+}
+
+// Arc steps needed to keep a quarter circle of radius r within tolerance.
+static int quarterSteps(const inkMesh_t *m, float r)
+{
+    float step;
+
+    if (r <= m->tolerance)
+        return 1;
+
+    // The sagitta of a chord spanning step radians is r*(1 - cos(step/2)).
+    step = 2.0f*acosf(1.0f - m->tolerance/r);
+    return (int)ceilf(HALF_PI/step);
+}
+
+// Round cap behind (x, y) when walking in direction (dx, dy), ending on the
+// pair at the point. Walks both sides of the cap at once from its tip.
+static int addStartCap(inkMesh_t *m, float x, float y, float r, float dx, float dy)
+{
+    int i, steps = quarterSteps(m, r);
+    float t, c, s;
+
+    if (reserve(m, 2*(steps + 1)) != 0)
+        return -1;
+
+    for (i = 0; i <= steps; i++)
+    {
+        t = HALF_PI*i/steps;
+        c = r*cosf(t);
+        s = r*sinf(t);
+
+        // Left normal is (-dy, dx).
+        addPair(m, x - dx*c - dy*s, y - dy*c + dx*s,
+                   x - dx*c + dy*s, y - dy*c - dx*s);
+    }
+    return 0;
+}
+
+// Round cap ahead of (x, y), starting after the pair at the point.
+static int addEndCap(inkMesh_t *m, float x, float y, float r, float dx, float dy)
+{
+    int i, steps = quarterSteps(m, r);
+    float t, c, s;
+
+    if (reserve(m, 2*steps) != 0)
+        return -1;
+
+    for (i = steps - 1; i >= 0; i--)
+    {
+        t = HALF_PI*i/steps;
+        c = r*cosf(t);
+        s = r*sinf(t);
+        addPair(m, x + dx*c - dy*s, y + dy*c + dx*s,
+                   x + dx*c + dy*s, y + dy*c - dx*s);
+    }
+    return 0;
+}
+
+// Pair across the stroke at (x, y) for direction (dx, dy).
+static int addCrossing(inkMesh_t *m, float x, float y, float r, float dx, float dy)
+{
+    if (reserve(m, 2) != 0)
+        return -1;
+    addPair(m, x - dy*r, y + dx*r, x + dy*r, y - dx*r);
+    return 0;
+}
+
+// Round join at (x, y) turning from direction (dx1, dy1) to (dx2, dy2), after
+// the pair for the first direction and before the pair for the second. The
+// arc is fanned around the point on the outer side of the turn. Next to a
+// segment shorter than the radius the segments do not cover the rest of the
+// dot around the point, so the fan goes all the way round.
+static int addJoin(inkMesh_t *m, float x, float y, float r, float dx1, float dy1, float dx2, float dy2,
+                   int whole)
+{
+    float angle = atan2f(dx1*dy2 - dy1*dx2, dx1*dx2 + dy1*dy2);
+    int left = angle > 0;
+
+    if (whole)
+        angle += left ? 4*HALF_PI : -4*HALF_PI;
+    float nx, ny, ax, ay, t, c, s;
+    int i, steps;
+
+    steps = (int)ceilf(fabsf(angle)/HALF_PI*quarterSteps(m, r));
+    if (steps < 2)
+        return 0;
+    if (reserve(m, 2*(steps - 1)) != 0)
+        return -1;
+
+    if (left)
+    {
+        // Turning left, the arc runs from the right normal.
+        nx = dy1;
+        ny = -dx1;
+    }
+    else
+    {
+        nx = -dy1;
+        ny = dx1;
+    }
+
+    for (i = 1; i < steps; i++)
+    {
+        t = angle*i/steps;
+        c = cosf(t);
+        s = sinf(t);
+        ax = x + r*(nx*c - ny*s);
+        ay = y + r*(nx*s + ny*c);
+
+        if (left)
+            addPair(m, x, y, ax, ay);
+        else
+            addPair(m, ax, ay, x, y);
+    }
+    return 0;
+}
+
+// Whether the join at the last point must fan a whole dot: next to a short
+// segment, or when a segment that did not move widened the point after its
+// pair across the stroke was written.
+static inline int wholeDot(const inkMesh_t *m, const inkStroke_t *s, float length)
+{
+    return length < m->r || m->length < m->r || m->r > s->widths[m->lastPoint]/2;
+}
+
+int inkMeshUpdate(inkMesh_t *m, const inkStroke_t *s)
+{
+    const inkPoint_t *p, *last;
+    float dx, dy, length, r;
+    uint32_t i;
+
+    // A stroke that shrank is a different stroke.
+    if (s->count < m->points)
+        inkMeshReset(m);
+
+    // Drop the end cap.
+    m->count = m->stableCount;
+    m->firstChanged = m->stableCount;
+
+    for (i = m->points; i < s->count; i++)
+    {
+        p = &s->points[i];
+        r = s->widths[i]/2;
+        if (!m->started)
+        {
+            m->lastPoint = i;
+            m->r = r;
+            m->started = 1;
+            continue;
+        }
+
+        // A segment that does not move still draws a dot as wide as itself.
+        last = &s->points[m->lastPoint];
+        if (p->x == last->x && p->y == last->y)
+        {
+            if (r > m->r)
+                m->r = r;
+            continue;
+        }
+
+        dx = (float)p->x - last->x;
+        dy = (float)p->y - last->y;
+        length = sqrtf(dx*dx + dy*dy);
+        dx /= length;
+        dy /= length;
+
+        if (!m->hasDirection)
+        {
+            if (addStartCap(m, last->x, last->y, m->r, dx, dy) != 0 ||
+                (length < m->r && addJoin(m, last->x, last->y, m->r, dx, dy, dx, dy, 1) != 0))
+            {
+                return -1;
+            }
+        }
+        else if (addJoin(m, last->x, last->y, m->r, m->dx, m->dy, dx, dy, wholeDot(m, s, length)) != 0 ||
+                 addCrossing(m, last->x, last->y, m->r, dx, dy) != 0)
+        {
+            return -1;
+        }
+
+        if (addCrossing(m, p->x, p->y, r, dx, dy) != 0)
+            return -1;
+
+        m->lastPoint = i;
+        m->r = r;
+        m->length = length;
+        m->dx = dx;
+        m->dy = dy;
+        m->hasDirection = 1;
+    }
+
+    m->points = s->count;
+    m->stableCount = m->count;
+    if (!m->started)
+        return 0;
+
+    // End cap, or a whole dot if the stroke has not moved yet.
+    last = &s->points[m->lastPoint];
+    r = m->r;
+    if (!m->hasDirection)
+    {
+        m->stableCount = 0;
+        m->count = 0;
+        m->firstChanged = 0;
+        if (addStartCap(m, last->x, last->y, r, m->dx, m->dy) != 0)
+            return -1;
+    }
+    else if (wholeDot(m, s, m->length) && addJoin(m, last->x, last->y, r, m->dx, m->dy, m->dx, m->dy, 1) != 0)
+    {
+        return -1;
+    }
+    return addEndCap(m, last->x, last->y, r, m->dx, m->dy);
+}
@@ -0,0 +1,85 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_TESSELLATOR_H_
+#define _INK_TESSELLATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ink_stroke.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    float x;
+    float y;
+} inkVertex_t;
+
+// Triangle strip covering one stroke, in digitizer units, with round caps
+// and round joins. Vertices come in left/right pairs along the stroke, arcs
+// are flattened so no point of them is further than tolerance from the true
+// circle. The strip is opaque ink: some triangles overlap and some have no
+// area, so draw it without blending artifacts (opaque or with a stencil).
+//
+// The mesh follows a growing stroke. Everything up to the last point of the
+// stroke is kept between updates; only the end cap is tessellated again.
+typedef struct
+{
+    inkVertex_t *vertices;
+    size_t       count;
+    size_t       capacity;
+    size_t       firstChanged;      // First vertex changed by the last update.
+    float        tolerance;
+
+    size_t       stableCount;       // Vertices before the end cap.
+    uint32_t     points;            // Stroke points already tessellated.
+    uint32_t     lastPoint;         // Index of the last distinct stroke point.
+    float        r;                 // Widest radius drawn at the last point.
+    float        length;            // Length of the segment into the last point.
+    float        dx;                // Unit direction into the last point.
+    float        dy;
+    int          started;           // lastPoint is valid.
+    int          hasDirection;      // dx, dy are valid.
+} inkMesh_t;
+
+// Initializes an empty mesh. tolerance is in digitizer units.
+void inkMeshInit(inkMesh_t *m, float tolerance);
+void inkMeshFree(inkMesh_t *m);
+
+// Empties the mesh, keeping its memory, to tessellate another stroke.
+void inkMeshReset(inkMesh_t *m);
+
+// Brings the mesh up to date with the stroke it was built from, which may
+// only have grown since the last update. Vertices before firstChanged are
+// unchanged. Returns 0, or -1 if memory ran out.
+int inkMeshUpdate(inkMesh_t *m, const inkStroke_t *s);
+
+// Bytes of memory held by the mesh.
+size_t inkMeshMemory(const inkMesh_t *m);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_TESSELLATOR_H_ */
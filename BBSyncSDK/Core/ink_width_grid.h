@@ -0,0 +1,89 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_WIDTH_GRID_H_
+#define _INK_WIDTH_GRID_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ink_width_table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Dense, uniformly spaced resampling of the line width table, generated by
+// Tools/bbwidthgen. Rows are 1 mm/s apart, which puts every speed in the
+// table exactly on a row, and columns are 8 pressure units apart. Widths are
+// stored in digitizer units times INK_WIDTH_GRID_SCALE.
+#define INK_WIDTH_GRID_ROWS             180
+#define INK_WIDTH_GRID_COLUMNS          110
+#define INK_WIDTH_GRID_DISTANCE_MIN     V2D(1.0f)
+#define INK_WIDTH_GRID_DISTANCE_STEP    V2D(1.0f)
+#define INK_WIDTH_GRID_PRESSURE_MIN     15.0f           // M2P(10.0f) as stored in the table.
+#define INK_WIDTH_GRID_PRESSURE_STEP    8.0f
+#define INK_WIDTH_GRID_SCALE            256.0f
+
+// Largest difference, in digitizer units, between a grid lookup and the
+// table anywhere in its range. Checked by bbwidthgen -c.
+#define INK_WIDTH_GRID_TOLERANCE        0.15f
+
+extern const uint16_t inkWidthGrid[INK_WIDTH_GRID_ROWS][INK_WIDTH_GRID_COLUMNS];
+
+// Returns the line width for a distance between samples and a pressure, both
+// saturated at the range of the table. Bilinear between the four surrounding
+// grid points, with no searching and no divisions.
+static inline float inkWidthGridLookup(float dist, float pressure)
+{
+    const uint16_t *g;
+    float r, c, top, bottom;
+    int ir, ic;
+
+    r = (dist - INK_WIDTH_GRID_DISTANCE_MIN)*(1.0f/INK_WIDTH_GRID_DISTANCE_STEP);
+    c = (pressure - INK_WIDTH_GRID_PRESSURE_MIN)*(1.0f/INK_WIDTH_GRID_PRESSURE_STEP);
+    r = r > 0.0f ? r : 0.0f;
+    c = c > 0.0f ? c : 0.0f;
+    r = r < INK_WIDTH_GRID_ROWS - 1 ? r : INK_WIDTH_GRID_ROWS - 1;
+    c = c < INK_WIDTH_GRID_COLUMNS - 1 ? c : INK_WIDTH_GRID_COLUMNS - 1;
+
+    // The last row and column interpolate towards themselves.
+    ir = (int)r;
+    ic = (int)c;
+    ir = ir < INK_WIDTH_GRID_ROWS - 2 ? ir : INK_WIDTH_GRID_ROWS - 2;
+    ic = ic < INK_WIDTH_GRID_COLUMNS - 2 ? ic : INK_WIDTH_GRID_COLUMNS - 2;
+    r -= ir;
+    c -= ic;
+
+    g = &inkWidthGrid[ir][ic];
+    top = g[0] + (g[1] - g[0])*c;
+    bottom = g[INK_WIDTH_GRID_COLUMNS] + (g[INK_WIDTH_GRID_COLUMNS + 1] - g[INK_WIDTH_GRID_COLUMNS])*c;
+    return (top + (bottom - top)*r)*(1.0f/INK_WIDTH_GRID_SCALE);
+}
+
+// Looks up count widths at once. Written as a single flat loop so compilers
+// can vectorize the index and weight arithmetic.
+void inkWidthGridLookupBatch(const float *dist, const float *pressure, float *width, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_WIDTH_GRID_H_ */
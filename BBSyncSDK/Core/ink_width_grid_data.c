@@ -0,0 +1,2547 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Generated by Tools/bbwidthgen from ink_width_table.c, do not edit.
+
+#include "ink_width_grid.h"
+
+const uint16_t inkWidthGrid[INK_WIDTH_GRID_ROWS][INK_WIDTH_GRID_COLUMNS] =
+{
+    // 1 mm/s
+    {
+        13824, 14383, 14941, 15473, 15925, 16378, 16830, 17282, 17711, 18126,
+        18541, 18957, 19372, 19787, 20202, 20617, 21032, 21416, 21747, 22079,
+        22410, 22741, 23072, 23403, 23734, 24066, 24377, 24630, 24882, 25135,
+        25387, 25640, 25893, 26145, 26398, 26650, 26804, 26958, 27111, 27265,
+        27419, 27572, 27726, 27880, 28033, 28193, 28355, 28517, 28678, 28840,
+        29002, 29164, 29325, 29487, 29650, 29814, 29977, 30141, 30305, 30468,
+        30632, 30796, 30959, 31125, 31298, 31470, 31642, 31815, 31987, 32160,
+        32332, 32505, 32677, 32869, 33062, 33254, 33446, 33638, 33830, 34022,
+        34215, 34407, 34552, 34690, 34829, 34967, 35106, 35244, 35383, 35522,
+        35660, 35790, 35914, 36039, 36163, 36288, 36413, 36537, 36662, 36786,
+        36891, 36961, 37032, 37103, 37174, 37245, 37315, 37386, 37457, 37519
+    },
+    // 2 mm/s
+    {
+        12720, 13209, 13697, 14171, 14597, 15024, 15450, 15877, 16278, 16664,
+        17050, 17436, 17823, 18209, 18595, 18981, 19368, 19724, 20030, 20337,
+        20643, 20950, 21256, 21563, 21869, 22176, 22459, 22669, 22880, 23091,
+        23302, 23513, 23723, 23934, 24145, 24356, 24488, 24620, 24751, 24883,
+        25015, 25147, 25279, 25411, 25543, 25689, 25841, 25992, 26144, 26295,
+        26447, 26598, 26750, 26901, 27051, 27198, 27346, 27493, 27641, 27788,
+        27936, 28083, 28231, 28378, 28526, 28673, 28821, 28969, 29116, 29264,
+        29411, 29559, 29707, 29889, 30071, 30253, 30435, 30617, 30799, 30981,
+        31163, 31345, 31477, 31603, 31728, 31854, 31979, 32104, 32230, 32355,
+        32480, 32603, 32724, 32845, 32967, 33088, 33209, 33330, 33451, 33572,
+        33675, 33747, 33819, 33891, 33963, 34035, 34107, 34179, 34252, 34315
+    },
+    // 3 mm/s
+    {
+        11616, 12035, 12454, 12868, 13269, 13670, 14070, 14471, 14845, 15202,
+        15559, 15916, 16274, 16631, 16988, 17345, 17703, 18032, 18313, 18595,
+        18877, 19159, 19441, 19723, 20004, 20286, 20540, 20709, 20878, 21047,
+        21216, 21385, 21554, 21723, 21892, 22061, 22171, 22281, 22391, 22502,
+        22612, 22722, 22832, 22942, 23052, 23185, 23327, 23468, 23609, 23750,
+        23892, 24033, 24174, 24315, 24452, 24583, 24714, 24846, 24977, 25108,
+        25240, 25371, 25502, 25631, 25754, 25877, 26000, 26122, 26245, 26368,
+        26490, 26613, 26736, 26908, 27080, 27252, 27424, 27596, 27767, 27939,
+        28111, 28283, 28403, 28515, 28627, 28740, 28852, 28964, 29076, 29188,
+        29301, 29416, 29534, 29652, 29770, 29887, 30005, 30123, 30241, 30358,
+        30460, 30533, 30606, 30679, 30753, 30826, 30899, 30973, 31046, 31110
+    },
+    // 4 mm/s
+    {
+        10512, 10861, 11210, 11566, 11941, 12316, 12691, 13066, 13411, 13740,
+        14068, 14396, 14725, 15053, 15381, 15709, 16038, 16339, 16596, 16854,
+        17111, 17368, 17625, 17882, 18139, 18397, 18621, 18749, 18876, 19003,
+        19130, 19258, 19385, 19512, 19639, 19767, 19855, 19943, 20031, 20120,
+        20208, 20296, 20385, 20473, 20561, 20682, 20813, 20944, 21075, 21206,
+        21337, 21468, 21599, 21730, 21853, 21968, 22083, 22198, 22313, 22428,
+        22543, 22659, 22774, 22884, 22982, 23080, 23178, 23276, 23374, 23472,
+        23570, 23667, 23765, 23927, 24089, 24251, 24413, 24574, 24736, 24898,
+        25060, 25222, 25328, 25428, 25527, 25626, 25725, 25824, 25923, 26022,
+        26121, 26230, 26344, 26458, 26573, 26687, 26801, 26916, 27030, 27145,
+        27244, 27319, 27393, 27468, 27542, 27617, 27692, 27766, 27841, 27906
+    },
+    // 5 mm/s
+    {
+         9408,  9687,  9967, 10263, 10613, 10962, 11311, 11660, 11978, 12277,
+        12577, 12876, 13175, 13475, 13774, 14073, 14373, 14647, 14879, 15112,
+        15344, 15577, 15810, 16042, 16275, 16507, 16703, 16788, 16874, 16959,
+        17045, 17130, 17216, 17301, 17387, 17472, 17538, 17605, 17671, 17738,
+        17804, 17871, 17937, 18004, 18070, 18178, 18298, 18419, 18540, 18661,
+        18781, 18902, 19023, 19144, 19254, 19353, 19452, 19550, 19649, 19748,
+        19847, 19946, 20045, 20138, 20211, 20284, 20357, 20430, 20503, 20576,
+        20649, 20722, 20795, 20946, 21098, 21250, 21401, 21553, 21705, 21856,
+        22008, 22160, 22254, 22340, 22426, 22512, 22598, 22684, 22769, 22855,
+        22941, 23043, 23154, 23265, 23376, 23487, 23598, 23709, 23820, 23931,
+        24028, 24104, 24180, 24256, 24332, 24408, 24484, 24559, 24635, 24702
+    },
+    // 6 mm/s
+    {
+         9262,  9541,  9821, 10116, 10459, 10802, 11145, 11488, 11802, 12098,
+        12394, 12691, 12987, 13283, 13579, 13875, 14171, 14442, 14672, 14901,
+        15130, 15360, 15589, 15818, 16048, 16277, 16470, 16557, 16644, 16730,
+        16817, 16903, 16990, 17076, 17163, 17249, 17318, 17386, 17454, 17523,
+        17591, 17659, 17727, 17796, 17864, 17970, 18089, 18208, 18327, 18446,
+        18565, 18684, 18803, 18922, 19031, 19129, 19227, 19325, 19423, 19521,
+        19619, 19717, 19815, 19906, 19979, 20052, 20124, 20197, 20270, 20342,
+        20415, 20488, 20560, 20709, 20858, 21006, 21155, 21304, 21453, 21602,
+        21750, 21899, 21991, 22076, 22160, 22244, 22329, 22413, 22497, 22582,
+        22666, 22766, 22876, 22987, 23097, 23207, 23317, 23427, 23537, 23647,
+        23745, 23821, 23898, 23975, 24051, 24128, 24205, 24282, 24358, 24425
+    },
+    // 7 mm/s
+    {
+         9116,  9395,  9675,  9968, 10306, 10643, 10980, 11317, 11626, 11919,
+        12212, 12505, 12798, 13091, 13384, 13677, 13970, 14238, 14464, 14690,
+        14916, 15142, 15368, 15594, 15820, 16047, 16238, 16326, 16413, 16501,
+        16589, 16676, 16764, 16852, 16939, 17027, 17097, 17167, 17237, 17307,
+        17377, 17447, 17517, 17587, 17657, 17763, 17880, 17997, 18115, 18232,
+        18349, 18466, 18584, 18701, 18808, 18905, 19002, 19099, 19196, 19293,
+        19390, 19487, 19584, 19675, 19748, 19820, 19892, 19964, 20037, 20109,
+        20181, 20254, 20326, 20472, 20617, 20763, 20909, 21055, 21201, 21347,
+        21492, 21638, 21729, 21812, 21894, 21977, 22060, 22142, 22225, 22308,
+        22391, 22490, 22599, 22708, 22817, 22927, 23036, 23145, 23254, 23363,
+        23461, 23538, 23616, 23693, 23771, 23849, 23926, 24004, 24081, 24149
+    },
+    // 8 mm/s
+    {
+         8970,  9250,  9529,  9821, 10152, 10483, 10814, 11145, 11450, 11740,
+        12030, 12320, 12609, 12899, 13189, 13479, 13768, 14033, 14256, 14479,
+        14702, 14925, 15148, 15371, 15593, 15816, 16006, 16095, 16183, 16272,
+        16361, 16449, 16538, 16627, 16716, 16804, 16876, 16948, 17020, 17092,
+        17163, 17235, 17307, 17379, 17451, 17555, 17671, 17786, 17902, 18017,
+        18133, 18248, 18364, 18479, 18585, 18681, 18777, 18874, 18970, 19066,
+        19162, 19258, 19354, 19444, 19516, 19588, 19660, 19732, 19804, 19876,
+        19948, 20019, 20091, 20234, 20377, 20520, 20663, 20806, 20949, 21092,
+        21235, 21378, 21466, 21547, 21629, 21710, 21791, 21872, 21953, 22034,
+        22115, 22213, 22322, 22430, 22538, 22647, 22755, 22863, 22972, 23080,
+        23177, 23255, 23334, 23412, 23491, 23569, 23647, 23726, 23804, 23873
+    },
+    // 9 mm/s
+    {
+         8824,  9104,  9383,  9674,  9999, 10324, 10649, 10974, 11275, 11561,
+        11848, 12134, 12421, 12707, 12994, 13280, 13567, 13828, 14048, 14268,
+        14487, 14707, 14927, 15147, 15366, 15586, 15773, 15863, 15953, 16043,
+        16133, 16223, 16312, 16402, 16492, 16582, 16656, 16729, 16803, 16876,
+        16950, 17023, 17097, 17171, 17244, 17348, 17462, 17575, 17689, 17803,
+        17917, 18030, 18144, 18258, 18362, 18458, 18553, 18648, 18743, 18838,
+        18933, 19028, 19124, 19213, 19284, 19356, 19428, 19499, 19571, 19642,
+        19714, 19785, 19857, 19997, 20137, 20277, 20417, 20557, 20697, 20837,
+        20977, 21117, 21204, 21283, 21363, 21442, 21522, 21601, 21681, 21760,
+        21840, 21937, 22044, 22152, 22259, 22367, 22474, 22581, 22689, 22796,
+        22893, 22972, 23052, 23131, 23210, 23290, 23369, 23448, 23527, 23597
+    },
+    // 10 mm/s
+    {
+         8678,  8958,  9237,  9526,  9845, 10164, 10483, 10802, 11099, 11382,
+        11665, 11949, 12232, 12515, 12799, 13082, 13365, 13624, 13840, 14057,
+        14273, 14490, 14706, 14923, 15139, 15356, 15541, 15632, 15723, 15814,
+        15905, 15996, 16087, 16178, 16268, 16359, 16435, 16510, 16585, 16661,
+        16736, 16812, 16887, 16962, 17038, 17140, 17252, 17364, 17476, 17588,
+        17700, 17812, 17924, 18036, 18140, 18234, 18328, 18422, 18516, 18611,
+        18705, 18799, 18893, 18982, 19053, 19124, 19195, 19267, 19338, 19409,
+        19480, 19551, 19623, 19760, 19897, 20034, 20171, 20308, 20445, 20582,
+        20719, 20856, 20941, 21019, 21097, 21175, 21253, 21331, 21409, 21487,
+        21565, 21660, 21767, 21873, 21980, 22086, 22193, 22300, 22406, 22513,
+        22609, 22689, 22770, 22850, 22930, 23010, 23090, 23170, 23250, 23320
+    },
+    // 11 mm/s
+    {
+         8532,  8812,  9091,  9379,  9692, 10004, 10317, 10630, 10923, 11203,
+        11483, 11763, 12043, 12323, 12604, 12884, 13164, 13419, 13632, 13846,
+        14059, 14272, 14486, 14699, 14912, 15126, 15309, 15401, 15493, 15585,
+        15677, 15769, 15861, 15953, 16045, 16137, 16214, 16291, 16368, 16445,
+        16523, 16600, 16677, 16754, 16831, 16933, 17043, 17154, 17264, 17374,
+        17484, 17595, 17705, 17815, 17917, 18010, 18103, 18197, 18290, 18383,
+        18476, 18570, 18663, 18751, 18821, 18892, 18963, 19034, 19105, 19176,
+        19247, 19317, 19388, 19522, 19656, 19791, 19925, 20059, 20193, 20327,
+        20461, 20595, 20679, 20755, 20831, 20908, 20984, 21060, 21137, 21213,
+        21289, 21384, 21490, 21595, 21701, 21806, 21912, 22018, 22123, 22229,
+        22325, 22406, 22487, 22568, 22649, 22730, 22811, 22892, 22973, 23044
+    },
+    // 12 mm/s
+    {
+         8387,  8666,  8945,  9231,  9538,  9845, 10152, 10459, 10747, 11024,
+        11301, 11578, 11855, 12131, 12408, 12685, 12962, 13214, 13424, 13635,
+        13845, 14055, 14265, 14475, 14685, 14896, 15076, 15170, 15263, 15356,
+        15449, 15542, 15635, 15728, 15821, 15914, 15993, 16072, 16151, 16230,
+        16309, 16388, 16467, 16546, 16624, 16726, 16834, 16943, 17051, 17160,
+        17268, 17377, 17485, 17594, 17694, 17786, 17879, 17971, 18063, 18156,
+        18248, 18340, 18433, 18519, 18590, 18660, 18731, 18801, 18872, 18942,
+        19013, 19083, 19154, 19285, 19416, 19547, 19678, 19810, 19941, 20072,
+        20203, 20334, 20416, 20491, 20566, 20640, 20715, 20790, 20864, 20939,
+        21014, 21107, 21212, 21317, 21422, 21526, 21631, 21736, 21841, 21945,
+        22042, 22123, 22205, 22287, 22369, 22451, 22533, 22615, 22696, 22768
+    },
+    // 13 mm/s
+    {
+         8241,  8520,  8799,  9084,  9385,  9685,  9986, 10287, 10571, 10845,
+        11118, 11392, 11666, 11940, 12213, 12487, 12761, 13010, 13217, 13423,
+        13630, 13837, 14044, 14251, 14458, 14665, 14844, 14938, 15032, 15127,
+        15221, 15315, 15409, 15503, 15598, 15692, 15773, 15853, 15934, 16015,
+        16095, 16176, 16257, 16337, 16418, 16518, 16625, 16732, 16838, 16945,
+        17052, 17159, 17265, 17372, 17471, 17563, 17654, 17745, 17837, 17928,
+        18019, 18111, 18202, 18288, 18358, 18428, 18499, 18569, 18639, 18709,
+        18779, 18849, 18919, 19048, 19176, 19304, 19432, 19561, 19689, 19817,
+        19945, 20074, 20154, 20227, 20300, 20373, 20446, 20519, 20592, 20665,
+        20739, 20831, 20935, 21039, 21142, 21246, 21350, 21454, 21558, 21662,
+        21758, 21840, 21923, 22006, 22089, 22171, 22254, 22337, 22419, 22492
+    },
+    // 14 mm/s
+    {
+         8095,  8374,  8653,  8936,  9231,  9526,  9821, 10115, 10395, 10666,
+        10936, 11207, 11477, 11748, 12018, 12289, 12559, 12805, 13009, 13212,
+        13416, 13620, 13824, 14028, 14231, 14435, 14612, 14707, 14802, 14898,
+        14993, 15088, 15183, 15279, 15374, 15469, 15552, 15634, 15717, 15799,
+        15882, 15964, 16046, 16129, 16211, 16311, 16416, 16521, 16626, 16731,
+        16836, 16941, 17046, 17151, 17248, 17339, 17429, 17520, 17610, 17701,
+        17791, 17881, 17972, 18057, 18127, 18197, 18266, 18336, 18406, 18476,
+        18545, 18615, 18685, 18810, 18936, 19061, 19186, 19312, 19437, 19562,
+        19687, 19813, 19891, 19963, 20034, 20106, 20177, 20249, 20320, 20392,
+        20463, 20554, 20657, 20760, 20863, 20966, 21069, 21172, 21275, 21378,
+        21474, 21557, 21641, 21725, 21808, 21892, 21975, 22059, 22142, 22216
+    },
+    // 15 mm/s
+    {
+         7949,  8228,  8507,  8789,  9078,  9366,  9655,  9944, 10219, 10486,
+        10754, 11021, 11288, 11556, 11823, 12091, 12358, 12600, 12801, 13001,
+        13202, 13403, 13603, 13804, 14004, 14205, 14379, 14476, 14572, 14669,
+        14765, 14861, 14958, 15054, 15150, 15247, 15331, 15415, 15499, 15584,
+        15668, 15752, 15836, 15921, 16005, 16103, 16207, 16310, 16413, 16516,
+        16619, 16723, 16826, 16929, 17026, 17115, 17205, 17294, 17383, 17473,
+        17562, 17652, 17741, 17826, 17895, 17965, 18034, 18104, 18173, 18242,
+        18312, 18381, 18451, 18573, 18695, 18818, 18940, 19062, 19185, 19307,
+        19430, 19552, 19628, 19698, 19768, 19838, 19908, 19978, 20048, 20118,
+        20188, 20278, 20380, 20482, 20584, 20686, 20788, 20890, 20993, 21095,
+        21190, 21274, 21359, 21443, 21528, 21612, 21697, 21781, 21865, 21939
+    },
+    // 16 mm/s
+    {
+         7803,  8082,  8361,  8642,  8924,  9207,  9489,  9772, 10043, 10307,
+        10571, 10836, 11100, 11364, 11628, 11892, 12156, 12395, 12593, 12790,
+        12988, 13185, 13382, 13580, 13777, 13975, 14147, 14245, 14342, 14439,
+        14537, 14634, 14732, 14829, 14927, 15024, 15110, 15196, 15282, 15368,
+        15454, 15540, 15626, 15712, 15798, 15896, 15997, 16099, 16200, 16302,
+        16403, 16505, 16606, 16708, 16803, 16891, 16980, 17068, 17157, 17245,
+        17334, 17423, 17511, 17595, 17664, 17733, 17802, 17871, 17940, 18009,
+        18078, 18147, 18216, 18336, 18455, 18575, 18694, 18813, 18933, 19052,
+        19172, 19291, 19366, 19434, 19503, 19571, 19639, 19708, 19776, 19844,
+        19912, 20001, 20103, 20204, 20305, 20406, 20507, 20609, 20710, 20811,
+        20906, 20991, 21077, 21162, 21247, 21333, 21418, 21503, 21588, 21663
+    },
+    // 17 mm/s
+    {
+         7657,  7936,  8216,  8494,  8771,  9047,  9324,  9600,  9867, 10128,
+        10389, 10650, 10911, 11172, 11433, 11694, 11955, 12191, 12385, 12579,
+        12773, 12968, 13162, 13356, 13550, 13744, 13915, 14013, 14112, 14210,
+        14309, 14408, 14506, 14605, 14703, 14802, 14890, 14977, 15065, 15153,
+        15241, 15328, 15416, 15504, 15592, 15688, 15788, 15888, 15988, 16087,
+        16187, 16287, 16387, 16486, 16580, 16668, 16755, 16843, 16930, 17018,
+        17105, 17193, 17281, 17364, 17432, 17501, 17570, 17638, 17707, 17776,
+        17844, 17913, 17982, 18098, 18215, 18331, 18448, 18564, 18681, 18797,
+        18914, 19030, 19103, 19170, 19237, 19304, 19370, 19437, 19504, 19570,
+        19637, 19725, 19825, 19925, 20026, 20126, 20226, 20327, 20427, 20527,
+        20622, 20709, 20795, 20881, 20967, 21053, 21139, 21225, 21311, 21387
+    },
+    // 18 mm/s
+    {
+         7511,  7790,  8070,  8347,  8617,  8888,  9158,  9429,  9691,  9949,
+        10207, 10465, 10722, 10980, 11238, 11496, 11753, 11986, 12177, 12368,
+        12559, 12750, 12941, 13132, 13323, 13514, 13682, 13782, 13882, 13981,
+        14081, 14181, 14280, 14380, 14480, 14579, 14669, 14758, 14848, 14937,
+        15027, 15116, 15206, 15296, 15385, 15481, 15579, 15677, 15775, 15873,
+        15971, 16069, 16167, 16265, 16357, 16444, 16530, 16617, 16704, 16790,
+        16877, 16964, 17050, 17132, 17201, 17269, 17337, 17406, 17474, 17542,
+        17611, 17679, 17747, 17861, 17975, 18088, 18202, 18315, 18429, 18542,
+        18656, 18770, 18841, 18906, 18971, 19036, 19101, 19166, 19232, 19297,
+        19362, 19448, 19548, 19647, 19747, 19846, 19946, 20045, 20144, 20244,
+        20339, 20426, 20513, 20600, 20686, 20773, 20860, 20947, 21034, 21111
+    },
+    // 19 mm/s
+    {
+         7365,  7644,  7924,  8199,  8464,  8728,  8993,  9257,  9515,  9770,
+        10025, 10279, 10534, 10788, 11043, 11297, 11552, 11781, 11969, 12157,
+        12345, 12533, 12721, 12908, 13096, 13284, 13450, 13551, 13652, 13752,
+        13853, 13954, 14055, 14155, 14256, 14357, 14448, 14539, 14631, 14722,
+        14813, 14905, 14996, 15087, 15179, 15274, 15370, 15466, 15562, 15658,
+        15755, 15851, 15947, 16043, 16134, 16220, 16306, 16391, 16477, 16563,
+        16649, 16734, 16820, 16901, 16969, 17037, 17105, 17173, 17241, 17309,
+        17377, 17445, 17513, 17624, 17734, 17845, 17956, 18066, 18177, 18288,
+        18398, 18509, 18578, 18642, 18705, 18769, 18832, 18896, 18959, 19023,
+        19086, 19172, 19270, 19369, 19467, 19566, 19665, 19763, 19862, 19960,
+        20055, 20143, 20230, 20318, 20406, 20494, 20582, 20670, 20757, 20834
+    },
+    // 20 mm/s
+    {
+         7219,  7498,  7778,  8052,  8310,  8569,  8827,  9086,  9340,  9591,
+         9842, 10094, 10345, 10596, 10848, 11099, 11350, 11577, 11761, 11946,
+        12131, 12315, 12500, 12685, 12869, 13054, 13218, 13320, 13421, 13523,
+        13625, 13727, 13829, 13931, 14032, 14134, 14227, 14320, 14413, 14507,
+        14600, 14693, 14786, 14879, 14972, 15066, 15161, 15255, 15350, 15444,
+        15538, 15633, 15727, 15822, 15912, 15996, 16081, 16166, 16251, 16335,
+        16420, 16505, 16590, 16670, 16738, 16805, 16873, 16941, 17008, 17076,
+        17143, 17211, 17279, 17386, 17494, 17602, 17709, 17817, 17925, 18033,
+        18140, 18248, 18316, 18378, 18440, 18501, 18563, 18625, 18687, 18749,
+        18811, 18895, 18993, 19091, 19188, 19286, 19384, 19481, 19579, 19677,
+        19771, 19860, 19948, 20037, 20126, 20214, 20303, 20392, 20480, 20558
+    },
+    // 21 mm/s
+    {
+         7073,  7353,  7632,  7904,  8157,  8409,  8661,  8914,  9164,  9412,
+         9660,  9908, 10156, 10404, 10653, 10901, 11149, 11372, 11554, 11735,
+        11916, 12098, 12279, 12461, 12642, 12824, 12985, 13088, 13191, 13294,
+        13397, 13500, 13603, 13706, 13809, 13912, 14007, 14101, 14196, 14291,
+        14386, 14481, 14576, 14671, 14765, 14859, 14951, 15044, 15137, 15230,
+        15322, 15415, 15508, 15600, 15689, 15773, 15856, 15940, 16024, 16108,
+        16192, 16275, 16359, 16439, 16506, 16573, 16641, 16708, 16775, 16842,
+        16910, 16977, 17044, 17149, 17254, 17359, 17463, 17568, 17673, 17778,
+        17882, 17987, 18053, 18113, 18174, 18234, 18294, 18355, 18415, 18475,
+        18536, 18619, 18716, 18812, 18909, 19006, 19103, 19199, 19296, 19393,
+        19487, 19577, 19666, 19756, 19845, 19935, 20024, 20114, 20203, 20282
+    },
+    // 22 mm/s
+    {
+         6927,  7207,  7486,  7757,  8003,  8250,  8496,  8742,  8988,  9233,
+         9478,  9723,  9968, 10213, 10458, 10703, 10947, 11167, 11346, 11524,
+        11702, 11880, 12059, 12237, 12415, 12593, 12753, 12857, 12961, 13065,
+        13169, 13273, 13377, 13481, 13585, 13689, 13786, 13882, 13979, 14076,
+        14172, 14269, 14366, 14462, 14559, 14651, 14742, 14833, 14924, 15015,
+        15106, 15197, 15288, 15379, 15466, 15549, 15632, 15714, 15797, 15880,
+        15963, 16046, 16129, 16208, 16275, 16342, 16408, 16475, 16542, 16609,
+        16676, 16743, 16810, 16912, 17014, 17115, 17217, 17319, 17421, 17523,
+        17625, 17726, 17791, 17849, 17908, 17967, 18026, 18084, 18143, 18202,
+        18260, 18342, 18438, 18534, 18630, 18726, 18822, 18918, 19013, 19109,
+        19203, 19294, 19384, 19474, 19565, 19655, 19746, 19836, 19926, 20006
+    },
+    // 23 mm/s
+    {
+         6781,  7061,  7340,  7610,  7850,  8090,  8330,  8571,  8812,  9054,
+         9295,  9537,  9779, 10021, 10262, 10504, 10746, 10963, 11138, 11313,
+        11488, 11663, 11838, 12013, 12188, 12363, 12521, 12626, 12731, 12836,
+        12941, 13046, 13151, 13256, 13362, 13467, 13565, 13663, 13762, 13860,
+        13959, 14057, 14155, 14254, 14352, 14444, 14533, 14622, 14711, 14801,
+        14890, 14979, 15068, 15158, 15243, 15325, 15407, 15489, 15571, 15653,
+        15735, 15817, 15898, 15977, 16043, 16110, 16176, 16243, 16309, 16376,
+        16442, 16509, 16575, 16674, 16773, 16872, 16971, 17070, 17169, 17268,
+        17367, 17466, 17528, 17585, 17642, 17699, 17757, 17814, 17871, 17928,
+        17985, 18066, 18161, 18256, 18351, 18446, 18541, 18636, 18731, 18826,
+        18919, 19011, 19102, 19193, 19284, 19376, 19467, 19558, 19649, 19729
+    },
+    // 24 mm/s
+    {
+         6636,  6915,  7194,  7462,  7696,  7931,  8165,  8399,  8636,  8874,
+         9113,  9352,  9590,  9829, 10067, 10306, 10545, 10758, 10930, 11102,
+        11274, 11446, 11617, 11789, 11961, 12133, 12288, 12395, 12501, 12607,
+        12713, 12819, 12926, 13032, 13138, 13244, 13344, 13444, 13545, 13645,
+        13745, 13845, 13945, 14046, 14146, 14236, 14324, 14411, 14499, 14586,
+        14674, 14761, 14849, 14936, 15020, 15101, 15182, 15263, 15344, 15425,
+        15506, 15587, 15668, 15745, 15812, 15878, 15944, 16010, 16076, 16142,
+        16209, 16275, 16341, 16437, 16533, 16629, 16725, 16821, 16917, 17013,
+        17109, 17205, 17265, 17321, 17377, 17432, 17488, 17543, 17599, 17654,
+        17710, 17789, 17883, 17978, 18072, 18166, 18260, 18354, 18448, 18542,
+        18636, 18728, 18820, 18912, 19004, 19096, 19188, 19280, 19372, 19453
+    },
+    // 25 mm/s
+    {
+         6490,  6769,  7048,  7315,  7543,  7771,  7999,  8227,  8460,  8695,
+         8931,  9166,  9402,  9637,  9872, 10108, 10343, 10553, 10722, 10891,
+        11059, 11228, 11397, 11565, 11734, 11903, 12056, 12163, 12271, 12378,
+        12485, 12592, 12700, 12807, 12914, 13022, 13124, 13226, 13327, 13429,
+        13531, 13633, 13735, 13837, 13939, 14029, 14115, 14200, 14286, 14372,
+        14457, 14543, 14629, 14715, 14797, 14877, 14958, 15038, 15118, 15198,
+        15278, 15358, 15438, 15514, 15580, 15646, 15712, 15778, 15843, 15909,
+        15975, 16041, 16107, 16200, 16293, 16386, 16479, 16572, 16665, 16758,
+        16851, 16944, 17003, 17057, 17111, 17165, 17219, 17273, 17327, 17380,
+        17434, 17513, 17606, 17699, 17793, 17886, 17979, 18072, 18165, 18259,
+        18352, 18445, 18538, 18631, 18724, 18817, 18910, 19003, 19096, 19177
+    },
+    // 26 mm/s
+    {
+         6344,  6623,  6902,  7167,  7389,  7611,  7834,  8056,  8284,  8516,
+         8748,  8981,  9213,  9445,  9677,  9909, 10142, 10349, 10514, 10680,
+        10845, 11011, 11176, 11342, 11507, 11673, 11824, 11932, 12040, 12149,
+        12257, 12366, 12474, 12582, 12691, 12799, 12903, 13007, 13110, 13214,
+        13318, 13421, 13525, 13629, 13733, 13821, 13905, 13989, 14073, 14157,
+        14241, 14325, 14409, 14493, 14575, 14654, 14733, 14812, 14891, 14970,
+        15049, 15128, 15207, 15283, 15348, 15414, 15479, 15545, 15610, 15676,
+        15741, 15807, 15872, 15962, 16052, 16143, 16233, 16323, 16413, 16503,
+        16593, 16683, 16740, 16793, 16845, 16897, 16950, 17002, 17054, 17107,
+        17159, 17236, 17329, 17421, 17513, 17606, 17698, 17790, 17883, 17975,
+        18068, 18162, 18256, 18349, 18443, 18537, 18631, 18725, 18819, 18901
+    },
+    // 27 mm/s
+    {
+         6198,  6477,  6756,  7020,  7236,  7452,  7668,  7884,  8108,  8337,
+         8566,  8795,  9024,  9253,  9482,  9711,  9940, 10144, 10306, 10469,
+        10631, 10793, 10955, 11118, 11280, 11442, 11591, 11701, 11810, 11920,
+        12029, 12139, 12248, 12358, 12467, 12577, 12682, 12788, 12893, 12999,
+        13104, 13210, 13315, 13421, 13526, 13614, 13696, 13778, 13861, 13943,
+        14025, 14107, 14189, 14272, 14352, 14430, 14508, 14586, 14664, 14743,
+        14821, 14899, 14977, 15052, 15117, 15182, 15247, 15312, 15377, 15443,
+        15508, 15573, 15638, 15725, 15812, 15899, 15987, 16074, 16161, 16248,
+        16335, 16423, 16478, 16529, 16579, 16630, 16681, 16731, 16782, 16833,
+        16884, 16960, 17051, 17143, 17234, 17326, 17417, 17508, 17600, 17691,
+        17784, 17879, 17973, 18068, 18163, 18257, 18352, 18447, 18542, 18624
+    },
+    // 28 mm/s
+    {
+         6052,  6331,  6610,  6872,  7082,  7292,  7502,  7712,  7932,  8158,
+         8384,  8610,  8835,  9061,  9287,  9513,  9739,  9939, 10098, 10258,
+        10417, 10576, 10735, 10894, 11053, 11212, 11359, 11470, 11580, 11691,
+        11801, 11912, 12022, 12133, 12243, 12354, 12461, 12569, 12676, 12783,
+        12890, 12998, 13105, 13212, 13319, 13407, 13487, 13568, 13648, 13728,
+        13809, 13889, 13970, 14050, 14129, 14206, 14283, 14361, 14438, 14515,
+        14592, 14669, 14747, 14821, 14885, 14950, 15015, 15080, 15144, 15209,
+        15274, 15339, 15403, 15488, 15572, 15656, 15740, 15825, 15909, 15993,
+        16077, 16162, 16215, 16264, 16314, 16363, 16412, 16461, 16510, 16559,
+        16608, 16683, 16774, 16864, 16955, 17046, 17136, 17227, 17317, 17408,
+        17500, 17596, 17691, 17787, 17882, 17978, 18073, 18169, 18265, 18348
+    },
+    // 29 mm/s
+    {
+         5906,  6185,  6464,  6725,  6929,  7133,  7337,  7541,  7756,  7979,
+         8202,  8424,  8647,  8869,  9092,  9315,  9537,  9735,  9891, 10046,
+        10202, 10358, 10514, 10670, 10826, 10982, 11127, 11238, 11350, 11462,
+        11573, 11685, 11797, 11908, 12020, 12132, 12241, 12350, 12459, 12568,
+        12677, 12786, 12895, 13004, 13113, 13199, 13278, 13357, 13435, 13514,
+        13593, 13671, 13750, 13829, 13906, 13982, 14059, 14135, 14211, 14287,
+        14364, 14440, 14516, 14590, 14654, 14718, 14783, 14847, 14911, 14976,
+        15040, 15105, 15169, 15250, 15332, 15413, 15494, 15576, 15657, 15738,
+        15820, 15901, 15953, 16000, 16048, 16095, 16143, 16190, 16238, 16285,
+        16333, 16407, 16497, 16586, 16676, 16766, 16855, 16945, 17034, 17124,
+        17216, 17313, 17409, 17506, 17602, 17698, 17795, 17891, 17988, 18072
+    },
+    // 30 mm/s
+    {
+         5760,  6039,  6319,  6577,  6775,  6973,  7171,  7369,  7580,  7800,
+         8019,  8239,  8458,  8677,  8897,  9116,  9336,  9530,  9683,  9835,
+         9988, 10141, 10294, 10446, 10599, 10752, 10894, 11007, 11120, 11233,
+        11345, 11458, 11571, 11684, 11796, 11909, 12020, 12131, 12241, 12352,
+        12463, 12574, 12685, 12796, 12906, 12992, 13069, 13146, 13223, 13300,
+        13376, 13453, 13530, 13607, 13683, 13759, 13834, 13909, 13985, 14060,
+        14135, 14211, 14286, 14358, 14422, 14486, 14550, 14614, 14679, 14743,
+        14807, 14871, 14935, 15013, 15091, 15170, 15248, 15327, 15405, 15483,
+        15562, 15640, 15690, 15736, 15782, 15828, 15874, 15920, 15966, 16012,
+        16058, 16130, 16219, 16308, 16397, 16485, 16574, 16663, 16752, 16841,
+        16932, 17030, 17127, 17224, 17322, 17419, 17516, 17613, 17711, 17796
+    },
+    // 31 mm/s
+    {
+         5756,  6030,  6303,  6558,  6754,  6949,  7145,  7341,  7550,  7767,
+         7984,  8201,  8418,  8635,  8852,  9069,  9287,  9479,  9631,  9782,
+         9934, 10085, 10237, 10388, 10540, 10692, 10833, 10946, 11058, 11171,
+        11284, 11396, 11509, 11621, 11734, 11846, 11956, 12066, 12176, 12286,
+        12396, 12506, 12616, 12726, 12836, 12921, 12998, 13075, 13151, 13228,
+        13305, 13382, 13458, 13535, 13611, 13686, 13762, 13837, 13912, 13988,
+        14063, 14138, 14214, 14286, 14350, 14413, 14477, 14541, 14604, 14668,
+        14732, 14795, 14859, 14937, 15014, 15092, 15170, 15247, 15325, 15402,
+        15480, 15558, 15608, 15654, 15701, 15747, 15793, 15840, 15886, 15932,
+        15978, 16051, 16138, 16226, 16313, 16401, 16489, 16576, 16664, 16752,
+        16842, 16938, 17034, 17130, 17226, 17323, 17419, 17515, 17611, 17695
+    },
+    // 32 mm/s
+    {
+         5751,  6020,  6288,  6538,  6732,  6925,  7119,  7313,  7520,  7734,
+         7949,  8164,  8379,  8593,  8808,  9023,  9237,  9428,  9578,  9729,
+         9879, 10030, 10180, 10331, 10481, 10631, 10772, 10885, 10997, 11109,
+        11222, 11334, 11447, 11559, 11671, 11784, 11893, 12002, 12111, 12220,
+        12329, 12438, 12548, 12657, 12766, 12850, 12927, 13004, 13080, 13157,
+        13233, 13310, 13386, 13463, 13539, 13614, 13689, 13765, 13840, 13915,
+        13991, 14066, 14141, 14214, 14277, 14340, 14404, 14467, 14530, 14593,
+        14657, 14720, 14783, 14860, 14937, 15014, 15091, 15168, 15245, 15322,
+        15398, 15475, 15526, 15572, 15619, 15666, 15713, 15759, 15806, 15853,
+        15899, 15971, 16057, 16144, 16230, 16317, 16403, 16490, 16576, 16663,
+        16752, 16847, 16942, 17037, 17131, 17226, 17321, 17416, 17511, 17594
+    },
+    // 33 mm/s
+    {
+         5747,  6010,  6273,  6518,  6710,  6902,  7093,  7285,  7489,  7702,
+         7914,  8127,  8339,  8551,  8764,  8976,  9188,  9377,  9526,  9676,
+         9825,  9974, 10123, 10273, 10422, 10571, 10711, 10823, 10936, 11048,
+        11160, 11272, 11385, 11497, 11609, 11721, 11829, 11938, 12046, 12154,
+        12262, 12371, 12479, 12587, 12695, 12780, 12856, 12933, 13009, 13085,
+        13162, 13238, 13314, 13391, 13467, 13542, 13617, 13693, 13768, 13843,
+        13918, 13994, 14069, 14141, 14204, 14267, 14330, 14393, 14456, 14519,
+        14582, 14645, 14708, 14784, 14860, 14936, 15012, 15088, 15165, 15241,
+        15317, 15393, 15444, 15491, 15538, 15585, 15632, 15679, 15726, 15773,
+        15820, 15891, 15976, 16062, 16147, 16232, 16318, 16403, 16488, 16574,
+        16662, 16756, 16849, 16943, 17036, 17130, 17224, 17317, 17411, 17492
+    },
+    // 34 mm/s
+    {
+         5743,  6000,  6258,  6499,  6688,  6878,  7067,  7257,  7459,  7669,
+         7879,  8089,  8299,  8509,  8719,  8929,  9139,  9326,  9474,  9622,
+         9770,  9919, 10067, 10215, 10363, 10511, 10650, 10762, 10874, 10986,
+        11098, 11210, 11322, 11434, 11547, 11659, 11766, 11873, 11981, 12088,
+        12196, 12303, 12410, 12518, 12625, 12709, 12785, 12862, 12938, 13014,
+        13090, 13166, 13242, 13319, 13394, 13470, 13545, 13620, 13696, 13771,
+        13846, 13921, 13997, 14069, 14131, 14194, 14257, 14319, 14382, 14444,
+        14507, 14570, 14632, 14707, 14783, 14858, 14934, 15009, 15084, 15160,
+        15235, 15311, 15361, 15409, 15456, 15504, 15551, 15599, 15646, 15693,
+        15741, 15811, 15895, 15980, 16064, 16148, 16232, 16317, 16401, 16485,
+        16572, 16665, 16757, 16849, 16941, 17034, 17126, 17218, 17311, 17391
+    },
+    // 35 mm/s
+    {
+         5739,  5991,  6243,  6479,  6666,  6854,  7041,  7229,  7429,  7636,
+         7844,  8052,  8260,  8467,  8675,  8883,  9090,  9275,  9422,  9569,
+         9716,  9863, 10010, 10157, 10304, 10451, 10589, 10701, 10813, 10925,
+        11037, 11148, 11260, 11372, 11484, 11596, 11703, 11809, 11916, 12022,
+        12129, 12235, 12342, 12448, 12555, 12638, 12714, 12790, 12866, 12942,
+        13018, 13094, 13170, 13246, 13322, 13397, 13473, 13548, 13623, 13699,
+        13774, 13849, 13925, 13997, 14059, 14121, 14183, 14245, 14308, 14370,
+        14432, 14494, 14556, 14631, 14706, 14780, 14855, 14930, 15004, 15079,
+        15154, 15228, 15279, 15327, 15375, 15423, 15470, 15518, 15566, 15614,
+        15662, 15731, 15814, 15898, 15981, 16064, 16147, 16230, 16313, 16396,
+        16482, 16573, 16664, 16755, 16846, 16937, 17029, 17120, 17211, 17290
+    },
+    // 36 mm/s
+    {
+         5734,  5981,  6228,  6459,  6644,  6830,  7015,  7201,  7398,  7604,
+         7809,  8014,  8220,  8425,  8631,  8836,  9041,  9224,  9370,  9516,
+         9662,  9807,  9953, 10099, 10245, 10391, 10528, 10640, 10751, 10863,
+        10975, 11087, 11198, 11310, 11422, 11533, 11639, 11745, 11850, 11956,
+        12062, 12167, 12273, 12379, 12485, 12568, 12644, 12719, 12795, 12871,
+        12947, 13023, 13098, 13174, 13250, 13325, 13400, 13476, 13551, 13626,
+        13702, 13777, 13852, 13924, 13986, 14048, 14110, 14172, 14233, 14295,
+        14357, 14419, 14481, 14555, 14629, 14702, 14776, 14850, 14924, 14998,
+        15072, 15146, 15197, 15245, 15293, 15342, 15390, 15438, 15486, 15534,
+        15582, 15652, 15734, 15815, 15897, 15979, 16061, 16143, 16225, 16307,
+        16392, 16482, 16572, 16662, 16751, 16841, 16931, 17021, 17111, 17189
+    },
+    // 37 mm/s
+    {
+         5730,  5971,  6213,  6439,  6623,  6806,  6989,  7172,  7368,  7571,
+         7774,  7977,  8180,  8383,  8586,  8789,  8992,  9173,  9318,  9463,
+         9607,  9752,  9897, 10041, 10186, 10331, 10467, 10578, 10690, 10802,
+        10913, 11025, 11136, 11248, 11359, 11471, 11576, 11680, 11785, 11890,
+        11995, 12100, 12205, 12309, 12414, 12497, 12573, 12648, 12724, 12800,
+        12875, 12951, 13027, 13102, 13178, 13253, 13328, 13403, 13479, 13554,
+        13629, 13705, 13780, 13852, 13913, 13975, 14036, 14098, 14159, 14221,
+        14282, 14344, 14405, 14478, 14551, 14625, 14698, 14771, 14844, 14917,
+        14990, 15063, 15115, 15163, 15212, 15261, 15309, 15358, 15406, 15455,
+        15503, 15572, 15653, 15733, 15814, 15895, 15976, 16057, 16137, 16218,
+        16302, 16391, 16479, 16568, 16656, 16745, 16834, 16922, 17011, 17088
+    },
+    // 38 mm/s
+    {
+         5726,  5962,  6198,  6420,  6601,  6782,  6963,  7144,  7338,  7538,
+         7739,  7940,  8140,  8341,  8542,  8742,  8943,  9122,  9266,  9409,
+         9553,  9696,  9840,  9983, 10127, 10270, 10406, 10517, 10629, 10740,
+        10851, 10963, 11074, 11185, 11297, 11408, 11512, 11616, 11720, 11824,
+        11928, 12032, 12136, 12240, 12344, 12427, 12502, 12577, 12653, 12728,
+        12804, 12879, 12955, 13030, 13105, 13181, 13256, 13331, 13407, 13482,
+        13557, 13632, 13708, 13779, 13841, 13902, 13963, 14024, 14085, 14146,
+        14207, 14268, 14330, 14402, 14474, 14547, 14619, 14691, 14764, 14836,
+        14909, 14981, 15033, 15082, 15131, 15179, 15228, 15277, 15326, 15375,
+        15424, 15492, 15572, 15651, 15731, 15811, 15890, 15970, 16050, 16129,
+        16212, 16299, 16387, 16474, 16561, 16649, 16736, 16823, 16911, 16987
+    },
+    // 39 mm/s
+    {
+         5722,  5952,  6182,  6400,  6579,  6758,  6937,  7116,  7307,  7506,
+         7704,  7902,  8101,  8299,  8497,  8696,  8894,  9071,  9214,  9356,
+         9498,  9641,  9783,  9926, 10068, 10210, 10345, 10456, 10567, 10678,
+        10790, 10901, 11012, 11123, 11234, 11346, 11449, 11552, 11655, 11758,
+        11861, 11964, 12067, 12171, 12274, 12356, 12431, 12506, 12582, 12657,
+        12732, 12807, 12883, 12958, 13033, 13108, 13184, 13259, 13334, 13410,
+        13485, 13560, 13635, 13707, 13768, 13829, 13889, 13950, 14011, 14072,
+        14132, 14193, 14254, 14326, 14397, 14469, 14540, 14612, 14684, 14755,
+        14827, 14899, 14951, 15000, 15049, 15098, 15148, 15197, 15246, 15295,
+        15345, 15412, 15491, 15569, 15648, 15726, 15805, 15883, 15962, 16041,
+        16122, 16208, 16294, 16380, 16466, 16552, 16639, 16725, 16811, 16886
+    },
+    // 40 mm/s
+    {
+         5717,  5942,  6167,  6380,  6557,  6734,  6911,  7088,  7277,  7473,
+         7669,  7865,  8061,  8257,  8453,  8649,  8845,  9020,  9162,  9303,
+         9444,  9585,  9726,  9868, 10009, 10150, 10284, 10395, 10506, 10617,
+        10728, 10839, 10950, 11061, 11172, 11283, 11385, 11487, 11590, 11692,
+        11794, 11897, 11999, 12101, 12203, 12285, 12360, 12435, 12510, 12585,
+        12660, 12736, 12811, 12886, 12961, 13036, 13111, 13187, 13262, 13337,
+        13413, 13488, 13563, 13635, 13695, 13756, 13816, 13876, 13937, 13997,
+        14058, 14118, 14178, 14249, 14320, 14391, 14462, 14533, 14604, 14674,
+        14745, 14816, 14868, 14918, 14968, 15017, 15067, 15117, 15166, 15216,
+        15265, 15332, 15410, 15487, 15565, 15642, 15719, 15797, 15874, 15952,
+        16032, 16117, 16202, 16286, 16371, 16456, 16541, 16626, 16711, 16785
+    },
+    // 41 mm/s
+    {
+         5713,  5933,  6152,  6361,  6535,  6710,  6885,  7060,  7247,  7440,
+         7634,  7828,  8021,  8215,  8409,  8602,  8796,  8969,  9110,  9250,
+         9390,  9530,  9670,  9810,  9950, 10090, 10223, 10333, 10444, 10555,
+        10666, 10777, 10888, 10999, 11109, 11220, 11322, 11423, 11525, 11626,
+        11727, 11829, 11930, 12032, 12133, 12215, 12289, 12364, 12439, 12514,
+        12589, 12664, 12739, 12813, 12889, 12964, 13039, 13114, 13190, 13265,
+        13340, 13416, 13491, 13562, 13622, 13682, 13743, 13803, 13863, 13923,
+        13983, 14043, 14103, 14173, 14243, 14313, 14383, 14453, 14523, 14594,
+        14664, 14734, 14786, 14836, 14886, 14936, 14986, 15036, 15086, 15136,
+        15186, 15253, 15329, 15405, 15481, 15558, 15634, 15710, 15786, 15863,
+        15942, 16025, 16109, 16193, 16276, 16360, 16444, 16527, 16611, 16684
+    },
+    // 42 mm/s
+    {
+         5709,  5923,  6137,  6341,  6514,  6686,  6859,  7032,  7216,  7408,
+         7599,  7790,  7982,  8173,  8364,  8556,  8747,  8919,  9057,  9196,
+         9335,  9474,  9613,  9752,  9891, 10030, 10162, 10272, 10383, 10494,
+        10604, 10715, 10826, 10936, 11047, 11158, 11258, 11359, 11459, 11560,
+        11661, 11761, 11862, 11962, 12063, 12144, 12219, 12293, 12368, 12443,
+        12517, 12592, 12667, 12741, 12816, 12892, 12967, 13042, 13117, 13193,
+        13268, 13343, 13419, 13490, 13550, 13609, 13669, 13729, 13788, 13848,
+        13908, 13967, 14027, 14096, 14166, 14235, 14305, 14374, 14443, 14513,
+        14582, 14651, 14704, 14754, 14805, 14855, 14906, 14956, 15006, 15057,
+        15107, 15173, 15248, 15323, 15398, 15473, 15548, 15624, 15699, 15774,
+        15852, 15934, 16016, 16099, 16181, 16264, 16346, 16428, 16511, 16583
+    },
+    // 43 mm/s
+    {
+         5705,  5913,  6122,  6321,  6492,  6663,  6833,  7004,  7186,  7375,
+         7564,  7753,  7942,  8131,  8320,  8509,  8698,  8868,  9005,  9143,
+         9281,  9419,  9556,  9694,  9832,  9970, 10101, 10211, 10322, 10432,
+        10543, 10653, 10764, 10874, 10985, 11095, 11195, 11295, 11394, 11494,
+        11594, 11693, 11793, 11893, 11992, 12073, 12148, 12222, 12297, 12371,
+        12446, 12520, 12595, 12669, 12744, 12819, 12895, 12970, 13045, 13121,
+        13196, 13271, 13346, 13418, 13477, 13536, 13596, 13655, 13714, 13773,
+        13833, 13892, 13951, 14020, 14089, 14157, 14226, 14295, 14363, 14432,
+        14500, 14569, 14622, 14673, 14723, 14774, 14825, 14876, 14926, 14977,
+        15028, 15093, 15167, 15241, 15315, 15389, 15463, 15537, 15611, 15685,
+        15762, 15843, 15924, 16005, 16086, 16167, 16249, 16330, 16411, 16482
+    },
+    // 44 mm/s
+    {
+         5700,  5904,  6107,  6301,  6470,  6639,  6807,  6976,  7156,  7342,
+         7529,  7716,  7902,  8089,  8275,  8462,  8649,  8817,  8953,  9090,
+         9226,  9363,  9500,  9636,  9773,  9909, 10039, 10150, 10260, 10370,
+        10481, 10591, 10702, 10812, 10922, 11033, 11131, 11230, 11329, 11428,
+        11527, 11626, 11724, 11823, 11922, 12003, 12077, 12151, 12225, 12300,
+        12374, 12448, 12523, 12597, 12672, 12747, 12822, 12898, 12973, 13048,
+        13124, 13199, 13274, 13345, 13404, 13463, 13522, 13581, 13640, 13699,
+        13758, 13817, 13876, 13944, 14012, 14079, 14147, 14215, 14283, 14351,
+        14419, 14487, 14540, 14591, 14642, 14693, 14744, 14795, 14846, 14897,
+        14948, 15013, 15086, 15159, 15232, 15305, 15377, 15450, 15523, 15596,
+        15672, 15751, 15831, 15911, 15991, 16071, 16151, 16231, 16311, 16381
+    },
+    // 45 mm/s
+    {
+         5696,  5894,  6092,  6282,  6448,  6615,  6781,  6948,  7125,  7310,
+         7494,  7678,  7863,  8047,  8231,  8415,  8600,  8766,  8901,  9037,
+         9172,  9307,  9443,  9578,  9714,  9849,  9978, 10089, 10199, 10309,
+        10419, 10529, 10639, 10750, 10860, 10970, 11068, 11166, 11264, 11362,
+        11460, 11558, 11656, 11754, 11852, 11932, 12006, 12080, 12154, 12228,
+        12302, 12377, 12451, 12525, 12600, 12675, 12750, 12825, 12901, 12976,
+        13051, 13127, 13202, 13273, 13332, 13390, 13449, 13507, 13566, 13624,
+        13683, 13742, 13800, 13867, 13934, 14001, 14069, 14136, 14203, 14270,
+        14337, 14404, 14458, 14509, 14561, 14612, 14663, 14715, 14766, 14818,
+        14869, 14933, 15005, 15077, 15149, 15220, 15292, 15364, 15435, 15507,
+        15582, 15660, 15739, 15818, 15896, 15975, 16054, 16132, 16211, 16280
+    },
+    // 46 mm/s
+    {
+         5692,  5884,  6077,  6262,  6426,  6591,  6755,  6920,  7095,  7277,
+         7459,  7641,  7823,  8005,  8187,  8369,  8551,  8715,  8849,  8983,
+         9118,  9252,  9386,  9520,  9655,  9789,  9917, 10027, 10137, 10247,
+        10357, 10467, 10577, 10687, 10797, 10907, 11004, 11102, 11199, 11296,
+        11393, 11490, 11587, 11684, 11782, 11861, 11935, 12009, 12083, 12157,
+        12231, 12305, 12379, 12453, 12527, 12603, 12678, 12753, 12828, 12904,
+        12979, 13054, 13130, 13201, 13259, 13317, 13375, 13433, 13492, 13550,
+        13608, 13666, 13724, 13791, 13857, 13924, 13990, 14056, 14123, 14189,
+        14255, 14322, 14375, 14427, 14479, 14531, 14583, 14635, 14686, 14738,
+        14790, 14854, 14924, 14995, 15065, 15136, 15207, 15277, 15348, 15418,
+        15491, 15569, 15646, 15724, 15801, 15879, 15956, 16034, 16111, 16179
+    },
+    // 47 mm/s
+    {
+         5687,  5874,  6061,  6242,  6405,  6567,  6729,  6892,  7065,  7244,
+         7424,  7604,  7783,  7963,  8142,  8322,  8502,  8664,  8797,  8930,
+         9063,  9196,  9329,  9463,  9596,  9729,  9856,  9966, 10076, 10186,
+        10296, 10405, 10515, 10625, 10735, 10845, 10941, 11037, 11134, 11230,
+        11326, 11422, 11519, 11615, 11711, 11791, 11864, 11938, 12012, 12086,
+        12159, 12233, 12307, 12380, 12455, 12530, 12606, 12681, 12756, 12831,
+        12907, 12982, 13057, 13128, 13186, 13244, 13302, 13360, 13417, 13475,
+        13533, 13591, 13649, 13714, 13780, 13846, 13911, 13977, 14043, 14108,
+        14174, 14239, 14293, 14345, 14398, 14450, 14502, 14554, 14606, 14659,
+        14711, 14774, 14843, 14913, 14982, 15052, 15121, 15190, 15260, 15329,
+        15401, 15478, 15554, 15630, 15706, 15782, 15859, 15935, 16011, 16078
+    },
+    // 48 mm/s
+    {
+         5683,  5865,  6046,  6222,  6383,  6543,  6703,  6863,  7034,  7212,
+         7389,  7566,  7743,  7921,  8098,  8275,  8452,  8613,  8745,  8877,
+         9009,  9141,  9273,  9405,  9537,  9669,  9795,  9905, 10014, 10124,
+        10234, 10343, 10453, 10563, 10672, 10782, 10878, 10973, 11068, 11164,
+        11259, 11355, 11450, 11546, 11641, 11720, 11794, 11867, 11941, 12014,
+        12088, 12161, 12235, 12308, 12383, 12458, 12533, 12609, 12684, 12759,
+        12834, 12910, 12985, 13056, 13113, 13171, 13228, 13286, 13343, 13401,
+        13458, 13516, 13573, 13638, 13703, 13768, 13833, 13898, 13962, 14027,
+        14092, 14157, 14211, 14264, 14316, 14369, 14421, 14474, 14526, 14579,
+        14632, 14694, 14762, 14831, 14899, 14967, 15036, 15104, 15172, 15241,
+        15311, 15386, 15461, 15536, 15611, 15686, 15761, 15836, 15911, 15977
+    },
+    // 49 mm/s
+    {
+         5679,  5855,  6031,  6203,  6361,  6519,  6677,  6835,  7004,  7179,
+         7354,  7529,  7704,  7879,  8054,  8228,  8403,  8562,  8693,  8823,
+         8954,  9085,  9216,  9347,  9478,  9609,  9734,  9844,  9953, 10063,
+        10172, 10282, 10391, 10501, 10610, 10720, 10814, 10909, 11003, 11098,
+        11192, 11287, 11382, 11476, 11571, 11649, 11723, 11796, 11869, 11943,
+        12016, 12089, 12163, 12236, 12310, 12386, 12461, 12536, 12612, 12687,
+        12762, 12838, 12913, 12984, 13041, 13098, 13155, 13212, 13269, 13326,
+        13383, 13440, 13498, 13562, 13626, 13690, 13754, 13818, 13882, 13946,
+        14011, 14075, 14129, 14182, 14235, 14288, 14341, 14394, 14446, 14499,
+        14552, 14614, 14681, 14749, 14816, 14883, 14950, 15017, 15084, 15152,
+        15221, 15295, 15369, 15442, 15516, 15590, 15664, 15737, 15811, 15876
+    },
+    // 50 mm/s
+    {
+         5675,  5845,  6016,  6183,  6339,  6495,  6651,  6807,  6974,  7146,
+         7319,  7491,  7664,  7837,  8009,  8182,  8354,  8511,  8641,  8770,
+         8900,  9030,  9159,  9289,  9419,  9548,  9673,  9782,  9892, 10001,
+        10110, 10220, 10329, 10438, 10548, 10657, 10751, 10844, 10938, 11032,
+        11126, 11219, 11313, 11407, 11500, 11579, 11652, 11725, 11798, 11871,
+        11944, 12018, 12091, 12164, 12238, 12313, 12389, 12464, 12539, 12615,
+        12690, 12765, 12841, 12911, 12968, 13025, 13081, 13138, 13195, 13252,
+        13308, 13365, 13422, 13485, 13549, 13612, 13675, 13739, 13802, 13866,
+        13929, 13992, 14047, 14100, 14153, 14207, 14260, 14313, 14367, 14420,
+        14473, 14534, 14600, 14666, 14732, 14799, 14865, 14931, 14997, 15063,
+        15131, 15204, 15276, 15349, 15421, 15494, 15566, 15639, 15711, 15774
+    },
+    // 51 mm/s
+    {
+         5670,  5836,  6001,  6163,  6317,  6471,  6625,  6779,  6943,  7114,
+         7284,  7454,  7624,  7795,  7965,  8135,  8305,  8460,  8588,  8717,
+         8846,  8974,  9103,  9231,  9360,  9488,  9612,  9721,  9830,  9939,
+        10049, 10158, 10267, 10376, 10485, 10594, 10687, 10780, 10873, 10966,
+        11059, 11151, 11244, 11337, 11430, 11508, 11581, 11654, 11727, 11800,
+        11873, 11946, 12019, 12092, 12166, 12241, 12317, 12392, 12467, 12542,
+        12618, 12693, 12768, 12839, 12895, 12952, 13008, 13064, 13121, 13177,
+        13234, 13290, 13346, 13409, 13472, 13534, 13597, 13659, 13722, 13785,
+        13847, 13910, 13965, 14018, 14072, 14126, 14179, 14233, 14287, 14340,
+        14394, 14455, 14519, 14584, 14649, 14714, 14779, 14844, 14909, 14974,
+        15041, 15112, 15184, 15255, 15326, 15397, 15469, 15540, 15611, 15673
+    },
+    // 52 mm/s
+    {
+         5666,  5826,  5986,  6144,  6295,  6447,  6599,  6751,  6913,  7081,
+         7249,  7417,  7585,  7753,  7920,  8088,  8256,  8409,  8536,  8664,
+         8791,  8919,  9046,  9173,  9301,  9428,  9551,  9660,  9769,  9878,
+         9987, 10096, 10205, 10314, 10423, 10532, 10624, 10716, 10808, 10900,
+        10992, 11084, 11176, 11268, 11360, 11437, 11510, 11583, 11656, 11729,
+        11801, 11874, 11947, 12020, 12094, 12169, 12244, 12320, 12395, 12470,
+        12545, 12621, 12696, 12766, 12823, 12879, 12935, 12991, 13047, 13103,
+        13159, 13215, 13271, 13333, 13394, 13456, 13518, 13580, 13642, 13704,
+        13766, 13827, 13882, 13936, 13991, 14045, 14099, 14153, 14207, 14261,
+        14315, 14375, 14439, 14502, 14566, 14630, 14694, 14757, 14821, 14885,
+        14951, 15021, 15091, 15161, 15231, 15301, 15371, 15441, 15511, 15572
+    },
+    // 53 mm/s
+    {
+         5662,  5816,  5971,  6124,  6274,  6423,  6573,  6723,  6883,  7048,
+         7214,  7379,  7545,  7710,  7876,  8042,  8207,  8358,  8484,  8610,
+         8737,  8863,  8989,  9115,  9242,  9368,  9490,  9599,  9707,  9816,
+         9925, 10034, 10143, 10251, 10360, 10469, 10560, 10651, 10743, 10834,
+        10925, 11016, 11107, 11198, 11289, 11367, 11439, 11512, 11585, 11657,
+        11730, 11802, 11875, 11947, 12021, 12097, 12172, 12247, 12323, 12398,
+        12473, 12548, 12624, 12694, 12750, 12805, 12861, 12917, 12972, 13028,
+        13084, 13139, 13195, 13256, 13317, 13378, 13440, 13501, 13562, 13623,
+        13684, 13745, 13800, 13855, 13909, 13963, 14018, 14072, 14127, 14181,
+        14235, 14295, 14358, 14420, 14483, 14545, 14608, 14671, 14733, 14796,
+        14861, 14930, 14999, 15067, 15136, 15205, 15274, 15342, 15411, 15471
+    },
+    // 54 mm/s
+    {
+         5658,  5807,  5955,  6104,  6252,  6400,  6547,  6695,  6852,  7016,
+         7179,  7342,  7505,  7668,  7832,  7995,  8158,  8307,  8432,  8557,
+         8682,  8807,  8932,  9058,  9183,  9308,  9429,  9537,  9646,  9755,
+         9863,  9972, 10081, 10189, 10298, 10406, 10497, 10587, 10677, 10768,
+        10858, 10948, 11039, 11129, 11219, 11296, 11368, 11441, 11513, 11586,
+        11658, 11731, 11803, 11875, 11949, 12024, 12100, 12175, 12250, 12326,
+        12401, 12476, 12551, 12622, 12677, 12732, 12788, 12843, 12898, 12954,
+        13009, 13064, 13119, 13180, 13240, 13301, 13361, 13421, 13482, 13542,
+        13602, 13663, 13718, 13773, 13828, 13882, 13937, 13992, 14047, 14101,
+        14156, 14215, 14277, 14338, 14400, 14461, 14523, 14584, 14646, 14707,
+        14771, 14838, 14906, 14974, 15041, 15109, 15176, 15244, 15311, 15370
+    },
+    // 55 mm/s
+    {
+         5653,  5797,  5940,  6084,  6230,  6376,  6521,  6667,  6822,  6983,
+         7144,  7305,  7466,  7626,  7787,  7948,  8109,  8256,  8380,  8504,
+         8628,  8752,  8876,  9000,  9124,  9248,  9368,  9476,  9585,  9693,
+         9802,  9910, 10018, 10127, 10235, 10344, 10433, 10523, 10612, 10702,
+        10791, 10881, 10970, 11059, 11149, 11225, 11298, 11370, 11442, 11514,
+        11586, 11659, 11731, 11803, 11877, 11952, 12027, 12103, 12178, 12253,
+        12329, 12404, 12479, 12549, 12604, 12659, 12714, 12769, 12824, 12879,
+        12934, 12989, 13044, 13103, 13163, 13223, 13282, 13342, 13401, 13461,
+        13521, 13580, 13636, 13691, 13746, 13801, 13856, 13912, 13967, 14022,
+        14077, 14135, 14196, 14256, 14316, 14377, 14437, 14498, 14558, 14618,
+        14681, 14747, 14813, 14880, 14946, 15012, 15079, 15145, 15211, 15269
+    },
+    // 56 mm/s
+    {
+         5649,  5787,  5925,  6065,  6208,  6352,  6495,  6639,  6792,  6950,
+         7109,  7267,  7426,  7584,  7743,  7901,  8060,  8205,  8328,  8451,
+         8573,  8696,  8819,  8942,  9065,  9187,  9307,  9415,  9523,  9632,
+         9740,  9848,  9956, 10065, 10173, 10281, 10370, 10458, 10547, 10636,
+        10724, 10813, 10901, 10990, 11079, 11155, 11227, 11299, 11371, 11443,
+        11515, 11587, 11659, 11731, 11805, 11880, 11955, 12031, 12106, 12181,
+        12256, 12332, 12407, 12477, 12532, 12586, 12641, 12695, 12750, 12804,
+        12859, 12914, 12968, 13027, 13086, 13145, 13204, 13262, 13321, 13380,
+        13439, 13498, 13554, 13609, 13665, 13720, 13776, 13831, 13887, 13942,
+        13998, 14056, 14115, 14174, 14233, 14292, 14352, 14411, 14470, 14529,
+        14591, 14656, 14721, 14786, 14851, 14916, 14981, 15046, 15111, 15168
+    },
+    // 57 mm/s
+    {
+         5645,  5777,  5910,  6045,  6186,  6328,  6469,  6611,  6761,  6918,
+         7074,  7230,  7386,  7542,  7698,  7855,  8011,  8154,  8276,  8397,
+         8519,  8641,  8762,  8884,  9006,  9127,  9246,  9354,  9462,  9570,
+         9678,  9786,  9894, 10002, 10111, 10219, 10306, 10394, 10482, 10570,
+        10657, 10745, 10833, 10921, 11008, 11084, 11156, 11228, 11300, 11371,
+        11443, 11515, 11587, 11659, 11732, 11808, 11883, 11958, 12034, 12109,
+        12184, 12259, 12335, 12405, 12459, 12513, 12567, 12622, 12676, 12730,
+        12784, 12838, 12893, 12951, 13009, 13067, 13125, 13183, 13241, 13299,
+        13357, 13416, 13472, 13527, 13583, 13639, 13695, 13751, 13807, 13863,
+        13918, 13976, 14034, 14092, 14150, 14208, 14266, 14324, 14382, 14440,
+        14501, 14565, 14628, 14692, 14756, 14820, 14884, 14947, 15011, 15067
+    },
+    // 58 mm/s
+    {
+         5641,  5768,  5895,  6025,  6165,  6304,  6443,  6583,  6731,  6885,
+         7039,  7193,  7346,  7500,  7654,  7808,  7962,  8103,  8224,  8344,
+         8465,  8585,  8706,  8826,  8947,  9067,  9184,  9292,  9400,  9508,
+         9616,  9724,  9832,  9940, 10048, 10156, 10243, 10330, 10417, 10504,
+        10590, 10677, 10764, 10851, 10938, 11013, 11085, 11157, 11228, 11300,
+        11372, 11443, 11515, 11587, 11660, 11735, 11811, 11886, 11961, 12037,
+        12112, 12187, 12262, 12332, 12386, 12440, 12494, 12548, 12602, 12655,
+        12709, 12763, 12817, 12874, 12932, 12989, 13046, 13104, 13161, 13218,
+        13276, 13333, 13389, 13446, 13502, 13558, 13614, 13671, 13727, 13783,
+        13839, 13896, 13953, 14010, 14067, 14124, 14181, 14238, 14295, 14352,
+        14411, 14473, 14536, 14598, 14661, 14724, 14786, 14849, 14911, 14966
+    },
+    // 59 mm/s
+    {
+         5636,  5758,  5880,  6006,  6143,  6280,  6417,  6555,  6701,  6852,
+         7004,  7155,  7307,  7458,  7610,  7761,  7913,  8052,  8172,  8291,
+         8410,  8530,  8649,  8768,  8888,  9007,  9123,  9231,  9339,  9447,
+         9555,  9662,  9770,  9878,  9986, 10093, 10179, 10266, 10352, 10438,
+        10524, 10610, 10696, 10782, 10868, 10943, 11014, 11086, 11157, 11229,
+        11300, 11372, 11443, 11514, 11588, 11663, 11738, 11814, 11889, 11964,
+        12040, 12115, 12190, 12260, 12313, 12367, 12420, 12474, 12527, 12581,
+        12634, 12688, 12741, 12798, 12854, 12911, 12968, 13024, 13081, 13138,
+        13194, 13251, 13307, 13364, 13420, 13477, 13534, 13590, 13647, 13703,
+        13760, 13816, 13872, 13928, 13984, 14039, 14095, 14151, 14207, 14263,
+        14321, 14382, 14443, 14505, 14566, 14627, 14689, 14750, 14811, 14865
+    },
+    // 60 mm/s
+    {
+         5632,  5748,  5865,  5986,  6121,  6256,  6391,  6526,  6670,  6820,
+         6969,  7118,  7267,  7416,  7565,  7715,  7864,  8001,  8119,  8238,
+         8356,  8474,  8592,  8710,  8829,  8947,  9062,  9170,  9278,  9385,
+         9493,  9600,  9708,  9816,  9923, 10031, 10116, 10201, 10286, 10372,
+        10457, 10542, 10627, 10712, 10797, 10872, 10943, 11015, 11086, 11157,
+        11229, 11300, 11371, 11442, 11516, 11591, 11666, 11741, 11817, 11892,
+        11967, 12043, 12118, 12188, 12241, 12294, 12347, 12400, 12453, 12506,
+        12559, 12612, 12666, 12721, 12777, 12833, 12889, 12945, 13001, 13057,
+        13112, 13168, 13225, 13282, 13339, 13396, 13453, 13510, 13567, 13624,
+        13681, 13736, 13791, 13846, 13900, 13955, 14010, 14064, 14119, 14174,
+        14231, 14291, 14351, 14411, 14471, 14531, 14591, 14651, 14711, 14764
+    },
+    // 61 mm/s
+    {
+         5628,  5739,  5850,  5966,  6099,  6232,  6365,  6498,  6640,  6787,
+         6934,  7080,  7227,  7374,  7521,  7668,  7815,  7950,  8067,  8184,
+         8301,  8418,  8536,  8653,  8770,  8887,  9001,  9109,  9216,  9324,
+         9431,  9538,  9646,  9753,  9861,  9968, 10053, 10137, 10221, 10306,
+        10390, 10474, 10558, 10643, 10727, 10801, 10873, 10944, 11015, 11086,
+        11157, 11228, 11299, 11370, 11443, 11519, 11594, 11669, 11744, 11820,
+        11895, 11970, 12046, 12115, 12168, 12221, 12274, 12326, 12379, 12432,
+        12484, 12537, 12590, 12645, 12700, 12755, 12810, 12866, 12921, 12976,
+        13031, 13086, 13143, 13200, 13258, 13315, 13372, 13430, 13487, 13544,
+        13602, 13657, 13710, 13764, 13817, 13871, 13924, 13978, 14031, 14085,
+        14140, 14199, 14258, 14317, 14376, 14435, 14494, 14552, 14611, 14663
+    },
+    // 62 mm/s
+    {
+         5623,  5729,  5834,  5946,  6077,  6208,  6339,  6470,  6610,  6754,
+         6899,  7043,  7188,  7332,  7477,  7621,  7766,  7899,  8015,  8131,
+         8247,  8363,  8479,  8595,  8711,  8826,  8940,  9047,  9155,  9262,
+         9369,  9477,  9584,  9691,  9798,  9906,  9989, 10073, 10156, 10239,
+        10323, 10406, 10490, 10573, 10657, 10731, 10802, 10873, 10944, 11014,
+        11085, 11156, 11227, 11298, 11371, 11446, 11522, 11597, 11672, 11748,
+        11823, 11898, 11973, 12043, 12095, 12148, 12200, 12252, 12305, 12357,
+        12410, 12462, 12514, 12569, 12623, 12677, 12732, 12786, 12840, 12895,
+        12949, 13004, 13061, 13119, 13176, 13234, 13292, 13349, 13407, 13465,
+        13522, 13577, 13629, 13682, 13734, 13786, 13839, 13891, 13944, 13996,
+        14050, 14108, 14166, 14223, 14281, 14338, 14396, 14454, 14511, 14562
+    },
+    // 63 mm/s
+    {
+         5619,  5719,  5819,  5927,  6056,  6184,  6313,  6442,  6579,  6721,
+         6864,  7006,  7148,  7290,  7432,  7574,  7716,  7848,  7963,  8078,
+         8193,  8307,  8422,  8537,  8652,  8766,  8879,  8986,  9093,  9200,
+         9308,  9415,  9522,  9629,  9736,  9843,  9926, 10008, 10091, 10173,
+        10256, 10339, 10421, 10504, 10587, 10660, 10731, 10802, 10872, 10943,
+        11014, 11084, 11155, 11226, 11299, 11374, 11449, 11525, 11600, 11675,
+        11751, 11826, 11901, 11971, 12023, 12075, 12127, 12179, 12231, 12283,
+        12335, 12387, 12439, 12492, 12546, 12600, 12653, 12707, 12760, 12814,
+        12868, 12921, 12979, 13037, 13095, 13153, 13211, 13269, 13327, 13385,
+        13443, 13497, 13548, 13599, 13651, 13702, 13753, 13805, 13856, 13907,
+        13960, 14017, 14073, 14129, 14186, 14242, 14299, 14355, 14411, 14461
+    },
+    // 64 mm/s
+    {
+         5615,  5710,  5804,  5907,  6034,  6160,  6287,  6414,  6549,  6689,
+         6829,  6968,  7108,  7248,  7388,  7528,  7667,  7797,  7911,  8025,
+         8138,  8252,  8365,  8479,  8593,  8706,  8818,  8925,  9032,  9139,
+         9246,  9353,  9460,  9567,  9674,  9780,  9862,  9944, 10026, 10107,
+        10189, 10271, 10353, 10434, 10516, 10590, 10660, 10731, 10801, 10872,
+        10942, 11013, 11083, 11154, 11227, 11302, 11377, 11452, 11528, 11603,
+        11678, 11754, 11829, 11898, 11950, 12002, 12053, 12105, 12156, 12208,
+        12260, 12311, 12363, 12416, 12469, 12522, 12574, 12627, 12680, 12733,
+        12786, 12839, 12896, 12955, 13013, 13072, 13130, 13189, 13247, 13305,
+        13364, 13417, 13467, 13517, 13568, 13618, 13668, 13718, 13768, 13818,
+        13870, 13925, 13981, 14036, 14091, 14146, 14201, 14256, 14311, 14360
+    },
+    // 65 mm/s
+    {
+         5611,  5700,  5789,  5887,  6012,  6137,  6261,  6386,  6519,  6656,
+         6794,  6931,  7069,  7206,  7343,  7481,  7618,  7746,  7859,  7971,
+         8084,  8196,  8309,  8421,  8534,  8646,  8757,  8864,  8971,  9077,
+         9184,  9291,  9398,  9504,  9611,  9718,  9799,  9880,  9961, 10041,
+        10122, 10203, 10284, 10365, 10446, 10519, 10589, 10660, 10730, 10800,
+        10871, 10941, 11011, 11082, 11154, 11230, 11305, 11380, 11455, 11531,
+        11606, 11681, 11757, 11826, 11877, 11928, 11980, 12031, 12082, 12134,
+        12185, 12236, 12287, 12340, 12392, 12444, 12496, 12548, 12600, 12652,
+        12704, 12756, 12814, 12873, 12932, 12991, 13049, 13108, 13167, 13226,
+        13285, 13337, 13386, 13435, 13484, 13533, 13582, 13631, 13680, 13729,
+        13780, 13834, 13888, 13942, 13996, 14050, 14104, 14158, 14211, 14259
+    },
+    // 66 mm/s
+    {
+         5606,  5690,  5774,  5867,  5990,  6113,  6235,  6358,  6488,  6623,
+         6759,  6894,  7029,  7164,  7299,  7434,  7569,  7695,  7807,  7918,
+         8029,  8141,  8252,  8363,  8475,  8586,  8696,  8803,  8909,  9016,
+         9122,  9229,  9335,  9442,  9549,  9655,  9735,  9815,  9895,  9975,
+        10055, 10135, 10216, 10296, 10376, 10448, 10518, 10589, 10659, 10729,
+        10799, 10869, 10939, 11009, 11082, 11157, 11233, 11308, 11383, 11458,
+        11534, 11609, 11684, 11753, 11804, 11855, 11906, 11957, 12008, 12059,
+        12110, 12161, 12212, 12263, 12314, 12366, 12417, 12469, 12520, 12571,
+        12623, 12674, 12732, 12791, 12850, 12910, 12969, 13028, 13087, 13146,
+        13205, 13257, 13305, 13353, 13401, 13449, 13497, 13545, 13593, 13640,
+        13690, 13743, 13795, 13848, 13901, 13953, 14006, 14059, 14111, 14158
+    },
+    // 67 mm/s
+    {
+         5602,  5680,  5759,  5848,  5968,  6089,  6209,  6330,  6458,  6591,
+         6724,  6856,  6989,  7122,  7255,  7387,  7520,  7645,  7755,  7865,
+         7975,  8085,  8195,  8305,  8416,  8526,  8635,  8741,  8848,  8954,
+         9061,  9167,  9273,  9380,  9486,  9593,  9672,  9751,  9830,  9909,
+         9989, 10068, 10147, 10226, 10305, 10378, 10448, 10517, 10587, 10657,
+        10727, 10797, 10867, 10937, 11010, 11085, 11160, 11236, 11311, 11386,
+        11461, 11537, 11612, 11681, 11732, 11782, 11833, 11883, 11934, 11984,
+        12035, 12086, 12136, 12187, 12237, 12288, 12339, 12389, 12440, 12490,
+        12541, 12592, 12650, 12710, 12769, 12829, 12888, 12948, 13007, 13067,
+        13126, 13178, 13224, 13271, 13318, 13365, 13411, 13458, 13505, 13552,
+        13600, 13652, 13703, 13754, 13806, 13857, 13909, 13960, 14011, 14056
+    },
+    // 68 mm/s
+    {
+         5598,  5671,  5744,  5828,  5946,  6065,  6183,  6302,  6428,  6558,
+         6689,  6819,  6949,  7080,  7210,  7341,  7471,  7594,  7703,  7812,
+         7921,  8030,  8139,  8248,  8357,  8466,  8574,  8680,  8786,  8893,
+         8999,  9105,  9211,  9318,  9424,  9530,  9608,  9687,  9765,  9843,
+         9922, 10000, 10078, 10157, 10235, 10307, 10377, 10446, 10516, 10586,
+        10656, 10725, 10795, 10865, 10938, 11013, 11088, 11163, 11239, 11314,
+        11389, 11464, 11540, 11609, 11659, 11709, 11759, 11810, 11860, 11910,
+        11960, 12010, 12061, 12110, 12160, 12210, 12260, 12310, 12360, 12409,
+        12459, 12509, 12568, 12628, 12688, 12747, 12807, 12867, 12927, 12987,
+        13047, 13098, 13143, 13189, 13235, 13280, 13326, 13371, 13417, 13463,
+        13510, 13560, 13610, 13661, 13711, 13761, 13811, 13861, 13912, 13955
+    },
+    // 69 mm/s
+    {
+         5594,  5661,  5729,  5808,  5925,  6041,  6157,  6274,  6397,  6525,
+         6654,  6782,  6910,  7038,  7166,  7294,  7422,  7543,  7650,  7758,
+         7866,  7974,  8082,  8190,  8298,  8405,  8513,  8619,  8725,  8831,
+         8937,  9043,  9149,  9255,  9361,  9467,  9545,  9622,  9700,  9777,
+         9855,  9932, 10010, 10087, 10165, 10236, 10306, 10375, 10445, 10515,
+        10584, 10654, 10723, 10793, 10865, 10941, 11016, 11091, 11166, 11242,
+        11317, 11392, 11468, 11536, 11586, 11636, 11686, 11736, 11786, 11835,
+        11885, 11935, 11985, 12034, 12083, 12132, 12181, 12230, 12279, 12329,
+        12378, 12427, 12486, 12546, 12606, 12666, 12727, 12787, 12847, 12907,
+        12968, 13018, 13063, 13107, 13151, 13196, 13240, 13285, 13329, 13374,
+        13420, 13469, 13518, 13567, 13616, 13665, 13714, 13763, 13812, 13854
+    },
+    // 70 mm/s
+    {
+         5589,  5651,  5713,  5789,  5903,  6017,  6131,  6246,  6367,  6493,
+         6618,  6744,  6870,  6996,  7122,  7247,  7373,  7492,  7598,  7705,
+         7812,  7918,  8025,  8132,  8238,  8345,  8452,  8558,  8663,  8769,
+         8875,  8981,  9087,  9193,  9299,  9405,  9481,  9558,  9635,  9711,
+         9788,  9865,  9941, 10018, 10094, 10166, 10235, 10304, 10374, 10443,
+        10513, 10582, 10651, 10721, 10793, 10868, 10944, 11019, 11094, 11169,
+        11245, 11320, 11395, 11464, 11514, 11563, 11612, 11662, 11711, 11761,
+        11810, 11860, 11909, 11958, 12006, 12054, 12103, 12151, 12199, 12248,
+        12296, 12344, 12403, 12464, 12525, 12585, 12646, 12707, 12767, 12828,
+        12888, 12938, 12982, 13025, 13068, 13112, 13155, 13198, 13242, 13285,
+        13330, 13378, 13425, 13473, 13521, 13568, 13616, 13664, 13712, 13753
+    },
+    // 71 mm/s
+    {
+         5585,  5642,  5698,  5769,  5881,  5993,  6105,  6217,  6337,  6460,
+         6583,  6707,  6830,  6954,  7077,  7201,  7324,  7441,  7546,  7652,
+         7757,  7863,  7968,  8074,  8179,  8285,  8391,  8496,  8602,  8708,
+         8814,  8919,  9025,  9131,  9236,  9342,  9418,  9494,  9570,  9645,
+         9721,  9797,  9873,  9948, 10024, 10095, 10164, 10233, 10303, 10372,
+        10441, 10510, 10579, 10649, 10721, 10796, 10871, 10947, 11022, 11097,
+        11172, 11248, 11323, 11392, 11441, 11490, 11539, 11588, 11637, 11686,
+        11735, 11785, 11834, 11881, 11929, 11976, 12024, 12072, 12119, 12167,
+        12214, 12262, 12321, 12382, 12443, 12504, 12565, 12626, 12687, 12748,
+        12809, 12858, 12901, 12943, 12985, 13027, 13069, 13112, 13154, 13196,
+        13240, 13286, 13333, 13379, 13426, 13472, 13519, 13565, 13612, 13652
+    },
+    // 72 mm/s
+    {
+         5581,  5632,  5683,  5749,  5859,  5969,  6079,  6189,  6306,  6427,
+         6548,  6670,  6791,  6912,  7033,  7154,  7275,  7390,  7494,  7599,
+         7703,  7807,  7912,  8016,  8120,  8225,  8330,  8435,  8541,  8646,
+         8752,  8857,  8963,  9068,  9174,  9280,  9355,  9429,  9504,  9579,
+         9654,  9729,  9804,  9879,  9954, 10024, 10093, 10162, 10231, 10300,
+        10369, 10438, 10507, 10576, 10648, 10724, 10799, 10874, 10950, 11025,
+        11100, 11175, 11251, 11319, 11368, 11417, 11466, 11514, 11563, 11612,
+        11661, 11709, 11758, 11805, 11852, 11899, 11945, 11992, 12039, 12086,
+        12133, 12180, 12239, 12301, 12362, 12423, 12485, 12546, 12607, 12669,
+        12730, 12779, 12820, 12861, 12902, 12943, 12984, 13025, 13066, 13107,
+        13150, 13195, 13240, 13285, 13331, 13376, 13421, 13466, 13512, 13551
+    },
+    // 73 mm/s
+    {
+         5577,  5622,  5668,  5729,  5837,  5945,  6053,  6161,  6276,  6395,
+         6513,  6632,  6751,  6870,  6988,  7107,  7226,  7339,  7442,  7545,
+         7648,  7752,  7855,  7958,  8061,  8165,  8268,  8374,  8479,  8585,
+         8690,  8795,  8901,  9006,  9112,  9217,  9291,  9365,  9439,  9513,
+         9587,  9661,  9735,  9809,  9884,  9954, 10022, 10091, 10160, 10229,
+        10298, 10367, 10435, 10504, 10576, 10652, 10727, 10802, 10877, 10953,
+        11028, 11103, 11178, 11247, 11295, 11344, 11392, 11440, 11489, 11537,
+        11586, 11634, 11682, 11728, 11775, 11821, 11867, 11913, 11959, 12005,
+        12051, 12097, 12157, 12219, 12280, 12342, 12404, 12466, 12527, 12589,
+        12651, 12699, 12739, 12779, 12819, 12859, 12898, 12938, 12978, 13018,
+        13060, 13104, 13148, 13192, 13236, 13280, 13324, 13368, 13412, 13450
+    },
+    // 74 mm/s
+    {
+         5572,  5613,  5653,  5710,  5816,  5921,  6027,  6133,  6246,  6362,
+         6478,  6595,  6711,  6828,  6944,  7060,  7177,  7288,  7390,  7492,
+         7594,  7696,  7798,  7900,  8002,  8105,  8207,  8313,  8418,  8523,
+         8628,  8734,  8839,  8944,  9049,  9154,  9228,  9301,  9374,  9447,
+         9520,  9594,  9667,  9740,  9813,  9883,  9952, 10020, 10089, 10158,
+        10226, 10295, 10363, 10432, 10504, 10579, 10655, 10730, 10805, 10880,
+        10956, 11031, 11106, 11175, 11223, 11271, 11319, 11367, 11415, 11463,
+        11511, 11559, 11607, 11652, 11697, 11743, 11788, 11833, 11879, 11924,
+        11969, 12015, 12075, 12137, 12199, 12261, 12323, 12385, 12447, 12509,
+        12572, 12619, 12658, 12697, 12735, 12774, 12813, 12852, 12891, 12929,
+        12970, 13012, 13055, 13098, 13141, 13183, 13226, 13269, 13312, 13349
+    },
+    // 75 mm/s
+    {
+         5568,  5603,  5638,  5690,  5794,  5898,  6001,  6105,  6215,  6329,
+         6443,  6557,  6672,  6786,  6900,  7014,  7128,  7237,  7338,  7439,
+         7540,  7641,  7742,  7842,  7943,  8044,  8146,  8251,  8356,  8461,
+         8567,  8672,  8777,  8882,  8987,  9092,  9164,  9236,  9309,  9381,
+         9454,  9526,  9598,  9671,  9743,  9812,  9881,  9949, 10018, 10086,
+        10155, 10223, 10291, 10360, 10432, 10507, 10582, 10658, 10733, 10808,
+        10883, 10959, 11034, 11102, 11150, 11198, 11245, 11293, 11340, 11388,
+        11436, 11483, 11531, 11576, 11620, 11665, 11709, 11754, 11799, 11843,
+        11888, 11932, 11993, 12055, 12118, 12180, 12242, 12305, 12367, 12430,
+        12492, 12539, 12577, 12615, 12652, 12690, 12728, 12765, 12803, 12840,
+        12880, 12921, 12963, 13004, 13046, 13087, 13129, 13170, 13212, 13248
+    },
+    // 76 mm/s
+    {
+         5560,  5597,  5633,  5686,  5787,  5889,  5991,  6093,  6201,  6314,
+         6426,  6539,  6651,  6764,  6876,  6989,  7101,  7209,  7310,  7411,
+         7512,  7613,  7714,  7815,  7916,  8017,  8119,  8224,  8328,  8433,
+         8538,  8642,  8747,  8852,  8956,  9061,  9132,  9203,  9274,  9345,
+         9416,  9487,  9558,  9629,  9700,  9769,  9837,  9906,  9974, 10042,
+        10110, 10179, 10247, 10315, 10387, 10462, 10537, 10612, 10687, 10762,
+        10837, 10912, 10987, 11056, 11103, 11150, 11197, 11244, 11292, 11339,
+        11386, 11433, 11480, 11525, 11570, 11615, 11659, 11704, 11749, 11793,
+        11838, 11883, 11943, 12005, 12067, 12129, 12191, 12253, 12315, 12377,
+        12439, 12486, 12524, 12563, 12601, 12640, 12678, 12717, 12755, 12794,
+        12833, 12874, 12915, 12955, 12996, 13037, 13077, 13118, 13159, 13194
+    },
+    // 77 mm/s
+    {
+         5553,  5590,  5628,  5681,  5781,  5881,  5981,  6080,  6187,  6298,
+         6409,  6520,  6631,  6742,  6852,  6963,  7074,  7182,  7283,  7384,
+         7485,  7586,  7687,  7788,  7889,  7990,  8091,  8196,  8300,  8404,
+         8509,  8613,  8717,  8822,  8926,  9031,  9100,  9170,  9240,  9309,
+         9379,  9449,  9518,  9588,  9658,  9726,  9794,  9862,  9930,  9998,
+        10066, 10134, 10202, 10270, 10342, 10416, 10491, 10566, 10641, 10716,
+        10791, 10866, 10941, 11009, 11056, 11102, 11149, 11196, 11243, 11289,
+        11336, 11383, 11430, 11475, 11519, 11564, 11609, 11654, 11699, 11744,
+        11789, 11833, 11893, 11954, 12016, 12077, 12139, 12200, 12262, 12323,
+        12385, 12432, 12472, 12511, 12550, 12590, 12629, 12669, 12708, 12747,
+        12787, 12827, 12866, 12906, 12946, 12986, 13026, 13066, 13106, 13140
+    },
+    // 78 mm/s
+    {
+         5545,  5584,  5623,  5677,  5775,  5872,  5970,  6068,  6173,  6282,
+         6392,  6501,  6610,  6720,  6829,  6938,  7048,  7154,  7255,  7356,
+         7457,  7558,  7659,  7760,  7861,  7962,  8064,  8168,  8272,  8376,
+         8480,  8584,  8688,  8792,  8896,  9000,  9068,  9137,  9205,  9273,
+         9342,  9410,  9478,  9547,  9615,  9683,  9751,  9818,  9886,  9954,
+        10022, 10090, 10157, 10225, 10296, 10371, 10446, 10521, 10595, 10670,
+        10745, 10820, 10895, 10962, 11009, 11055, 11101, 11147, 11194, 11240,
+        11286, 11333, 11379, 11424, 11469, 11514, 11559, 11604, 11649, 11694,
+        11739, 11784, 11843, 11904, 11965, 12026, 12087, 12148, 12209, 12270,
+        12331, 12379, 12419, 12459, 12500, 12540, 12580, 12620, 12660, 12701,
+        12740, 12779, 12818, 12857, 12896, 12936, 12975, 13014, 13053, 13087
+    },
+    // 79 mm/s
+    {
+         5537,  5578,  5618,  5673,  5768,  5864,  5960,  6056,  6159,  6267,
+         6374,  6482,  6590,  6698,  6805,  6913,  7021,  7126,  7227,  7328,
+         7429,  7530,  7631,  7733,  7834,  7935,  8036,  8140,  8244,  8347,
+         8451,  8555,  8658,  8762,  8866,  8969,  9036,  9103,  9170,  9237,
+         9304,  9371,  9438,  9505,  9572,  9640,  9707,  9775,  9842,  9910,
+         9978, 10045, 10113, 10180, 10251, 10326, 10401, 10475, 10550, 10624,
+        10699, 10773, 10848, 10916, 10961, 11007, 11053, 11099, 11145, 11191,
+        11237, 11282, 11328, 11373, 11419, 11464, 11509, 11554, 11599, 11644,
+        11689, 11735, 11793, 11854, 11914, 11975, 12035, 12096, 12156, 12217,
+        12277, 12325, 12367, 12408, 12449, 12490, 12531, 12572, 12613, 12654,
+        12694, 12732, 12770, 12809, 12847, 12885, 12923, 12961, 13000, 13033
+    },
+    // 80 mm/s
+    {
+         5530,  5571,  5613,  5668,  5762,  5856,  5949,  6043,  6145,  6251,
+         6357,  6463,  6569,  6676,  6782,  6888,  6994,  7098,  7200,  7301,
+         7402,  7503,  7604,  7705,  7806,  7907,  8009,  8112,  8215,  8319,
+         8422,  8525,  8629,  8732,  8835,  8939,  9004,  9070,  9136,  9201,
+         9267,  9333,  9398,  9464,  9530,  9596,  9664,  9731,  9799,  9866,
+         9933, 10001, 10068, 10135, 10206, 10281, 10355, 10429, 10504, 10578,
+        10653, 10727, 10802, 10869, 10914, 10960, 11005, 11051, 11096, 11141,
+        11187, 11232, 11278, 11323, 11368, 11413, 11459, 11504, 11549, 11595,
+        11640, 11685, 11743, 11803, 11863, 11923, 11983, 12043, 12103, 12163,
+        12223, 12272, 12314, 12356, 12398, 12440, 12482, 12524, 12565, 12607,
+        12648, 12685, 12722, 12760, 12797, 12834, 12872, 12909, 12947, 12979
+    },
+    // 81 mm/s
+    {
+         5522,  5565,  5608,  5664,  5756,  5847,  5939,  6031,  6131,  6235,
+         6340,  6444,  6549,  6654,  6758,  6863,  6967,  7071,  7172,  7273,
+         7374,  7475,  7576,  7678,  7779,  7880,  7981,  8084,  8187,  8290,
+         8393,  8496,  8599,  8702,  8805,  8908,  8972,  9037,  9101,  9165,
+         9230,  9294,  9358,  9423,  9487,  9553,  9620,  9688,  9755,  9822,
+         9889,  9956, 10023, 10090, 10161, 10235, 10310, 10384, 10458, 10532,
+        10607, 10681, 10755, 10822, 10867, 10912, 10957, 11002, 11047, 11092,
+        11137, 11182, 11227, 11272, 11318, 11363, 11409, 11454, 11499, 11545,
+        11590, 11636, 11693, 11753, 11812, 11872, 11931, 11991, 12050, 12110,
+        12170, 12219, 12261, 12304, 12347, 12390, 12432, 12475, 12518, 12561,
+        12601, 12638, 12674, 12711, 12747, 12784, 12820, 12857, 12893, 12925
+    },
+    // 82 mm/s
+    {
+         5514,  5559,  5604,  5660,  5749,  5839,  5929,  6018,  6116,  6219,
+         6322,  6426,  6529,  6632,  6735,  6838,  6941,  7043,  7144,  7245,
+         7347,  7448,  7549,  7650,  7751,  7852,  7954,  8056,  8159,  8262,
+         8364,  8467,  8570,  8672,  8775,  8877,  8940,  9003,  9066,  9129,
+         9192,  9255,  9318,  9381,  9444,  9510,  9577,  9644,  9711,  9778,
+         9845,  9912,  9979, 10046, 10116, 10190, 10264, 10338, 10412, 10486,
+        10561, 10635, 10709, 10775, 10820, 10865, 10909, 10954, 10998, 11043,
+        11087, 11132, 11176, 11222, 11267, 11313, 11358, 11404, 11450, 11495,
+        11541, 11586, 11643, 11702, 11762, 11821, 11880, 11939, 11998, 12057,
+        12116, 12165, 12209, 12252, 12296, 12340, 12383, 12427, 12471, 12514,
+        12555, 12591, 12626, 12662, 12698, 12733, 12769, 12805, 12840, 12872
+    },
+    // 83 mm/s
+    {
+         5507,  5553,  5599,  5655,  5743,  5831,  5918,  6006,  6102,  6204,
+         6305,  6407,  6508,  6610,  6711,  6813,  6914,  7015,  7117,  7218,
+         7319,  7420,  7521,  7623,  7724,  7825,  7926,  8029,  8131,  8233,
+         8335,  8438,  8540,  8642,  8745,  8847,  8908,  8970,  9032,  9093,
+         9155,  9217,  9278,  9340,  9402,  9467,  9534,  9600,  9667,  9734,
+         9800,  9867,  9934, 10001, 10071, 10145, 10219, 10293, 10367, 10441,
+        10514, 10588, 10662, 10729, 10773, 10817, 10861, 10905, 10949, 10993,
+        11037, 11082, 11126, 11171, 11217, 11263, 11308, 11354, 11400, 11445,
+        11491, 11537, 11594, 11652, 11711, 11769, 11828, 11886, 11945, 12003,
+        12062, 12112, 12156, 12201, 12245, 12290, 12334, 12379, 12423, 12468,
+        12508, 12543, 12578, 12613, 12648, 12683, 12718, 12753, 12787, 12818
+    },
+    // 84 mm/s
+    {
+         5499,  5546,  5594,  5651,  5737,  5822,  5908,  5994,  6088,  6188,
+         6288,  6388,  6488,  6588,  6688,  6787,  6887,  6988,  7089,  7190,
+         7291,  7393,  7494,  7595,  7696,  7797,  7899,  8001,  8103,  8205,
+         8307,  8409,  8510,  8612,  8714,  8816,  8877,  8937,  8997,  9057,
+         9118,  9178,  9238,  9299,  9359,  9424,  9490,  9557,  9623,  9690,
+         9756,  9823,  9889,  9956, 10026, 10100, 10173, 10247, 10321, 10395,
+        10468, 10542, 10616, 10682, 10726, 10769, 10813, 10857, 10900, 10944,
+        10988, 11031, 11075, 11121, 11167, 11212, 11258, 11304, 11350, 11396,
+        11441, 11487, 11544, 11602, 11660, 11718, 11776, 11834, 11892, 11950,
+        12008, 12058, 12104, 12149, 12194, 12240, 12285, 12330, 12376, 12421,
+        12462, 12496, 12530, 12564, 12598, 12632, 12666, 12700, 12734, 12764
+    },
+    // 85 mm/s
+    {
+         5491,  5540,  5589,  5647,  5730,  5814,  5897,  5981,  6074,  6172,
+         6271,  6369,  6467,  6566,  6664,  6762,  6861,  6960,  7061,  7163,
+         7264,  7365,  7466,  7568,  7669,  7770,  7871,  7973,  8075,  8176,
+         8278,  8379,  8481,  8582,  8684,  8786,  8845,  8904,  8962,  9021,
+         9080,  9139,  9198,  9257,  9316,  9381,  9447,  9513,  9579,  9646,
+         9712,  9778,  9845,  9911,  9981, 10054, 10128, 10201, 10275, 10349,
+        10422, 10496, 10569, 10635, 10679, 10722, 10765, 10808, 10851, 10895,
+        10938, 10981, 11024, 11070, 11116, 11162, 11208, 11254, 11300, 11346,
+        11392, 11438, 11494, 11551, 11609, 11666, 11724, 11782, 11839, 11897,
+        11954, 12005, 12051, 12097, 12143, 12190, 12236, 12282, 12328, 12374,
+        12416, 12449, 12482, 12515, 12548, 12582, 12615, 12648, 12681, 12710
+    },
+    // 86 mm/s
+    {
+         5484,  5534,  5584,  5642,  5724,  5805,  5887,  5969,  6060,  6157,
+         6253,  6350,  6447,  6544,  6640,  6737,  6834,  6932,  7034,  7135,
+         7236,  7338,  7439,  7540,  7641,  7743,  7844,  7945,  8046,  8148,
+         8249,  8350,  8451,  8553,  8654,  8755,  8813,  8870,  8928,  8985,
+         9043,  9101,  9158,  9216,  9274,  9337,  9404,  9470,  9536,  9602,
+         9668,  9734,  9800,  9866,  9936, 10009, 10082, 10156, 10229, 10303,
+        10376, 10449, 10523, 10589, 10631, 10674, 10717, 10760, 10803, 10845,
+        10888, 10931, 10974, 11020, 11066, 11112, 11158, 11204, 11250, 11296,
+        11342, 11388, 11444, 11501, 11558, 11615, 11672, 11729, 11786, 11843,
+        11901, 11951, 11998, 12045, 12093, 12140, 12187, 12234, 12281, 12328,
+        12369, 12402, 12434, 12466, 12499, 12531, 12564, 12596, 12628, 12657
+    },
+    // 87 mm/s
+    {
+         5476,  5528,  5579,  5638,  5717,  5797,  5877,  5956,  6046,  6141,
+         6236,  6331,  6426,  6522,  6617,  6712,  6807,  6905,  7006,  7107,
+         7209,  7310,  7411,  7513,  7614,  7715,  7816,  7917,  8018,  8119,
+         8220,  8321,  8422,  8523,  8623,  8724,  8781,  8837,  8893,  8949,
+         9006,  9062,  9118,  9175,  9231,  9294,  9360,  9426,  9492,  9558,
+         9623,  9689,  9755,  9821,  9891,  9964, 10037, 10110, 10183, 10257,
+        10330, 10403, 10476, 10542, 10584, 10627, 10669, 10711, 10754, 10796,
+        10838, 10881, 10923, 10969, 11015, 11062, 11108, 11154, 11200, 11246,
+        11293, 11339, 11394, 11451, 11507, 11564, 11620, 11677, 11734, 11790,
+        11847, 11898, 11946, 11994, 12042, 12090, 12137, 12185, 12233, 12281,
+        12323, 12354, 12386, 12418, 12449, 12481, 12512, 12544, 12575, 12603
+    },
+    // 88 mm/s
+    {
+         5468,  5521,  5574,  5633,  5711,  5789,  5866,  5944,  6032,  6125,
+         6219,  6312,  6406,  6500,  6593,  6687,  6781,  6877,  6978,  7080,
+         7181,  7282,  7384,  7485,  7586,  7688,  7789,  7889,  7990,  8091,
+         8191,  8292,  8392,  8493,  8593,  8694,  8749,  8804,  8859,  8914,
+         8968,  9023,  9078,  9133,  9188,  9251,  9317,  9382,  9448,  9514,
+         9579,  9645,  9710,  9776,  9845,  9918,  9992, 10065, 10138, 10211,
+        10284, 10357, 10430, 10495, 10537, 10579, 10621, 10663, 10705, 10747,
+        10788, 10830, 10872, 10919, 10965, 11011, 11058, 11104, 11150, 11197,
+        11243, 11289, 11344, 11400, 11456, 11512, 11569, 11625, 11681, 11737,
+        11793, 11844, 11893, 11942, 11991, 12039, 12088, 12137, 12186, 12234,
+        12276, 12307, 12338, 12369, 12399, 12430, 12461, 12492, 12522, 12549
+    },
+    // 89 mm/s
+    {
+         5460,  5515,  5569,  5629,  5705,  5780,  5856,  5932,  6017,  6110,
+         6202,  6294,  6386,  6478,  6570,  6662,  6754,  6849,  6951,  7052,
+         7153,  7255,  7356,  7458,  7559,  7660,  7761,  7862,  7962,  8062,
+         8162,  8262,  8363,  8463,  8563,  8663,  8717,  8770,  8824,  8878,
+         8931,  8985,  9038,  9092,  9146,  9208,  9273,  9339,  9404,  9470,
+         9535,  9600,  9666,  9731,  9800,  9873,  9946, 10019, 10092, 10165,
+        10238, 10311, 10384, 10449, 10490, 10531, 10573, 10614, 10656, 10697,
+        10739, 10780, 10822, 10868, 10915, 10961, 11007, 11054, 11100, 11147,
+        11193, 11240, 11294, 11350, 11405, 11461, 11517, 11572, 11628, 11684,
+        11739, 11791, 11841, 11890, 11940, 11989, 12039, 12089, 12138, 12188,
+        12230, 12260, 12290, 12320, 12350, 12380, 12409, 12439, 12469, 12495
+    },
+    // 90 mm/s
+    {
+         5453,  5509,  5565,  5625,  5698,  5772,  5846,  5919,  6003,  6094,
+         6184,  6275,  6365,  6456,  6546,  6637,  6727,  6822,  6923,  7025,
+         7126,  7227,  7329,  7430,  7531,  7633,  7734,  7834,  7934,  8033,
+         8133,  8233,  8333,  8433,  8533,  8633,  8685,  8737,  8789,  8842,
+         8894,  8946,  8998,  9051,  9103,  9165,  9230,  9295,  9360,  9426,
+         9491,  9556,  9621,  9686,  9755,  9828,  9901,  9973, 10046, 10119,
+        10192, 10264, 10337, 10402, 10443, 10484, 10525, 10566, 10607, 10648,
+        10689, 10730, 10771, 10817, 10864, 10911, 10957, 11004, 11050, 11097,
+        11144, 11190, 11244, 11299, 11355, 11410, 11465, 11520, 11575, 11630,
+        11685, 11738, 11788, 11839, 11889, 11939, 11990, 12040, 12091, 12141,
+        12184, 12213, 12242, 12271, 12300, 12329, 12358, 12387, 12416, 12442
+    },
+    // 91 mm/s
+    {
+         5445,  5502,  5560,  5620,  5692,  5764,  5835,  5907,  5989,  6078,
+         6167,  6256,  6345,  6434,  6523,  6612,  6700,  6794,  6895,  6997,
+         7098,  7200,  7301,  7403,  7504,  7605,  7706,  7806,  7905,  8005,
+         8104,  8204,  8303,  8403,  8502,  8602,  8653,  8704,  8755,  8806,
+         8857,  8907,  8958,  9009,  9060,  9122,  9187,  9252,  9317,  9381,
+         9446,  9511,  9576,  9641,  9710,  9783,  9855,  9928, 10000, 10073,
+        10146, 10218, 10291, 10355, 10396, 10436, 10477, 10517, 10558, 10599,
+        10639, 10680, 10720, 10767, 10814, 10860, 10907, 10954, 11001, 11047,
+        11094, 11141, 11194, 11249, 11304, 11358, 11413, 11468, 11522, 11577,
+        11632, 11684, 11735, 11787, 11838, 11889, 11941, 11992, 12043, 12095,
+        12137, 12166, 12194, 12222, 12250, 12278, 12307, 12335, 12363, 12388
+    },
+    // 92 mm/s
+    {
+         5437,  5496,  5555,  5616,  5686,  5755,  5825,  5894,  5975,  6062,
+         6150,  6237,  6324,  6412,  6499,  6586,  6674,  6766,  6868,  6969,
+         7071,  7172,  7274,  7375,  7477,  7578,  7679,  7778,  7877,  7976,
+         8076,  8175,  8274,  8373,  8472,  8571,  8621,  8670,  8720,  8770,
+         8819,  8869,  8918,  8968,  9018,  9078,  9143,  9208,  9273,  9337,
+         9402,  9467,  9532,  9596,  9665,  9737,  9810,  9882,  9955, 10027,
+        10099, 10172, 10244, 10309, 10349, 10389, 10429, 10469, 10509, 10549,
+        10589, 10629, 10670, 10716, 10763, 10810, 10857, 10904, 10951, 10998,
+        11044, 11091, 11145, 11199, 11253, 11307, 11361, 11415, 11469, 11524,
+        11578, 11631, 11683, 11735, 11787, 11839, 11892, 11944, 11996, 12048,
+        12091, 12118, 12146, 12173, 12201, 12228, 12255, 12283, 12310, 12334
+    },
+    // 93 mm/s
+    {
+         5430,  5490,  5550,  5612,  5679,  5747,  5814,  5882,  5961,  6047,
+         6132,  6218,  6304,  6390,  6476,  6561,  6647,  6739,  6840,  6942,
+         7043,  7145,  7246,  7348,  7449,  7551,  7651,  7750,  7849,  7948,
+         8047,  8145,  8244,  8343,  8442,  8541,  8589,  8637,  8685,  8734,
+         8782,  8830,  8878,  8927,  8975,  9035,  9100,  9164,  9229,  9293,
+         9358,  9422,  9487,  9552,  9620,  9692,  9764,  9837,  9909,  9981,
+        10053, 10126, 10198, 10262, 10301, 10341, 10381, 10421, 10460, 10500,
+        10540, 10579, 10619, 10666, 10713, 10760, 10807, 10854, 10901, 10948,
+        10995, 11042, 11095, 11148, 11202, 11256, 11309, 11363, 11417, 11470,
+        11524, 11577, 11630, 11683, 11736, 11789, 11842, 11895, 11948, 12001,
+        12045, 12071, 12098, 12124, 12151, 12177, 12204, 12231, 12257, 12280
+    },
+    // 94 mm/s
+    {
+         5422,  5484,  5545,  5607,  5673,  5739,  5804,  5870,  5947,  6031,
+         6115,  6199,  6284,  6368,  6452,  6536,  6620,  6711,  6813,  6914,
+         7016,  7117,  7219,  7320,  7422,  7523,  7624,  7722,  7821,  7919,
+         8018,  8116,  8215,  8313,  8412,  8510,  8557,  8604,  8651,  8698,
+         8745,  8791,  8838,  8885,  8932,  8992,  9056,  9121,  9185,  9249,
+         9314,  9378,  9442,  9507,  9575,  9647,  9719,  9791,  9863,  9935,
+        10007, 10079, 10151, 10215, 10254, 10294, 10333, 10372, 10411, 10450,
+        10490, 10529, 10568, 10615, 10662, 10710, 10757, 10804, 10851, 10898,
+        10945, 10992, 11045, 11098, 11151, 11204, 11258, 11311, 11364, 11417,
+        11470, 11524, 11578, 11632, 11685, 11739, 11793, 11847, 11901, 11955,
+        11998, 12024, 12050, 12075, 12101, 12127, 12153, 12178, 12204, 12227
+    },
+    // 95 mm/s
+    {
+         5414,  5477,  5540,  5603,  5667,  5730,  5794,  5857,  5933,  6015,
+         6098,  6181,  6263,  6346,  6428,  6511,  6594,  6683,  6785,  6886,
+         6988,  7090,  7191,  7293,  7394,  7496,  7596,  7695,  7793,  7891,
+         7989,  8087,  8185,  8283,  8381,  8479,  8525,  8571,  8616,  8662,
+         8707,  8753,  8798,  8844,  8890,  8949,  9013,  9077,  9141,  9205,
+         9269,  9334,  9398,  9462,  9530,  9602,  9673,  9745,  9817,  9889,
+         9961, 10033, 10105, 10168, 10207, 10246, 10285, 10324, 10362, 10401,
+        10440, 10479, 10518, 10565, 10612, 10659, 10707, 10754, 10801, 10848,
+        10896, 10943, 10995, 11048, 11100, 11153, 11206, 11258, 11311, 11364,
+        11416, 11470, 11525, 11580, 11635, 11689, 11744, 11799, 11853, 11908,
+        11952, 11977, 12002, 12026, 12051, 12076, 12101, 12126, 12151, 12173
+    },
+    // 96 mm/s
+    {
+         5407,  5471,  5535,  5599,  5660,  5722,  5783,  5845,  5919,  6000,
+         6081,  6162,  6243,  6324,  6405,  6486,  6567,  6656,  6757,  6859,
+         6960,  7062,  7164,  7265,  7367,  7468,  7569,  7667,  7764,  7862,
+         7960,  8058,  8156,  8253,  8351,  8449,  8493,  8537,  8581,  8626,
+         8670,  8714,  8758,  8803,  8847,  8906,  8970,  9034,  9097,  9161,
+         9225,  9289,  9353,  9417,  9485,  9556,  9628,  9700,  9771,  9843,
+         9915,  9987, 10058, 10122, 10160, 10198, 10237, 10275, 10313, 10352,
+        10390, 10428, 10467, 10514, 10562, 10609, 10656, 10704, 10751, 10799,
+        10846, 10893, 10945, 10997, 11049, 11102, 11154, 11206, 11258, 11310,
+        11363, 11417, 11473, 11528, 11584, 11639, 11695, 11750, 11806, 11862,
+        11905, 11929, 11954, 11978, 12002, 12026, 12050, 12074, 12098, 12119
+    },
+    // 97 mm/s
+    {
+         5399,  5465,  5530,  5594,  5654,  5713,  5773,  5832,  5904,  5984,
+         6063,  6143,  6222,  6302,  6381,  6461,  6540,  6628,  6730,  6831,
+         6933,  7034,  7136,  7238,  7339,  7441,  7541,  7639,  7736,  7834,
+         7931,  8029,  8126,  8223,  8321,  8418,  8461,  8504,  8547,  8590,
+         8633,  8676,  8718,  8761,  8804,  8863,  8926,  8990,  9054,  9117,
+         9181,  9245,  9308,  9372,  9440,  9511,  9583,  9654,  9726,  9797,
+         9869,  9940, 10012, 10075, 10113, 10151, 10189, 10227, 10265, 10302,
+        10340, 10378, 10416, 10464, 10511, 10559, 10606, 10654, 10701, 10749,
+        10796, 10844, 10895, 10947, 10999, 11050, 11102, 11154, 11205, 11257,
+        11309, 11363, 11420, 11476, 11533, 11589, 11646, 11702, 11759, 11815,
+        11859, 11882, 11905, 11929, 11952, 11975, 11998, 12022, 12045, 12065
+    },
+    // 98 mm/s
+    {
+         5391,  5458,  5525,  5590,  5648,  5705,  5763,  5820,  5890,  5968,
+         6046,  6124,  6202,  6280,  6358,  6436,  6514,  6600,  6702,  6804,
+         6905,  7007,  7109,  7210,  7312,  7413,  7514,  7611,  7708,  7805,
+         7902,  7999,  8096,  8193,  8291,  8388,  8429,  8471,  8512,  8554,
+         8595,  8637,  8678,  8720,  8761,  8819,  8883,  8946,  9010,  9073,
+         9137,  9200,  9264,  9327,  9394,  9466,  9537,  9609,  9680,  9751,
+         9823,  9894,  9965, 10028, 10066, 10103, 10141, 10178, 10216, 10253,
+        10291, 10328, 10365, 10413, 10461, 10508, 10556, 10604, 10651, 10699,
+        10747, 10794, 10845, 10896, 10948, 10999, 11050, 11101, 11153, 11204,
+        11255, 11310, 11367, 11425, 11482, 11539, 11596, 11654, 11711, 11768,
+        11813, 11835, 11857, 11880, 11902, 11925, 11947, 11969, 11992, 12012
+    },
+    // 99 mm/s
+    {
+         5384,  5452,  5521,  5586,  5641,  5697,  5752,  5808,  5876,  5953,
+         6029,  6105,  6181,  6258,  6334,  6410,  6487,  6573,  6674,  6776,
+         6878,  6979,  7081,  7183,  7284,  7386,  7486,  7583,  7680,  7777,
+         7873,  7970,  8067,  8164,  8260,  8357,  8397,  8437,  8478,  8518,
+         8558,  8598,  8638,  8679,  8719,  8776,  8840,  8903,  8966,  9029,
+         9092,  9156,  9219,  9282,  9349,  9421,  9492,  9563,  9634,  9705,
+         9777,  9848,  9919,  9982, 10019, 10056, 10093, 10130, 10167, 10204,
+        10241, 10278, 10315, 10363, 10410, 10458, 10506, 10554, 10602, 10649,
+        10697, 10745, 10795, 10846, 10897, 10948, 10998, 11049, 11100, 11150,
+        11201, 11257, 11315, 11373, 11431, 11489, 11547, 11605, 11664, 11722,
+        11766, 11788, 11809, 11831, 11853, 11874, 11896, 11917, 11939, 11958
+    },
+    // 100 mm/s
+    {
+         5376,  5446,  5516,  5581,  5635,  5688,  5742,  5795,  5862,  5937,
+         6012,  6086,  6161,  6236,  6311,  6385,  6460,  6545,  6647,  6748,
+         6850,  6952,  7053,  7155,  7257,  7359,  7459,  7555,  7652,  7748,
+         7844,  7941,  8037,  8134,  8230,  8326,  8365,  8404,  8443,  8482,
+         8521,  8560,  8598,  8637,  8676,  8733,  8796,  8859,  8922,  8985,
+         9048,  9111,  9174,  9237,  9304,  9375,  9446,  9517,  9588,  9659,
+         9730,  9802,  9873,  9935,  9972, 10008, 10045, 10081, 10118, 10154,
+        10191, 10228, 10264, 10312, 10360, 10408, 10456, 10504, 10552, 10600,
+        10648, 10696, 10745, 10796, 10846, 10896, 10946, 10997, 11047, 11097,
+        11147, 11203, 11262, 11321, 11380, 11439, 11498, 11557, 11616, 11675,
+        11720, 11741, 11761, 11782, 11803, 11824, 11844, 11865, 11886, 11904
+    },
+    // 101 mm/s
+    {
+         5369,  5439,  5508,  5574,  5628,  5682,  5736,  5790,  5857,  5931,
+         6006,  6080,  6155,  6230,  6304,  6379,  6454,  6538,  6640,  6742,
+         6844,  6945,  7047,  7149,  7251,  7353,  7453,  7549,  7645,  7741,
+         7837,  7932,  8028,  8124,  8220,  8316,  8355,  8394,  8433,  8472,
+         8511,  8550,  8589,  8628,  8667,  8724,  8787,  8849,  8912,  8975,
+         9038,  9101,  9163,  9226,  9293,  9364,  9435,  9506,  9576,  9647,
+         9718,  9789,  9860,  9922,  9959,  9995, 10032, 10068, 10105, 10141,
+        10178, 10214, 10251, 10299, 10346, 10394, 10442, 10490, 10538, 10586,
+        10634, 10682, 10732, 10782, 10832, 10882, 10933, 10983, 11033, 11083,
+        11133, 11189, 11247, 11306, 11365, 11424, 11482, 11541, 11600, 11658,
+        11703, 11724, 11744, 11765, 11786, 11807, 11828, 11848, 11869, 11887
+    },
+    // 102 mm/s
+    {
+         5362,  5431,  5501,  5567,  5621,  5676,  5730,  5784,  5851,  5926,
+         6000,  6075,  6149,  6223,  6298,  6372,  6447,  6532,  6634,  6735,
+         6837,  6939,  7041,  7143,  7245,  7347,  7447,  7542,  7638,  7733,
+         7829,  7924,  8019,  8115,  8210,  8306,  8345,  8384,  8423,  8462,
+         8501,  8541,  8580,  8619,  8658,  8715,  8777,  8840,  8902,  8965,
+         9028,  9090,  9153,  9215,  9282,  9352,  9423,  9494,  9565,  9635,
+         9706,  9777,  9847,  9909,  9946,  9982, 10019, 10055, 10091, 10128,
+        10164, 10201, 10237, 10285, 10333, 10381, 10429, 10477, 10525, 10573,
+        10621, 10669, 10718, 10769, 10819, 10869, 10919, 10969, 11019, 11069,
+        11119, 11174, 11233, 11291, 11350, 11408, 11466, 11525, 11583, 11642,
+        11686, 11707, 11728, 11748, 11769, 11790, 11811, 11831, 11852, 11870
+    },
+    // 103 mm/s
+    {
+         5354,  5424,  5494,  5560,  5615,  5669,  5724,  5779,  5846,  5920,
+         5994,  6069,  6143,  6217,  6292,  6366,  6440,  6525,  6627,  6729,
+         6831,  6933,  7035,  7137,  7239,  7341,  7441,  7536,  7631,  7726,
+         7821,  7916,  8011,  8105,  8200,  8295,  8335,  8374,  8413,  8452,
+         8492,  8531,  8570,  8610,  8649,  8706,  8768,  8830,  8893,  8955,
+         9017,  9080,  9142,  9204,  9271,  9341,  9412,  9482,  9553,  9623,
+         9694,  9764,  9835,  9897,  9933,  9969, 10006, 10042, 10078, 10115,
+        10151, 10187, 10223, 10271, 10319, 10367, 10415, 10463, 10511, 10559,
+        10607, 10655, 10705, 10755, 10805, 10855, 10905, 10955, 11005, 11055,
+        11105, 11160, 11218, 11276, 11334, 11392, 11451, 11509, 11567, 11625,
+        11669, 11690, 11711, 11732, 11752, 11773, 11794, 11815, 11835, 11854
+    },
+    // 104 mm/s
+    {
+         5347,  5417,  5487,  5553,  5608,  5663,  5718,  5773,  5840,  5914,
+         5989,  6063,  6137,  6211,  6285,  6360,  6434,  6518,  6620,  6723,
+         6825,  6927,  7029,  7131,  7233,  7335,  7435,  7530,  7624,  7718,
+         7813,  7907,  8002,  8096,  8190,  8285,  8324,  8364,  8403,  8443,
+         8482,  8522,  8561,  8600,  8640,  8696,  8758,  8821,  8883,  8945,
+         9007,  9069,  9131,  9193,  9259,  9330,  9400,  9470,  9541,  9611,
+         9681,  9752,  9822,  9884,  9920,  9956,  9993, 10029, 10065, 10101,
+        10137, 10174, 10210, 10258, 10306, 10354, 10402, 10450, 10498, 10546,
+        10594, 10642, 10691, 10741, 10791, 10841, 10891, 10941, 10991, 11040,
+        11090, 11145, 11203, 11261, 11319, 11377, 11435, 11493, 11551, 11609,
+        11653, 11673, 11694, 11715, 11736, 11756, 11777, 11798, 11819, 11837
+    },
+    // 105 mm/s
+    {
+         5340,  5410,  5480,  5546,  5601,  5657,  5712,  5768,  5835,  5909,
+         5983,  6057,  6131,  6205,  6279,  6353,  6427,  6512,  6614,  6716,
+         6818,  6920,  7023,  7125,  7227,  7329,  7429,  7523,  7617,  7711,
+         7805,  7899,  7993,  8087,  8181,  8275,  8314,  8354,  8393,  8433,
+         8472,  8512,  8552,  8591,  8631,  8687,  8749,  8811,  8873,  8935,
+         8997,  9058,  9120,  9182,  9248,  9318,  9388,  9459,  9529,  9599,
+         9669,  9739,  9809,  9871,  9907,  9943,  9980, 10016, 10052, 10088,
+        10124, 10160, 10196, 10244, 10292, 10340, 10388, 10436, 10484, 10532,
+        10580, 10628, 10678, 10728, 10777, 10827, 10877, 10927, 10976, 11026,
+        11076, 11131, 11188, 11246, 11304, 11361, 11419, 11477, 11534, 11592,
+        11636, 11657, 11677, 11698, 11719, 11740, 11760, 11781, 11802, 11820
+    },
+    // 106 mm/s
+    {
+         5333,  5403,  5472,  5539,  5595,  5650,  5706,  5762,  5829,  5903,
+         5977,  6051,  6125,  6199,  6273,  6347,  6421,  6505,  6607,  6710,
+         6812,  6914,  7016,  7119,  7221,  7323,  7423,  7517,  7610,  7704,
+         7797,  7890,  7984,  8077,  8171,  8264,  8304,  8344,  8383,  8423,
+         8463,  8503,  8542,  8582,  8622,  8678,  8740,  8801,  8863,  8925,
+         8986,  9048,  9109,  9171,  9237,  9307,  9377,  9447,  9517,  9587,
+         9657,  9727,  9797,  9858,  9894,  9930,  9967, 10003, 10039, 10075,
+        10111, 10147, 10183, 10231, 10279, 10327, 10375, 10423, 10471, 10519,
+        10567, 10615, 10665, 10714, 10764, 10813, 10863, 10913, 10962, 11012,
+        11062, 11116, 11173, 11231, 11288, 11346, 11403, 11461, 11518, 11575,
+        11619, 11640, 11660, 11681, 11702, 11723, 11744, 11764, 11785, 11803
+    },
+    // 107 mm/s
+    {
+         5326,  5395,  5465,  5532,  5588,  5644,  5700,  5756,  5824,  5897,
+         5971,  6045,  6119,  6193,  6266,  6340,  6414,  6498,  6601,  6703,
+         6805,  6908,  7010,  7113,  7215,  7317,  7417,  7510,  7603,  7696,
+         7789,  7882,  7975,  8068,  8161,  8254,  8294,  8334,  8373,  8413,
+         8453,  8493,  8533,  8573,  8613,  8669,  8730,  8792,  8853,  8914,
+         8976,  9037,  9099,  9160,  9226,  9296,  9365,  9435,  9505,  9575,
+         9645,  9714,  9784,  9846,  9882,  9918,  9953,  9989, 10025, 10061,
+        10097, 10133, 10169, 10217, 10265, 10313, 10361, 10410, 10458, 10506,
+        10554, 10602, 10651, 10701, 10750, 10800, 10849, 10899, 10948, 10998,
+        11047, 11102, 11159, 11216, 11273, 11330, 11387, 11444, 11502, 11559,
+        11602, 11623, 11644, 11664, 11685, 11706, 11727, 11747, 11768, 11786
+    },
+    // 108 mm/s
+    {
+         5318,  5388,  5458,  5525,  5581,  5638,  5694,  5751,  5818,  5892,
+         5965,  6039,  6113,  6186,  6260,  6334,  6407,  6492,  6594,  6697,
+         6799,  6902,  7004,  7106,  7209,  7311,  7411,  7504,  7596,  7689,
+         7781,  7874,  7966,  8059,  8151,  8243,  8284,  8324,  8364,  8404,
+         8444,  8484,  8524,  8564,  8604,  8659,  8721,  8782,  8843,  8904,
+         8966,  9027,  9088,  9149,  9215,  9284,  9354,  9423,  9493,  9563,
+         9632,  9702,  9772,  9833,  9869,  9905,  9940,  9976, 10012, 10048,
+        10084, 10120, 10156, 10204, 10252, 10300, 10348, 10396, 10444, 10492,
+        10540, 10588, 10638, 10687, 10736, 10786, 10835, 10885, 10934, 10984,
+        11033, 11087, 11144, 11201, 11258, 11315, 11371, 11428, 11485, 11542,
+        11585, 11606, 11627, 11648, 11668, 11689, 11710, 11731, 11751, 11770
+    },
+    // 109 mm/s
+    {
+         5311,  5381,  5451,  5517,  5574,  5631,  5688,  5745,  5813,  5886,
+         5960,  6033,  6107,  6180,  6254,  6327,  6401,  6485,  6588,  6690,
+         6793,  6895,  6998,  7100,  7203,  7305,  7405,  7497,  7589,  7681,
+         7773,  7865,  7957,  8049,  8141,  8233,  8273,  8313,  8354,  8394,
+         8434,  8474,  8514,  8554,  8595,  8650,  8711,  8772,  8833,  8894,
+         8955,  9016,  9077,  9138,  9203,  9273,  9342,  9412,  9481,  9551,
+         9620,  9690,  9759,  9820,  9856,  9892,  9927,  9963,  9999, 10035,
+        10071, 10106, 10142, 10190, 10238, 10286, 10335, 10383, 10431, 10479,
+        10527, 10575, 10624, 10673, 10723, 10772, 10821, 10871, 10920, 10969,
+        11019, 11073, 11129, 11186, 11242, 11299, 11356, 11412, 11469, 11525,
+        11569, 11589, 11610, 11631, 11652, 11672, 11693, 11714, 11735, 11753
+    },
+    // 110 mm/s
+    {
+         5304,  5374,  5444,  5510,  5568,  5625,  5682,  5740,  5807,  5881,
+         5954,  6027,  6101,  6174,  6247,  6321,  6394,  6479,  6581,  6684,
+         6786,  6889,  6992,  7094,  7197,  7299,  7399,  7491,  7582,  7674,
+         7765,  7857,  7948,  8040,  8131,  8223,  8263,  8303,  8344,  8384,
+         8424,  8465,  8505,  8545,  8585,  8641,  8702,  8763,  8823,  8884,
+         8945,  9006,  9066,  9127,  9192,  9261,  9331,  9400,  9469,  9539,
+         9608,  9677,  9746,  9807,  9843,  9879,  9914,  9950,  9986, 10022,
+        10057, 10093, 10129, 10177, 10225, 10273, 10321, 10369, 10417, 10465,
+        10513, 10561, 10611, 10660, 10709, 10758, 10807, 10857, 10906, 10955,
+        11004, 11058, 11114, 11171, 11227, 11283, 11340, 11396, 11452, 11509,
+        11552, 11573, 11593, 11614, 11635, 11656, 11676, 11697, 11718, 11736
+    },
+    // 111 mm/s
+    {
+         5297,  5367,  5436,  5503,  5561,  5619,  5676,  5734,  5802,  5875,
+         5948,  6021,  6095,  6168,  6241,  6314,  6388,  6472,  6575,  6677,
+         6780,  6883,  6985,  7088,  7191,  7294,  7393,  7484,  7575,  7666,
+         7757,  7848,  7939,  8030,  8121,  8212,  8253,  8293,  8334,  8374,
+         8415,  8455,  8496,  8536,  8576,  8632,  8692,  8753,  8813,  8874,
+         8935,  8995,  9056,  9116,  9181,  9250,  9319,  9388,  9457,  9526,
+         9596,  9665,  9734,  9794,  9830,  9866,  9901,  9937,  9973, 10008,
+        10044, 10080, 10115, 10163, 10211, 10259, 10308, 10356, 10404, 10452,
+        10500, 10548, 10597, 10646, 10695, 10744, 10794, 10843, 10892, 10941,
+        10990, 11044, 11100, 11156, 11212, 11268, 11324, 11380, 11436, 11492,
+        11535, 11556, 11576, 11597, 11618, 11639, 11660, 11680, 11701, 11719
+    },
+    // 112 mm/s
+    {
+         5290,  5359,  5429,  5496,  5554,  5612,  5671,  5729,  5796,  5869,
+         5942,  6015,  6089,  6162,  6235,  6308,  6381,  6465,  6568,  6671,
+         6774,  6876,  6979,  7082,  7185,  7288,  7387,  7478,  7568,  7659,
+         7749,  7840,  7931,  8021,  8112,  8202,  8243,  8283,  8324,  8364,
+         8405,  8446,  8486,  8527,  8567,  8623,  8683,  8743,  8804,  8864,
+         8924,  8984,  9045,  9105,  9170,  9239,  9308,  9376,  9445,  9514,
+         9583,  9652,  9721,  9782,  9817,  9853,  9888,  9924,  9959,  9995,
+        10031, 10066, 10102, 10150, 10198, 10246, 10294, 10342, 10390, 10438,
+        10487, 10535, 10584, 10633, 10682, 10731, 10780, 10829, 10878, 10927,
+        10976, 11029, 11085, 11141, 11196, 11252, 11308, 11364, 11420, 11476,
+        11518, 11539, 11560, 11580, 11601, 11622, 11643, 11663, 11684, 11702
+    },
+    // 113 mm/s
+    {
+         5282,  5352,  5422,  5489,  5548,  5606,  5665,  5723,  5791,  5864,
+         5937,  6010,  6083,  6155,  6228,  6301,  6374,  6459,  6561,  6664,
+         6767,  6870,  6973,  7076,  7179,  7282,  7381,  7471,  7562,  7652,
+         7742,  7832,  7922,  8012,  8102,  8192,  8232,  8273,  8314,  8355,
+         8395,  8436,  8477,  8518,  8558,  8613,  8674,  8734,  8794,  8854,
+         8914,  8974,  9034,  9094,  9159,  9227,  9296,  9365,  9433,  9502,
+         9571,  9640,  9708,  9769,  9804,  9840,  9875,  9911,  9946,  9982,
+        10017, 10053, 10088, 10136, 10184, 10232, 10281, 10329, 10377, 10425,
+        10473, 10521, 10570, 10619, 10668, 10717, 10766, 10815, 10864, 10913,
+        10961, 11015, 11070, 11126, 11181, 11237, 11292, 11348, 11403, 11459,
+        11501, 11522, 11543, 11564, 11584, 11605, 11626, 11647, 11667, 11686
+    },
+    // 114 mm/s
+    {
+         5275,  5345,  5415,  5482,  5541,  5600,  5659,  5718,  5785,  5858,
+         5931,  6004,  6076,  6149,  6222,  6295,  6368,  6452,  6555,  6658,
+         6761,  6864,  6967,  7070,  7173,  7276,  7375,  7465,  7555,  7644,
+         7734,  7823,  7913,  8002,  8092,  8181,  8222,  8263,  8304,  8345,
+         8386,  8427,  8467,  8508,  8549,  8604,  8664,  8724,  8784,  8844,
+         8904,  8963,  9023,  9083,  9147,  9216,  9284,  9353,  9422,  9490,
+         9559,  9627,  9696,  9756,  9792,  9827,  9862,  9898,  9933,  9968,
+        10004, 10039, 10075, 10123, 10171, 10219, 10267, 10315, 10363, 10412,
+        10460, 10508, 10557, 10605, 10654, 10703, 10752, 10801, 10849, 10898,
+        10947, 11000, 11055, 11111, 11166, 11221, 11276, 11332, 11387, 11442,
+        11485, 11505, 11526, 11547, 11568, 11588, 11609, 11630, 11651, 11669
+    },
+    // 115 mm/s
+    {
+         5268,  5338,  5408,  5475,  5534,  5593,  5653,  5712,  5780,  5852,
+         5925,  5998,  6070,  6143,  6216,  6289,  6361,  6445,  6548,  6651,
+         6755,  6858,  6961,  7064,  7167,  7270,  7370,  7459,  7548,  7637,
+         7726,  7815,  7904,  7993,  8082,  8171,  8212,  8253,  8294,  8335,
+         8376,  8417,  8458,  8499,  8540,  8595,  8655,  8714,  8774,  8834,
+         8893,  8953,  9012,  9072,  9136,  9204,  9273,  9341,  9410,  9478,
+         9546,  9615,  9683,  9743,  9779,  9814,  9849,  9885,  9920,  9955,
+         9990, 10026, 10061, 10109, 10157, 10205, 10254, 10302, 10350, 10398,
+        10446, 10494, 10543, 10592, 10641, 10689, 10738, 10787, 10835, 10884,
+        10933, 10985, 11041, 11096, 11151, 11206, 11261, 11316, 11371, 11426,
+        11468, 11489, 11509, 11530, 11551, 11572, 11592, 11613, 11634, 11652
+    },
+    // 116 mm/s
+    {
+         5261,  5331,  5400,  5468,  5527,  5587,  5647,  5707,  5774,  5847,
+         5919,  5992,  6064,  6137,  6209,  6282,  6355,  6439,  6542,  6645,
+         6748,  6851,  6955,  7058,  7161,  7264,  7364,  7452,  7541,  7629,
+         7718,  7806,  7895,  7984,  8072,  8161,  8202,  8243,  8284,  8325,
+         8366,  8408,  8449,  8490,  8531,  8586,  8645,  8705,  8764,  8823,
+         8883,  8942,  9002,  9061,  9125,  9193,  9261,  9330,  9398,  9466,
+         9534,  9602,  9671,  9731,  9766,  9801,  9836,  9871,  9907,  9942,
+         9977, 10012, 10047, 10096, 10144, 10192, 10240, 10288, 10336, 10385,
+        10433, 10481, 10530, 10578, 10627, 10675, 10724, 10773, 10821, 10870,
+        10919, 10971, 11026, 11080, 11135, 11190, 11245, 11299, 11354, 11409,
+        11451, 11472, 11492, 11513, 11534, 11555, 11576, 11596, 11617, 11635
+    },
+    // 117 mm/s
+    {
+         5254,  5323,  5393,  5461,  5521,  5581,  5641,  5701,  5769,  5841,
+         5914,  5986,  6058,  6131,  6203,  6276,  6348,  6432,  6535,  6639,
+         6742,  6845,  6948,  7052,  7155,  7258,  7358,  7446,  7534,  7622,
+         7710,  7798,  7886,  7974,  8062,  8150,  8192,  8233,  8274,  8315,
+         8357,  8398,  8439,  8481,  8522,  8577,  8636,  8695,  8754,  8813,
+         8873,  8932,  8991,  9050,  9114,  9182,  9250,  9318,  9386,  9454,
+         9522,  9590,  9658,  9718,  9753,  9788,  9823,  9858,  9893,  9929,
+         9964,  9999, 10034, 10082, 10130, 10178, 10227, 10275, 10323, 10371,
+        10419, 10468, 10516, 10565, 10613, 10662, 10710, 10759, 10807, 10856,
+        10904, 10956, 11011, 11065, 11120, 11174, 11229, 11283, 11338, 11392,
+        11434, 11455, 11476, 11496, 11517, 11538, 11559, 11579, 11600, 11618
+    },
+    // 118 mm/s
+    {
+         5246,  5316,  5386,  5454,  5514,  5574,  5635,  5695,  5763,  5836,
+         5908,  5980,  6052,  6125,  6197,  6269,  6341,  6425,  6529,  6632,
+         6735,  6839,  6942,  7046,  7149,  7252,  7352,  7439,  7527,  7614,
+         7702,  7790,  7877,  7965,  8052,  8140,  8181,  8223,  8264,  8306,
+         8347,  8389,  8430,  8471,  8513,  8567,  8626,  8685,  8744,  8803,
+         8862,  8921,  8980,  9039,  9102,  9170,  9238,  9306,  9374,  9442,
+         9510,  9578,  9645,  9705,  9740,  9775,  9810,  9845,  9880,  9915,
+         9950,  9985, 10020, 10069, 10117, 10165, 10213, 10261, 10310, 10358,
+        10406, 10454, 10503, 10551, 10599, 10648, 10696, 10745, 10793, 10841,
+        10890, 10942, 10996, 11050, 11105, 11159, 11213, 11267, 11321, 11376,
+        11417, 11438, 11459, 11480, 11500, 11521, 11542, 11563, 11583, 11602
+    },
+    // 119 mm/s
+    {
+         5239,  5309,  5379,  5446,  5507,  5568,  5629,  5690,  5758,  5830,
+         5902,  5974,  6046,  6118,  6191,  6263,  6335,  6419,  6522,  6626,
+         6729,  6832,  6936,  7039,  7143,  7246,  7346,  7433,  7520,  7607,
+         7694,  7781,  7868,  7955,  8042,  8130,  8171,  8213,  8254,  8296,
+         8337,  8379,  8421,  8462,  8504,  8558,  8617,  8676,  8734,  8793,
+         8852,  8911,  8969,  9028,  9091,  9159,  9227,  9294,  9362,  9430,
+         9497,  9565,  9633,  9692,  9727,  9762,  9797,  9832,  9867,  9902,
+         9937,  9972, 10007, 10055, 10103, 10151, 10200, 10248, 10296, 10344,
+        10393, 10441, 10489, 10537, 10586, 10634, 10682, 10731, 10779, 10827,
+        10876, 10927, 10981, 11035, 11089, 11143, 11197, 11251, 11305, 11359,
+        11401, 11421, 11442, 11463, 11484, 11504, 11525, 11546, 11567, 11585
+    },
+    // 120 mm/s
+    {
+         5232,  5302,  5372,  5439,  5501,  5562,  5623,  5684,  5752,  5824,
+         5896,  5968,  6040,  6112,  6184,  6256,  6328,  6412,  6516,  6619,
+         6723,  6826,  6930,  7033,  7137,  7240,  7340,  7426,  7513,  7600,
+         7686,  7773,  7859,  7946,  8033,  8119,  8161,  8203,  8244,  8286,
+         8328,  8370,  8411,  8453,  8495,  8549,  8608,  8666,  8725,  8783,
+         8842,  8900,  8959,  9017,  9080,  9148,  9215,  9283,  9350,  9418,
+         9485,  9553,  9620,  9680,  9714,  9749,  9784,  9819,  9854,  9889,
+         9924,  9958,  9993, 10042, 10090, 10138, 10186, 10234, 10283, 10331,
+        10379, 10427, 10476, 10524, 10572, 10620, 10668, 10717, 10765, 10813,
+        10861, 10913, 10967, 11020, 11074, 11128, 11181, 11235, 11289, 11342,
+        11384, 11405, 11425, 11446, 11467, 11488, 11508, 11529, 11550, 11568
+    },
+    // 121 mm/s
+    {
+         5225,  5295,  5364,  5432,  5494,  5555,  5617,  5679,  5747,  5819,
+         5890,  5962,  6034,  6106,  6178,  6250,  6322,  6405,  6509,  6613,
+         6716,  6820,  6924,  7027,  7131,  7235,  7334,  7420,  7506,  7592,
+         7678,  7764,  7850,  7937,  8023,  8109,  8151,  8193,  8234,  8276,
+         8318,  8360,  8402,  8444,  8486,  8540,  8598,  8656,  8715,  8773,
+         8831,  8889,  8948,  9006,  9069,  9136,  9204,  9271,  9338,  9406,
+         9473,  9540,  9608,  9667,  9702,  9736,  9771,  9806,  9841,  9875,
+         9910,  9945,  9980, 10028, 10076, 10124, 10173, 10221, 10269, 10317,
+        10366, 10414, 10462, 10510, 10558, 10606, 10655, 10703, 10751, 10799,
+        10847, 10898, 10952, 11005, 11059, 11112, 11166, 11219, 11272, 11326,
+        11367, 11388, 11408, 11429, 11450, 11471, 11492, 11512, 11533, 11551
+    },
+    // 122 mm/s
+    {
+         5218,  5287,  5357,  5425,  5487,  5549,  5611,  5673,  5741,  5813,
+         5885,  5956,  6028,  6100,  6172,  6243,  6315,  6399,  6502,  6606,
+         6710,  6814,  6917,  7021,  7125,  7229,  7328,  7413,  7499,  7585,
+         7670,  7756,  7842,  7927,  8013,  8099,  8141,  8183,  8225,  8267,
+         8309,  8351,  8393,  8435,  8477,  8531,  8589,  8647,  8705,  8763,
+         8821,  8879,  8937,  8995,  9058,  9125,  9192,  9259,  9326,  9393,
+         9461,  9528,  9595,  9654,  9689,  9723,  9758,  9793,  9827,  9862,
+         9897,  9932,  9966, 10014, 10063, 10111, 10159, 10208, 10256, 10304,
+        10352, 10401, 10449, 10497, 10545, 10593, 10641, 10689, 10737, 10785,
+        10833, 10884, 10937, 10990, 11043, 11097, 11150, 11203, 11256, 11309,
+        11350, 11371, 11392, 11412, 11433, 11454, 11475, 11495, 11516, 11534
+    },
+    // 123 mm/s
+    {
+         5210,  5280,  5350,  5418,  5480,  5543,  5605,  5668,  5736,  5807,
+         5879,  5951,  6022,  6094,  6165,  6237,  6308,  6392,  6496,  6600,
+         6704,  6807,  6911,  7015,  7119,  7223,  7322,  7407,  7492,  7577,
+         7662,  7748,  7833,  7918,  8003,  8088,  8130,  8172,  8215,  8257,
+         8299,  8341,  8383,  8425,  8468,  8521,  8579,  8637,  8695,  8753,
+         8811,  8868,  8926,  8984,  9046,  9113,  9180,  9247,  9314,  9381,
+         9448,  9515,  9582,  9641,  9676,  9710,  9745,  9780,  9814,  9849,
+         9883,  9918,  9953, 10001, 10049, 10097, 10146, 10194, 10242, 10291,
+        10339, 10387, 10435, 10483, 10531, 10579, 10627, 10675, 10723, 10770,
+        10818, 10869, 10922, 10975, 11028, 11081, 11134, 11187, 11240, 11293,
+        11333, 11354, 11375, 11396, 11416, 11437, 11458, 11479, 11499, 11518
+    },
+    // 124 mm/s
+    {
+         5203,  5273,  5343,  5411,  5474,  5537,  5599,  5662,  5730,  5802,
+         5873,  5945,  6016,  6088,  6159,  6230,  6302,  6385,  6489,  6593,
+         6697,  6801,  6905,  7009,  7113,  7217,  7316,  7401,  7485,  7570,
+         7655,  7739,  7824,  7908,  7993,  8078,  8120,  8162,  8205,  8247,
+         8289,  8332,  8374,  8416,  8458,  8512,  8570,  8627,  8685,  8743,
+         8800,  8858,  8915,  8973,  9035,  9102,  9169,  9236,  9302,  9369,
+         9436,  9503,  9570,  9628,  9663,  9697,  9732,  9767,  9801,  9836,
+         9870,  9905,  9939,  9987, 10036, 10084, 10132, 10181, 10229, 10277,
+        10325, 10374, 10422, 10469, 10517, 10565, 10613, 10661, 10708, 10756,
+        10804, 10855, 10908, 10960, 11013, 11065, 11118, 11171, 11223, 11276,
+        11317, 11337, 11358, 11379, 11400, 11420, 11441, 11462, 11483, 11501
+    },
+    // 125 mm/s
+    {
+         5196,  5266,  5336,  5404,  5467,  5530,  5593,  5657,  5725,  5796,
+         5867,  5939,  6010,  6081,  6153,  6224,  6295,  6379,  6483,  6587,
+         6691,  6795,  6899,  7003,  7107,  7211,  7310,  7394,  7478,  7562,
+         7647,  7731,  7815,  7899,  7983,  8067,  8110,  8152,  8195,  8237,
+         8280,  8322,  8365,  8407,  8449,  8503,  8560,  8618,  8675,  8733,
+         8790,  8847,  8905,  8962,  9024,  9091,  9157,  9224,  9291,  9357,
+         9424,  9490,  9557,  9616,  9650,  9685,  9719,  9753,  9788,  9822,
+         9857,  9891,  9926,  9974, 10022, 10070, 10119, 10167, 10215, 10264,
+        10312, 10360, 10408, 10456, 10504, 10551, 10599, 10647, 10694, 10742,
+        10790, 10840, 10893, 10945, 10997, 11050, 11102, 11155, 11207, 11259,
+        11300, 11321, 11341, 11362, 11383, 11404, 11424, 11445, 11466, 11484
+    },
+    // 126 mm/s
+    {
+         5189,  5259,  5328,  5397,  5460,  5524,  5587,  5651,  5719,  5791,
+         5862,  5933,  6004,  6075,  6146,  6217,  6289,  6372,  6476,  6580,
+         6684,  6789,  6893,  6997,  7101,  7205,  7304,  7388,  7471,  7555,
+         7639,  7722,  7806,  7890,  7973,  8057,  8100,  8142,  8185,  8227,
+         8270,  8313,  8355,  8398,  8440,  8494,  8551,  8608,  8665,  8722,
+         8780,  8837,  8894,  8951,  9013,  9079,  9146,  9212,  9279,  9345,
+         9412,  9478,  9544,  9603,  9637,  9672,  9706,  9740,  9775,  9809,
+         9843,  9878,  9912,  9960, 10009, 10057, 10105, 10154, 10202, 10250,
+        10299, 10347, 10395, 10442, 10490, 10537, 10585, 10633, 10680, 10728,
+        10775, 10826, 10878, 10930, 10982, 11034, 11086, 11138, 11191, 11243,
+        11283, 11304, 11324, 11345, 11366, 11387, 11408, 11428, 11449, 11467
+    },
+    // 127 mm/s
+    {
+         5182,  5251,  5321,  5390,  5454,  5518,  5582,  5645,  5714,  5785,
+         5856,  5927,  5998,  6069,  6140,  6211,  6282,  6365,  6470,  6574,
+         6678,  6782,  6886,  6991,  7095,  7199,  7298,  7381,  7464,  7548,
+         7631,  7714,  7797,  7880,  7964,  8047,  8089,  8132,  8175,  8218,
+         8260,  8303,  8346,  8389,  8431,  8485,  8542,  8598,  8655,  8712,
+         8769,  8826,  8883,  8940,  9002,  9068,  9134,  9200,  9267,  9333,
+         9399,  9466,  9532,  9590,  9624,  9659,  9693,  9727,  9761,  9796,
+         9830,  9864,  9898,  9947,  9995, 10043, 10092, 10140, 10189, 10237,
+        10285, 10334, 10381, 10429, 10476, 10524, 10571, 10619, 10666, 10714,
+        10761, 10811, 10863, 10915, 10967, 11019, 11071, 11122, 11174, 11226,
+        11266, 11287, 11308, 11328, 11349, 11370, 11391, 11411, 11432, 11450
+    },
+    // 128 mm/s
+    {
+         5174,  5244,  5314,  5382,  5447,  5511,  5576,  5640,  5708,  5779,
+         5850,  5921,  5992,  6063,  6134,  6205,  6275,  6359,  6463,  6567,
+         6672,  6776,  6880,  6985,  7089,  7193,  7292,  7375,  7457,  7540,
+         7623,  7706,  7788,  7871,  7954,  8036,  8079,  8122,  8165,  8208,
+         8251,  8294,  8336,  8379,  8422,  8475,  8532,  8589,  8645,  8702,
+         8759,  8816,  8872,  8929,  8990,  9056,  9123,  9189,  9255,  9321,
+         9387,  9453,  9519,  9577,  9612,  9646,  9680,  9714,  9748,  9782,
+         9817,  9851,  9885,  9933,  9982, 10030, 10078, 10127, 10175, 10223,
+        10272, 10320, 10368, 10415, 10462, 10510, 10557, 10605, 10652, 10699,
+        10747, 10797, 10848, 10900, 10952, 11003, 11055, 11106, 11158, 11209,
+        11249, 11270, 11291, 11312, 11332, 11353, 11374, 11395, 11415, 11434
+    },
+    // 129 mm/s
+    {
+         5167,  5237,  5307,  5375,  5440,  5505,  5570,  5634,  5703,  5774,
+         5844,  5915,  5986,  6057,  6127,  6198,  6269,  6352,  6457,  6561,
+         6665,  6770,  6874,  6978,  7083,  7187,  7286,  7368,  7451,  7533,
+         7615,  7697,  7779,  7862,  7944,  8026,  8069,  8112,  8155,  8198,
+         8241,  8284,  8327,  8370,  8413,  8466,  8523,  8579,  8636,  8692,
+         8749,  8805,  8861,  8918,  8979,  9045,  9111,  9177,  9243,  9309,
+         9375,  9441,  9507,  9565,  9599,  9633,  9667,  9701,  9735,  9769,
+         9803,  9837,  9871,  9920,  9968, 10017, 10065, 10113, 10162, 10210,
+        10258, 10307, 10354, 10401, 10449, 10496, 10543, 10591, 10638, 10685,
+        10733, 10782, 10834, 10885, 10936, 10988, 11039, 11090, 11141, 11193,
+        11233, 11253, 11274, 11295, 11316, 11336, 11357, 11378, 11399, 11417
+    },
+    // 130 mm/s
+    {
+         5160,  5230,  5300,  5368,  5433,  5499,  5564,  5629,  5697,  5768,
+         5839,  5909,  5980,  6050,  6121,  6192,  6262,  6346,  6450,  6555,
+         6659,  6763,  6868,  6972,  7077,  7181,  7280,  7362,  7444,  7525,
+         7607,  7689,  7770,  7852,  7934,  8016,  8059,  8102,  8145,  8188,
+         8231,  8275,  8318,  8361,  8404,  8457,  8513,  8569,  8626,  8682,
+         8738,  8794,  8851,  8907,  8968,  9034,  9099,  9165,  9231,  9297,
+         9362,  9428,  9494,  9552,  9586,  9620,  9654,  9688,  9722,  9756,
+         9790,  9824,  9858,  9906,  9955, 10003, 10051, 10100, 10148, 10197,
+        10245, 10293, 10341, 10388, 10435, 10482, 10529, 10577, 10624, 10671,
+        10718, 10768, 10819, 10870, 10921, 10972, 11023, 11074, 11125, 11176,
+        11216, 11237, 11257, 11278, 11299, 11320, 11340, 11361, 11382, 11400
+    },
+    // 131 mm/s
+    {
+         5153,  5223,  5292,  5361,  5427,  5492,  5558,  5623,  5692,  5762,
+         5833,  5903,  5974,  6044,  6115,  6185,  6256,  6339,  6443,  6548,
+         6653,  6757,  6862,  6966,  7071,  7175,  7274,  7355,  7437,  7518,
+         7599,  7680,  7762,  7843,  7924,  8005,  8049,  8092,  8135,  8178,
+         8222,  8265,  8308,  8352,  8395,  8448,  8504,  8560,  8616,  8672,
+         8728,  8784,  8840,  8896,  8957,  9022,  9088,  9153,  9219,  9285,
+         9350,  9416,  9481,  9539,  9573,  9607,  9641,  9675,  9709,  9743,
+         9776,  9810,  9844,  9893,  9941,  9990, 10038, 10086, 10135, 10183,
+        10231, 10280, 10327, 10374, 10421, 10468, 10516, 10563, 10610, 10657,
+        10704, 10753, 10804, 10855, 10906, 10956, 11007, 11058, 11109, 11159,
+        11199, 11220, 11240, 11261, 11282, 11303, 11324, 11344, 11365, 11383
+    },
+    // 132 mm/s
+    {
+         5146,  5215,  5285,  5354,  5420,  5486,  5552,  5618,  5686,  5757,
+         5827,  5897,  5968,  6038,  6108,  6179,  6249,  6332,  6437,  6542,
+         6646,  6751,  6856,  6960,  7065,  7170,  7268,  7349,  7430,  7510,
+         7591,  7672,  7753,  7833,  7914,  7995,  8038,  8082,  8125,  8169,
+         8212,  8256,  8299,  8342,  8386,  8439,  8494,  8550,  8606,  8662,
+         8718,  8773,  8829,  8885,  8946,  9011,  9076,  9142,  9207,  9273,
+         9338,  9403,  9469,  9526,  9560,  9594,  9628,  9662,  9695,  9729,
+         9763,  9797,  9831,  9879,  9928,  9976, 10024, 10073, 10121, 10170,
+        10218, 10266, 10314, 10361, 10408, 10455, 10502, 10549, 10596, 10643,
+        10690, 10739, 10789, 10840, 10890, 10941, 10991, 11042, 11092, 11143,
+        11182, 11203, 11224, 11244, 11265, 11286, 11307, 11327, 11348, 11366
+    },
+    // 133 mm/s
+    {
+         5138,  5208,  5278,  5347,  5413,  5480,  5546,  5612,  5681,  5751,
+         5821,  5892,  5962,  6032,  6102,  6172,  6242,  6326,  6430,  6535,
+         6640,  6745,  6849,  6954,  7059,  7164,  7262,  7343,  7423,  7503,
+         7583,  7664,  7744,  7824,  7904,  7985,  8028,  8072,  8115,  8159,
+         8202,  8246,  8290,  8333,  8377,  8429,  8485,  8541,  8596,  8652,
+         8707,  8763,  8818,  8874,  8934,  9000,  9065,  9130,  9195,  9260,
+         9326,  9391,  9456,  9513,  9547,  9581,  9615,  9648,  9682,  9716,
+         9750,  9783,  9817,  9866,  9914,  9963, 10011, 10059, 10108, 10156,
+        10205, 10253, 10300, 10347, 10394, 10441, 10488, 10535, 10582, 10628,
+        10675, 10724, 10775, 10825, 10875, 10925, 10975, 11026, 11076, 11126,
+        11165, 11186, 11207, 11228, 11248, 11269, 11290, 11311, 11331, 11350
+    },
+    // 134 mm/s
+    {
+         5131,  5201,  5271,  5340,  5407,  5473,  5540,  5607,  5675,  5746,
+         5816,  5886,  5956,  6026,  6096,  6166,  6236,  6319,  6424,  6529,
+         6633,  6738,  6843,  6948,  7053,  7158,  7256,  7336,  7416,  7496,
+         7575,  7655,  7735,  7815,  7894,  7974,  8018,  8062,  8105,  8149,
+         8193,  8237,  8280,  8324,  8368,  8420,  8476,  8531,  8586,  8642,
+         8697,  8752,  8808,  8863,  8923,  8988,  9053,  9118,  9183,  9248,
+         9313,  9378,  9443,  9501,  9534,  9568,  9602,  9635,  9669,  9703,
+         9736,  9770,  9804,  9852,  9901,  9949,  9997, 10046, 10094, 10143,
+        10191, 10240, 10287, 10333, 10380, 10427, 10474, 10521, 10567, 10614,
+        10661, 10710, 10760, 10810, 10860, 10910, 10960, 11010, 11060, 11110,
+        11149, 11169, 11190, 11211, 11232, 11252, 11273, 11294, 11315, 11333
+    },
+    // 135 mm/s
+    {
+         5124,  5194,  5264,  5333,  5400,  5467,  5534,  5601,  5670,  5740,
+         5810,  5880,  5950,  6020,  6089,  6159,  6229,  6312,  6417,  6522,
+         6627,  6732,  6837,  6942,  7047,  7152,  7250,  7330,  7409,  7488,
+         7567,  7647,  7726,  7805,  7885,  7964,  8008,  8052,  8095,  8139,
+         8183,  8227,  8271,  8315,  8359,  8411,  8466,  8521,  8576,  8631,
+         8687,  8742,  8797,  8852,  8912,  8977,  9042,  9107,  9171,  9236,
+         9301,  9366,  9431,  9488,  9522,  9555,  9589,  9622,  9656,  9689,
+         9723,  9757,  9790,  9839,  9887,  9936,  9984, 10032, 10081, 10129,
+        10178, 10226, 10273, 10320, 10367, 10413, 10460, 10507, 10553, 10600,
+        10647, 10695, 10745, 10795, 10844, 10894, 10944, 10994, 11043, 11093,
+        11132, 11153, 11173, 11194, 11215, 11236, 11256, 11277, 11298, 11316
+    },
+    // 136 mm/s
+    {
+         5117,  5187,  5256,  5326,  5393,  5461,  5528,  5596,  5664,  5734,
+         5804,  5874,  5944,  6013,  6083,  6153,  6223,  6306,  6411,  6516,
+         6621,  6726,  6831,  6936,  7041,  7146,  7244,  7323,  7402,  7481,
+         7560,  7638,  7717,  7796,  7875,  7954,  7998,  8042,  8086,  8130,
+         8174,  8218,  8262,  8306,  8350,  8402,  8457,  8512,  8566,  8621,
+         8676,  8731,  8786,  8841,  8901,  8965,  9030,  9095,  9159,  9224,
+         9289,  9354,  9418,  9475,  9509,  9542,  9576,  9609,  9643,  9676,
+         9710,  9743,  9777,  9825,  9874,  9922,  9970, 10019, 10067, 10116,
+        10164, 10213, 10260, 10306, 10353, 10399, 10446, 10493, 10539, 10586,
+        10632, 10681, 10730, 10780, 10829, 10879, 10928, 10977, 11027, 11076,
+        11115, 11136, 11156, 11177, 11198, 11219, 11240, 11260, 11281, 11299
+    },
+    // 137 mm/s
+    {
+         5110,  5179,  5249,  5319,  5386,  5454,  5522,  5590,  5659,  5729,
+         5798,  5868,  5938,  6007,  6077,  6146,  6216,  6299,  6404,  6509,
+         6614,  6720,  6825,  6930,  7035,  7140,  7238,  7317,  7395,  7473,
+         7552,  7630,  7708,  7787,  7865,  7943,  7987,  8031,  8076,  8120,
+         8164,  8208,  8252,  8296,  8341,  8393,  8447,  8502,  8557,  8611,
+         8666,  8721,  8775,  8830,  8889,  8954,  9019,  9083,  9148,  9212,
+         9277,  9341,  9406,  9462,  9496,  9529,  9563,  9596,  9629,  9663,
+         9696,  9730,  9763,  9812,  9860,  9909,  9957, 10006, 10054, 10102,
+        10151, 10199, 10246, 10293, 10339, 10386, 10432, 10479, 10525, 10572,
+        10618, 10666, 10715, 10765, 10814, 10863, 10912, 10961, 11010, 11060,
+        11098, 11119, 11140, 11160, 11181, 11202, 11223, 11243, 11264, 11282
+    },
+    // 138 mm/s
+    {
+         5102,  5172,  5242,  5311,  5380,  5448,  5516,  5584,  5653,  5723,
+         5792,  5862,  5931,  6001,  6070,  6140,  6209,  6292,  6398,  6503,
+         6608,  6713,  6818,  6924,  7029,  7134,  7232,  7310,  7388,  7466,
+         7544,  7622,  7699,  7777,  7855,  7933,  7977,  8021,  8066,  8110,
+         8154,  8199,  8243,  8287,  8331,  8383,  8438,  8492,  8547,  8601,
+         8656,  8710,  8764,  8819,  8878,  8943,  9007,  9071,  9136,  9200,
+         9264,  9329,  9393,  9450,  9483,  9516,  9550,  9583,  9616,  9650,
+         9683,  9716,  9750,  9798,  9847,  9895,  9944,  9992, 10041, 10089,
+        10138, 10186, 10233, 10279, 10325, 10372, 10418, 10465, 10511, 10557,
+        10604, 10652, 10701, 10750, 10798, 10847, 10896, 10945, 10994, 11043,
+        11081, 11102, 11123, 11144, 11164, 11185, 11206, 11227, 11247, 11266
+    },
+    // 139 mm/s
+    {
+         5095,  5165,  5235,  5304,  5373,  5442,  5510,  5579,  5648,  5717,
+         5787,  5856,  5925,  5995,  6064,  6134,  6203,  6286,  6391,  6496,
+         6602,  6707,  6812,  6918,  7023,  7128,  7226,  7304,  7381,  7458,
+         7536,  7613,  7690,  7768,  7845,  7922,  7967,  8011,  8056,  8100,
+         8145,  8189,  8234,  8278,  8322,  8374,  8428,  8483,  8537,  8591,
+         8645,  8699,  8754,  8808,  8867,  8931,  8995,  9060,  9124,  9188,
+         9252,  9316,  9380,  9437,  9470,  9503,  9537,  9570,  9603,  9636,
+         9670,  9703,  9736,  9784,  9833,  9882,  9930,  9979, 10027, 10076,
+        10124, 10173, 10219, 10265, 10312, 10358, 10404, 10451, 10497, 10543,
+        10589, 10637, 10686, 10735, 10783, 10832, 10880, 10929, 10978, 11026,
+        11065, 11085, 11106, 11127, 11148, 11168, 11189, 11210, 11231, 11249
+    },
+    // 140 mm/s
+    {
+         5088,  5158,  5228,  5297,  5366,  5435,  5504,  5573,  5643,  5712,
+         5781,  5850,  5919,  5989,  6058,  6127,  6196,  6279,  6384,  6490,
+         6595,  6701,  6806,  6911,  7017,  7122,  7221,  7297,  7374,  7451,
+         7528,  7605,  7682,  7758,  7835,  7912,  7957,  8001,  8046,  8090,
+         8135,  8180,  8224,  8269,  8313,  8365,  8419,  8473,  8527,  8581,
+         8635,  8689,  8743,  8797,  8856,  8920,  8984,  9048,  9112,  9176,
+         9240,  9304,  9368,  9424,  9457,  9490,  9524,  9557,  9590,  9623,
+         9656,  9689,  9722,  9771,  9820,  9868,  9917,  9965, 10014, 10062,
+        10111, 10159, 10206, 10252, 10298, 10344, 10390, 10437, 10483, 10529,
+        10575, 10623, 10671, 10719, 10768, 10816, 10865, 10913, 10961, 11010,
+        11048, 11069, 11089, 11110, 11131, 11152, 11172, 11193, 11214, 11232
+    },
+    // 141 mm/s
+    {
+         5081,  5151,  5220,  5290,  5360,  5429,  5498,  5568,  5637,  5706,
+         5775,  5844,  5913,  5982,  6052,  6121,  6190,  6272,  6378,  6483,
+         6589,  6694,  6800,  6905,  7011,  7116,  7215,  7291,  7367,  7444,
+         7520,  7596,  7673,  7749,  7825,  7902,  7946,  7991,  8036,  8081,
+         8125,  8170,  8215,  8260,  8304,  8356,  8410,  8463,  8517,  8571,
+         8625,  8678,  8732,  8786,  8845,  8908,  8972,  9036,  9100,  9164,
+         9228,  9291,  9355,  9411,  9444,  9477,  9510,  9544,  9577,  9610,
+         9643,  9676,  9709,  9757,  9806,  9855,  9903,  9952, 10000, 10049,
+        10097, 10146, 10192, 10238, 10284, 10330, 10377, 10423, 10469, 10515,
+        10561, 10608, 10656, 10704, 10753, 10801, 10849, 10897, 10945, 10993,
+        11031, 11052, 11072, 11093, 11114, 11135, 11156, 11176, 11197, 11215
+    },
+    // 142 mm/s
+    {
+         5074,  5143,  5213,  5283,  5353,  5423,  5492,  5562,  5632,  5700,
+         5769,  5838,  5907,  5976,  6045,  6114,  6183,  6266,  6371,  6477,
+         6583,  6688,  6794,  6899,  7005,  7110,  7209,  7284,  7360,  7436,
+         7512,  7588,  7664,  7740,  7816,  7891,  7936,  7981,  8026,  8071,
+         8116,  8161,  8205,  8250,  8295,  8347,  8400,  8454,  8507,  8561,
+         8614,  8668,  8721,  8775,  8833,  8897,  8961,  9024,  9088,  9152,
+         9215,  9279,  9343,  9399,  9432,  9464,  9497,  9530,  9563,  9596,
+         9629,  9662,  9695,  9744,  9792,  9841,  9890,  9938,  9987, 10035,
+        10084, 10132, 10179, 10225, 10271, 10317, 10363, 10409, 10455, 10501,
+        10547, 10594, 10642, 10689, 10737, 10785, 10833, 10881, 10929, 10976,
+        11014, 11035, 11056, 11076, 11097, 11118, 11139, 11159, 11180, 11198
+    },
+    // 143 mm/s
+    {
+         5066,  5136,  5206,  5276,  5346,  5416,  5487,  5557,  5626,  5695,
+         5764,  5832,  5901,  5970,  6039,  6108,  6177,  6259,  6365,  6470,
+         6576,  6682,  6788,  6893,  6999,  7105,  7203,  7278,  7353,  7429,
+         7504,  7580,  7655,  7730,  7806,  7881,  7926,  7971,  8016,  8061,
+         8106,  8151,  8196,  8241,  8286,  8337,  8391,  8444,  8497,  8551,
+         8604,  8657,  8711,  8764,  8822,  8886,  8949,  9013,  9076,  9140,
+         9203,  9266,  9330,  9386,  9419,  9452,  9484,  9517,  9550,  9583,
+         9616,  9649,  9682,  9730,  9779,  9828,  9876,  9925,  9973, 10022,
+        10070, 10119, 10165, 10211, 10257, 10303, 10349, 10395, 10440, 10486,
+        10532, 10579, 10627, 10674, 10722, 10770, 10817, 10865, 10912, 10960,
+        10997, 11018, 11039, 11060, 11080, 11101, 11122, 11143, 11163, 11182
+    },
+    // 144 mm/s
+    {
+         5059,  5129,  5199,  5269,  5339,  5410,  5481,  5551,  5621,  5689,
+         5758,  5827,  5895,  5964,  6033,  6101,  6170,  6252,  6358,  6464,
+         6570,  6676,  6781,  6887,  6993,  7099,  7197,  7272,  7346,  7421,
+         7496,  7571,  7646,  7721,  7796,  7871,  7916,  7961,  8006,  8051,
+         8096,  8142,  8187,  8232,  8277,  8328,  8381,  8434,  8487,  8540,
+         8594,  8647,  8700,  8753,  8811,  8874,  8938,  9001,  9064,  9127,
+         9191,  9254,  9317,  9373,  9406,  9439,  9471,  9504,  9537,  9570,
+         9603,  9635,  9668,  9717,  9765,  9814,  9863,  9911,  9960, 10008,
+        10057, 10106, 10152, 10198, 10243, 10289, 10335, 10381, 10426, 10472,
+        10518, 10565, 10612, 10659, 10707, 10754, 10801, 10849, 10896, 10943,
+        10981, 11001, 11022, 11043, 11064, 11084, 11105, 11126, 11147, 11165
+    },
+    // 145 mm/s
+    {
+         5052,  5122,  5192,  5262,  5333,  5404,  5475,  5546,  5615,  5684,
+         5752,  5821,  5889,  5958,  6026,  6095,  6163,  6246,  6352,  6458,
+         6563,  6669,  6775,  6881,  6987,  7093,  7191,  7265,  7340,  7414,
+         7488,  7563,  7637,  7712,  7786,  7860,  7906,  7951,  7996,  8041,
+         8087,  8132,  8177,  8223,  8268,  8319,  8372,  8425,  8478,  8530,
+         8583,  8636,  8689,  8742,  8800,  8863,  8926,  8989,  9052,  9115,
+         9178,  9242,  9305,  9360,  9393,  9426,  9458,  9491,  9524,  9557,
+         9589,  9622,  9655,  9703,  9752,  9801,  9849,  9898,  9946,  9995,
+        10044, 10092, 10138, 10184, 10230, 10275, 10321, 10367, 10412, 10458,
+        10504, 10550, 10597, 10644, 10691, 10738, 10785, 10832, 10880, 10927,
+        10964, 10985, 11005, 11026, 11047, 11068, 11088, 11109, 11130, 11148
+    },
+    // 146 mm/s
+    {
+         5045,  5115,  5184,  5255,  5326,  5397,  5469,  5540,  5610,  5678,
+         5746,  5815,  5883,  5952,  6020,  6088,  6157,  6239,  6345,  6451,
+         6557,  6663,  6769,  6875,  6981,  7087,  7185,  7259,  7333,  7406,
+         7480,  7554,  7628,  7702,  7776,  7850,  7895,  7941,  7986,  8032,
+         8077,  8123,  8168,  8213,  8259,  8310,  8362,  8415,  8468,  8520,
+         8573,  8626,  8678,  8731,  8789,  8852,  8914,  8977,  9040,  9103,
+         9166,  9229,  9292,  9347,  9380,  9413,  9445,  9478,  9511,  9543,
+         9576,  9609,  9641,  9690,  9738,  9787,  9836,  9884,  9933,  9982,
+        10030, 10079, 10125, 10170, 10216, 10261, 10307, 10353, 10398, 10444,
+        10489, 10536, 10582, 10629, 10676, 10723, 10770, 10816, 10863, 10910,
+        10947, 10968, 10988, 11009, 11030, 11051, 11072, 11092, 11113, 11131
+    },
+    // 147 mm/s
+    {
+         5038,  5107,  5177,  5248,  5319,  5391,  5463,  5535,  5604,  5672,
+         5741,  5809,  5877,  5945,  6014,  6082,  6150,  6233,  6339,  6445,
+         6551,  6657,  6763,  6869,  6975,  7081,  7179,  7252,  7326,  7399,
+         7472,  7546,  7619,  7693,  7766,  7840,  7885,  7931,  7976,  8022,
+         8068,  8113,  8159,  8204,  8250,  8301,  8353,  8405,  8458,  8510,
+         8563,  8615,  8667,  8720,  8777,  8840,  8903,  8966,  9028,  9091,
+         9154,  9217,  9279,  9335,  9367,  9400,  9432,  9465,  9497,  9530,
+         9563,  9595,  9628,  9676,  9725,  9774,  9822,  9871,  9919,  9968,
+        10017, 10065, 10111, 10157, 10202, 10248, 10293, 10339, 10384, 10430,
+        10475, 10521, 10568, 10614, 10661, 10707, 10754, 10800, 10847, 10893,
+        10930, 10951, 10972, 10992, 11013, 11034, 11055, 11075, 11096, 11114
+    },
+    // 148 mm/s
+    {
+         5030,  5100,  5170,  5240,  5313,  5385,  5457,  5529,  5599,  5667,
+         5735,  5803,  5871,  5939,  6007,  6075,  6144,  6226,  6332,  6438,
+         6544,  6650,  6757,  6863,  6969,  7075,  7173,  7246,  7319,  7392,
+         7465,  7538,  7610,  7683,  7756,  7829,  7875,  7921,  7966,  8012,
+         8058,  8104,  8149,  8195,  8241,  8291,  8344,  8396,  8448,  8500,
+         8552,  8604,  8657,  8709,  8766,  8829,  8891,  8954,  9017,  9079,
+         9142,  9204,  9267,  9322,  9354,  9387,  9419,  9452,  9484,  9517,
+         9549,  9582,  9614,  9663,  9711,  9760,  9809,  9857,  9906,  9955,
+        10003, 10052, 10098, 10143, 10188, 10234, 10279, 10325, 10370, 10415,
+        10461, 10507, 10553, 10599, 10645, 10692, 10738, 10784, 10830, 10877,
+        10913, 10934, 10955, 10976, 10996, 11017, 11038, 11059, 11079, 11098
+    },
+    // 149 mm/s
+    {
+         5023,  5093,  5163,  5233,  5306,  5378,  5451,  5523,  5593,  5661,
+         5729,  5797,  5865,  5933,  6001,  6069,  6137,  6219,  6325,  6432,
+         6538,  6644,  6750,  6857,  6963,  7069,  7167,  7239,  7312,  7384,
+         7457,  7529,  7602,  7674,  7746,  7819,  7865,  7911,  7956,  8002,
+         8048,  8094,  8140,  8186,  8232,  8282,  8334,  8386,  8438,  8490,
+         8542,  8594,  8646,  8698,  8755,  8817,  8880,  8942,  9005,  9067,
+         9129,  9192,  9254,  9309,  9341,  9374,  9406,  9439,  9471,  9503,
+         9536,  9568,  9601,  9649,  9698,  9747,  9795,  9844,  9893,  9941,
+         9990, 10039, 10084, 10130, 10175, 10220, 10265, 10311, 10356, 10401,
+        10446, 10492, 10538, 10584, 10630, 10676, 10722, 10768, 10814, 10860,
+        10897, 10917, 10938, 10959, 10980, 11000, 11021, 11042, 11063, 11081
+    },
+    // 150 mm/s
+    {
+         5016,  5086,  5156,  5226,  5299,  5372,  5445,  5518,  5588,  5655,
+         5723,  5791,  5859,  5927,  5995,  6063,  6130,  6213,  6319,  6425,
+         6532,  6638,  6744,  6851,  6957,  7063,  7161,  7233,  7305,  7377,
+         7449,  7521,  7593,  7665,  7737,  7809,  7855,  7901,  7947,  7993,
+         8039,  8085,  8131,  8177,  8223,  8273,  8325,  8376,  8428,  8480,
+         8532,  8583,  8635,  8687,  8744,  8806,  8868,  8930,  8993,  9055,
+         9117,  9179,  9242,  9296,  9329,  9361,  9393,  9426,  9458,  9490,
+         9522,  9555,  9587,  9636,  9684,  9733,  9782,  9830,  9879,  9928,
+         9976, 10025, 10071, 10116, 10161, 10206, 10251, 10297, 10342, 10387,
+        10432, 10478, 10523, 10569, 10615, 10661, 10706, 10752, 10798, 10843,
+        10880, 10901, 10921, 10942, 10963, 10984, 11004, 11025, 11046, 11064
+    },
+    // 151 mm/s
+    {
+         5009,  5079,  5148,  5219,  5292,  5366,  5439,  5512,  5582,  5650,
+         5718,  5785,  5853,  5921,  5988,  6056,  6124,  6206,  6312,  6419,
+         6525,  6632,  6738,  6844,  6951,  7057,  7155,  7226,  7298,  7369,
+         7441,  7512,  7584,  7655,  7727,  7798,  7844,  7890,  7937,  7983,
+         8029,  8075,  8121,  8167,  8214,  8264,  8315,  8367,  8418,  8470,
+         8521,  8573,  8624,  8676,  8733,  8795,  8857,  8919,  8981,  9043,
+         9105,  9167,  9229,  9284,  9316,  9348,  9380,  9412,  9445,  9477,
+         9509,  9541,  9573,  9622,  9671,  9720,  9768,  9817,  9866,  9914,
+         9963, 10012, 10057, 10102, 10147, 10192, 10238, 10283, 10328, 10373,
+        10418, 10463, 10509, 10554, 10599, 10645, 10690, 10736, 10781, 10827,
+        10863, 10884, 10904, 10925, 10946, 10967, 10988, 11008, 11029, 11047
+    },
+    // 152 mm/s
+    {
+         5002,  5071,  5141,  5212,  5286,  5359,  5433,  5507,  5577,  5644,
+         5712,  5779,  5847,  5914,  5982,  6050,  6117,  6199,  6306,  6412,
+         6519,  6625,  6732,  6838,  6945,  7051,  7149,  7220,  7291,  7362,
+         7433,  7504,  7575,  7646,  7717,  7788,  7834,  7880,  7927,  7973,
+         8019,  8066,  8112,  8158,  8204,  8255,  8306,  8357,  8408,  8460,
+         8511,  8562,  8613,  8665,  8721,  8783,  8845,  8907,  8969,  9031,
+         9093,  9154,  9216,  9271,  9303,  9335,  9367,  9399,  9431,  9464,
+         9496,  9528,  9560,  9609,  9657,  9706,  9755,  9803,  9852,  9901,
+         9950,  9998, 10044, 10089, 10134, 10179, 10224, 10269, 10314, 10359,
+        10403, 10449, 10494, 10539, 10584, 10629, 10675, 10720, 10765, 10810,
+        10846, 10867, 10888, 10908, 10929, 10950, 10971, 10991, 11012, 11030
+    },
+    // 153 mm/s
+    {
+         4994,  5064,  5134,  5205,  5279,  5353,  5427,  5501,  5571,  5639,
+         5706,  5773,  5841,  5908,  5976,  6043,  6111,  6193,  6299,  6406,
+         6512,  6619,  6726,  6832,  6939,  7045,  7143,  7214,  7284,  7355,
+         7425,  7495,  7566,  7636,  7707,  7777,  7824,  7870,  7917,  7963,
+         8010,  8056,  8103,  8149,  8195,  8245,  8296,  8347,  8398,  8450,
+         8501,  8552,  8603,  8654,  8710,  8772,  8834,  8895,  8957,  9019,
+         9080,  9142,  9204,  9258,  9290,  9322,  9354,  9386,  9418,  9450,
+         9482,  9514,  9546,  9595,  9644,  9693,  9741,  9790,  9839,  9887,
+         9936,  9985, 10030, 10075, 10120, 10165, 10210, 10255, 10299, 10344,
+        10389, 10434, 10479, 10524, 10569, 10614, 10659, 10704, 10749, 10794,
+        10829, 10850, 10871, 10892, 10912, 10933, 10954, 10975, 10995, 11014
+    },
+    // 154 mm/s
+    {
+         4987,  5057,  5127,  5198,  5272,  5347,  5421,  5496,  5566,  5633,
+         5700,  5768,  5835,  5902,  5969,  6037,  6104,  6186,  6293,  6399,
+         6506,  6613,  6719,  6826,  6933,  7040,  7137,  7207,  7277,  7347,
+         7417,  7487,  7557,  7627,  7697,  7767,  7814,  7860,  7907,  7953,
+         8000,  8047,  8093,  8140,  8186,  8236,  8287,  8338,  8389,  8439,
+         8490,  8541,  8592,  8643,  8699,  8760,  8822,  8883,  8945,  9007,
+         9068,  9130,  9191,  9245,  9277,  9309,  9341,  9373,  9405,  9437,
+         9469,  9501,  9533,  9582,  9630,  9679,  9728,  9777,  9825,  9874,
+         9923,  9972, 10017, 10062, 10106, 10151, 10196, 10241, 10285, 10330,
+        10375, 10420, 10464, 10509, 10554, 10598, 10643, 10688, 10732, 10777,
+        10813, 10833, 10854, 10875, 10896, 10916, 10937, 10958, 10979, 10997
+    },
+    // 155 mm/s
+    {
+         4980,  5050,  5120,  5191,  5266,  5340,  5415,  5490,  5560,  5627,
+         5694,  5762,  5829,  5896,  5963,  6030,  6097,  6179,  6286,  6393,
+         6500,  6607,  6713,  6820,  6927,  7034,  7131,  7201,  7270,  7340,
+         7409,  7479,  7548,  7618,  7687,  7757,  7803,  7850,  7897,  7944,
+         7990,  8037,  8084,  8131,  8177,  8227,  8278,  8328,  8379,  8429,
+         8480,  8531,  8581,  8632,  8688,  8749,  8810,  8872,  8933,  8994,
+         9056,  9117,  9178,  9232,  9264,  9296,  9328,  9360,  9392,  9424,
+         9456,  9487,  9519,  9568,  9617,  9666,  9714,  9763,  9812,  9861,
+         9909,  9958, 10003, 10048, 10093, 10137, 10182, 10227, 10271, 10316,
+        10361, 10405, 10449, 10494, 10538, 10583, 10627, 10671, 10716, 10760,
+        10796, 10817, 10837, 10858, 10879, 10900, 10920, 10941, 10962, 10980
+    },
+    // 156 mm/s
+    {
+         4973,  5043,  5112,  5184,  5259,  5334,  5409,  5485,  5555,  5622,
+         5689,  5756,  5823,  5890,  5957,  6024,  6091,  6173,  6280,  6386,
+         6493,  6600,  6707,  6814,  6921,  7028,  7125,  7194,  7263,  7332,
+         7401,  7470,  7539,  7608,  7677,  7746,  7793,  7840,  7887,  7934,
+         7981,  8028,  8074,  8121,  8168,  8218,  8268,  8318,  8369,  8419,
+         8470,  8520,  8570,  8621,  8676,  8738,  8799,  8860,  8921,  8982,
+         9044,  9105,  9166,  9220,  9251,  9283,  9315,  9347,  9379,  9410,
+         9442,  9474,  9506,  9555,  9603,  9652,  9701,  9750,  9798,  9847,
+         9896,  9945,  9990, 10034, 10079, 10123, 10168, 10213, 10257, 10302,
+        10346, 10391, 10435, 10479, 10523, 10567, 10611, 10655, 10699, 10744,
+        10779, 10800, 10820, 10841, 10862, 10883, 10904, 10924, 10945, 10963
+    },
+    // 157 mm/s
+    {
+         4966,  5035,  5105,  5177,  5252,  5328,  5403,  5479,  5549,  5616,
+         5683,  5750,  5817,  5884,  5950,  6017,  6084,  6166,  6273,  6380,
+         6487,  6594,  6701,  6808,  6915,  7022,  7119,  7188,  7256,  7325,
+         7393,  7462,  7530,  7599,  7667,  7736,  7783,  7830,  7877,  7924,
+         7971,  8018,  8065,  8112,  8159,  8209,  8259,  8309,  8359,  8409,
+         8459,  8509,  8560,  8610,  8665,  8726,  8787,  8848,  8909,  8970,
+         9031,  9092,  9153,  9207,  9239,  9270,  9302,  9334,  9365,  9397,
+         9429,  9461,  9492,  9541,  9590,  9639,  9687,  9736,  9785,  9834,
+         9883,  9931,  9976, 10021, 10065, 10110, 10154, 10199, 10243, 10287,
+        10332, 10376, 10420, 10464, 10508, 10551, 10595, 10639, 10683, 10727,
+        10762, 10783, 10804, 10824, 10845, 10866, 10887, 10907, 10928, 10946
+    },
+    // 158 mm/s
+    {
+         4958,  5028,  5098,  5169,  5245,  5321,  5397,  5474,  5544,  5610,
+         5677,  5744,  5811,  5877,  5944,  6011,  6078,  6159,  6266,  6374,
+         6481,  6588,  6695,  6802,  6909,  7016,  7113,  7181,  7249,  7317,
+         7385,  7453,  7522,  7590,  7658,  7726,  7773,  7820,  7867,  7914,
+         7961,  8009,  8056,  8103,  8150,  8199,  8249,  8299,  8349,  8399,
+         8449,  8499,  8549,  8599,  8654,  8715,  8776,  8837,  8897,  8958,
+         9019,  9080,  9141,  9194,  9226,  9257,  9289,  9321,  9352,  9384,
+         9415,  9447,  9479,  9527,  9576,  9625,  9674,  9723,  9771,  9820,
+         9869,  9918,  9963, 10007, 10052, 10096, 10140, 10185, 10229, 10273,
+        10318, 10362, 10405, 10449, 10492, 10536, 10580, 10623, 10667, 10710,
+        10745, 10766, 10787, 10808, 10828, 10849, 10870, 10891, 10911, 10930
+    },
+    // 159 mm/s
+    {
+         4951,  5021,  5091,  5162,  5239,  5315,  5392,  5468,  5538,  5605,
+         5671,  5738,  5805,  5871,  5938,  6004,  6071,  6153,  6260,  6367,
+         6474,  6581,  6689,  6796,  6903,  7010,  7107,  7175,  7242,  7310,
+         7378,  7445,  7513,  7580,  7648,  7715,  7763,  7810,  7857,  7905,
+         7952,  7999,  8046,  8094,  8141,  8190,  8240,  8290,  8339,  8389,
+         8439,  8488,  8538,  8588,  8643,  8704,  8764,  8825,  8885,  8946,
+         9007,  9067,  9128,  9181,  9213,  9244,  9276,  9308,  9339,  9371,
+         9402,  9434,  9465,  9514,  9563,  9612,  9660,  9709,  9758,  9807,
+         9856,  9904,  9949,  9994, 10038, 10082, 10126, 10171, 10215, 10259,
+        10303, 10347, 10390, 10434, 10477, 10520, 10564, 10607, 10650, 10694,
+        10729, 10749, 10770, 10791, 10812, 10832, 10853, 10874, 10895, 10913
+    },
+    // 160 mm/s
+    {
+         4944,  5014,  5084,  5155,  5232,  5309,  5386,  5462,  5533,  5599,
+         5666,  5732,  5799,  5865,  5931,  5998,  6064,  6146,  6253,  6361,
+         6468,  6575,  6682,  6790,  6897,  7004,  7101,  7168,  7235,  7303,
+         7370,  7437,  7504,  7571,  7638,  7705,  7752,  7800,  7847,  7895,
+         7942,  7990,  8037,  8084,  8132,  8181,  8230,  8280,  8329,  8379,
+         8428,  8478,  8527,  8577,  8632,  8692,  8753,  8813,  8874,  8934,
+         8994,  9055,  9115,  9169,  9200,  9232,  9263,  9294,  9326,  9357,
+         9389,  9420,  9452,  9500,  9549,  9598,  9647,  9696,  9745,  9793,
+         9842,  9891,  9936,  9980, 10024, 10068, 10112, 10157, 10201, 10245,
+        10289, 10332, 10376, 10419, 10462, 10505, 10548, 10591, 10634, 10677,
+        10712, 10733, 10753, 10774, 10795, 10816, 10836, 10857, 10878, 10896
+    },
+    // 161 mm/s
+    {
+         4937,  5007,  5076,  5148,  5225,  5302,  5380,  5457,  5527,  5594,
+         5660,  5726,  5793,  5859,  5925,  5991,  6058,  6139,  6247,  6354,
+         6462,  6569,  6676,  6784,  6891,  6998,  7095,  7162,  7229,  7295,
+         7362,  7428,  7495,  7561,  7628,  7695,  7742,  7790,  7837,  7885,
+         7933,  7980,  8028,  8075,  8123,  8172,  8221,  8270,  8319,  8369,
+         8418,  8467,  8516,  8566,  8620,  8681,  8741,  8801,  8862,  8922,
+         8982,  9042,  9103,  9156,  9187,  9219,  9250,  9281,  9313,  9344,
+         9375,  9407,  9438,  9487,  9536,  9585,  9633,  9682,  9731,  9780,
+         9829,  9878,  9922,  9966, 10010, 10054, 10099, 10143, 10187, 10231,
+        10275, 10318, 10361, 10404, 10446, 10489, 10532, 10575, 10618, 10660,
+        10695, 10716, 10736, 10757, 10778, 10799, 10820, 10840, 10861, 10879
+    },
+    // 162 mm/s
+    {
+         4930,  4999,  5069,  5141,  5219,  5296,  5374,  5451,  5522,  5588,
+         5654,  5720,  5786,  5853,  5919,  5985,  6051,  6133,  6240,  6348,
+         6455,  6563,  6670,  6777,  6885,  6992,  7089,  7155,  7222,  7288,
+         7354,  7420,  7486,  7552,  7618,  7684,  7732,  7780,  7827,  7875,
+         7923,  7971,  8018,  8066,  8114,  8162,  8212,  8261,  8310,  8359,
+         8408,  8457,  8506,  8555,  8609,  8669,  8729,  8790,  8850,  8910,
+         8970,  9030,  9090,  9143,  9174,  9206,  9237,  9268,  9299,  9331,
+         9362,  9393,  9425,  9473,  9522,  9571,  9620,  9669,  9718,  9767,
+         9815,  9864,  9909,  9953,  9997, 10041, 10085, 10129, 10173, 10216,
+        10260, 10303, 10346, 10389, 10431, 10474, 10516, 10559, 10601, 10644,
+        10678, 10699, 10720, 10740, 10761, 10782, 10803, 10823, 10844, 10862
+    },
+    // 163 mm/s
+    {
+         4922,  4992,  5062,  5134,  5212,  5290,  5368,  5446,  5516,  5582,
+         5648,  5714,  5780,  5846,  5913,  5979,  6045,  6126,  6234,  6341,
+         6449,  6556,  6664,  6771,  6879,  6986,  7083,  7149,  7215,  7280,
+         7346,  7411,  7477,  7543,  7608,  7674,  7722,  7770,  7817,  7865,
+         7913,  7961,  8009,  8057,  8105,  8153,  8202,  8251,  8300,  8348,
+         8397,  8446,  8495,  8544,  8598,  8658,  8718,  8778,  8838,  8898,
+         8958,  9018,  9078,  9130,  9161,  9193,  9224,  9255,  9286,  9317,
+         9349,  9380,  9411,  9460,  9509,  9558,  9606,  9655,  9704,  9753,
+         9802,  9851,  9895,  9939,  9983, 10027, 10071, 10115, 10158, 10202,
+        10246, 10289, 10331, 10374, 10416, 10458, 10500, 10543, 10585, 10627,
+        10661, 10682, 10703, 10724, 10744, 10765, 10786, 10807, 10827, 10846
+    },
+    // 164 mm/s
+    {
+         4915,  4985,  5055,  5127,  5205,  5284,  5362,  5440,  5511,  5577,
+         5643,  5709,  5774,  5840,  5906,  5972,  6038,  6120,  6227,  6335,
+         6442,  6550,  6658,  6765,  6873,  6980,  7077,  7143,  7208,  7273,
+         7338,  7403,  7468,  7533,  7598,  7664,  7712,  7760,  7808,  7856,
+         7904,  7952,  8000,  8048,  8096,  8144,  8193,  8241,  8290,  8338,
+         8387,  8436,  8484,  8533,  8587,  8647,  8706,  8766,  8826,  8886,
+         8945,  9005,  9065,  9118,  9149,  9180,  9211,  9242,  9273,  9304,
+         9335,  9366,  9397,  9446,  9495,  9544,  9593,  9642,  9691,  9740,
+         9789,  9837,  9882,  9926,  9969, 10013, 10057, 10101, 10144, 10188,
+        10232, 10274, 10316, 10358, 10400, 10442, 10485, 10527, 10569, 10611,
+        10645, 10665, 10686, 10707, 10728, 10748, 10769, 10790, 10811, 10829
+    },
+    // 165 mm/s
+    {
+         4908,  4978,  5048,  5120,  5198,  5277,  5356,  5435,  5505,  5571,
+         5637,  5703,  5768,  5834,  5900,  5966,  6031,  6113,  6221,  6328,
+         6436,  6544,  6651,  6759,  6867,  6975,  7072,  7136,  7201,  7265,
+         7330,  7395,  7459,  7524,  7589,  7653,  7701,  7749,  7798,  7846,
+         7894,  7942,  7990,  8038,  8087,  8135,  8183,  8232,  8280,  8328,
+         8377,  8425,  8473,  8522,  8576,  8635,  8695,  8754,  8814,  8874,
+         8933,  8993,  9052,  9105,  9136,  9167,  9198,  9229,  9260,  9291,
+         9322,  9353,  9384,  9433,  9482,  9531,  9580,  9628,  9677,  9726,
+         9775,  9824,  9868,  9912,  9956,  9999, 10043, 10087, 10130, 10174,
+        10217, 10260, 10302, 10343, 10385, 10427, 10469, 10510, 10552, 10594,
+        10628, 10649, 10669, 10690, 10711, 10732, 10752, 10773, 10794, 10812
+    },
+    // 166 mm/s
+    {
+         4901,  4971,  5040,  5113,  5192,  5271,  5350,  5429,  5500,  5565,
+         5631,  5697,  5762,  5828,  5894,  5959,  6025,  6106,  6214,  6322,
+         6430,  6537,  6645,  6753,  6861,  6969,  7066,  7130,  7194,  7258,
+         7322,  7386,  7450,  7515,  7579,  7643,  7691,  7739,  7788,  7836,
+         7884,  7933,  7981,  8029,  8078,  8126,  8174,  8222,  8270,  8318,
+         8366,  8414,  8463,  8511,  8564,  8624,  8683,  8743,  8802,  8861,
+         8921,  8980,  9040,  9092,  9123,  9154,  9185,  9216,  9247,  9278,
+         9308,  9339,  9370,  9419,  9468,  9517,  9566,  9615,  9664,  9713,
+         9762,  9811,  9855,  9898,  9942,  9985, 10029, 10073, 10116, 10160,
+        10203, 10245, 10287, 10328, 10370, 10411, 10453, 10494, 10536, 10577,
+        10611, 10632, 10652, 10673, 10694, 10715, 10736, 10756, 10777, 10795
+    },
+    // 167 mm/s
+    {
+         4894,  4963,  5033,  5105,  5185,  5265,  5344,  5424,  5494,  5560,
+         5625,  5691,  5756,  5822,  5887,  5953,  6018,  6100,  6207,  6315,
+         6423,  6531,  6639,  6747,  6855,  6963,  7060,  7123,  7187,  7251,
+         7314,  7378,  7441,  7505,  7569,  7632,  7681,  7729,  7778,  7826,
+         7875,  7923,  7972,  8020,  8068,  8116,  8164,  8212,  8260,  8308,
+         8356,  8404,  8452,  8500,  8553,  8612,  8672,  8731,  8790,  8849,
+         8909,  8968,  9027,  9079,  9110,  9141,  9172,  9203,  9233,  9264,
+         9295,  9326,  9357,  9406,  9455,  9504,  9553,  9601,  9650,  9699,
+         9748,  9797,  9841,  9885,  9928,  9972, 10015, 10059, 10102, 10145,
+        10189, 10231, 10272, 10313, 10355, 10396, 10437, 10478, 10519, 10561,
+        10594, 10615, 10636, 10656, 10677, 10698, 10719, 10739, 10760, 10778
+    },
+    // 168 mm/s
+    {
+         4886,  4956,  5026,  5098,  5178,  5258,  5338,  5418,  5489,  5554,
+         5620,  5685,  5750,  5816,  5881,  5946,  6012,  6093,  6201,  6309,
+         6417,  6525,  6633,  6741,  6849,  6957,  7054,  7117,  7180,  7243,
+         7306,  7369,  7433,  7496,  7559,  7622,  7671,  7719,  7768,  7816,
+         7865,  7914,  7962,  8011,  8059,  8107,  8155,  8203,  8250,  8298,
+         8346,  8393,  8441,  8489,  8542,  8601,  8660,  8719,  8778,  8837,
+         8896,  8955,  9014,  9066,  9097,  9128,  9159,  9189,  9220,  9251,
+         9282,  9313,  9343,  9392,  9441,  9490,  9539,  9588,  9637,  9686,
+         9735,  9784,  9828,  9871,  9915,  9958, 10001, 10045, 10088, 10131,
+        10175, 10216, 10257, 10298, 10339, 10380, 10421, 10462, 10503, 10544,
+        10577, 10598, 10619, 10640, 10660, 10681, 10702, 10723, 10743, 10762
+    },
+    // 169 mm/s
+    {
+         4879,  4949,  5019,  5091,  5172,  5252,  5332,  5413,  5483,  5549,
+         5614,  5679,  5744,  5809,  5875,  5940,  6005,  6086,  6194,  6302,
+         6411,  6519,  6627,  6735,  6843,  6951,  7048,  7110,  7173,  7236,
+         7298,  7361,  7424,  7486,  7549,  7612,  7660,  7709,  7758,  7807,
+         7855,  7904,  7953,  8002,  8050,  8098,  8146,  8193,  8240,  8288,
+         8335,  8383,  8430,  8478,  8531,  8590,  8649,  8707,  8766,  8825,
+         8884,  8943,  9002,  9054,  9084,  9115,  9146,  9176,  9207,  9238,
+         9268,  9299,  9330,  9379,  9428,  9477,  9526,  9575,  9624,  9672,
+         9721,  9770,  9814,  9858,  9901,  9944,  9987, 10031, 10074, 10117,
+        10160, 10202, 10243, 10283, 10324, 10365, 10405, 10446, 10487, 10527,
+        10561, 10581, 10602, 10623, 10644, 10664, 10685, 10706, 10727, 10745
+    },
+    // 170 mm/s
+    {
+         4872,  4942,  5012,  5084,  5165,  5246,  5326,  5407,  5478,  5543,
+         5608,  5673,  5738,  5803,  5868,  5933,  5998,  6080,  6188,  6296,
+         6404,  6512,  6621,  6729,  6837,  6945,  7042,  7104,  7166,  7228,
+         7290,  7353,  7415,  7477,  7539,  7601,  7650,  7699,  7748,  7797,
+         7846,  7895,  7943,  7992,  8041,  8089,  8136,  8183,  8231,  8278,
+         8325,  8372,  8419,  8467,  8520,  8578,  8637,  8696,  8754,  8813,
+         8872,  8931,  8989,  9041,  9071,  9102,  9133,  9163,  9194,  9224,
+         9255,  9286,  9316,  9365,  9414,  9463,  9512,  9561,  9610,  9659,
+         9708,  9757,  9801,  9844,  9887,  9930,  9973, 10017, 10060, 10103,
+        10146, 10187, 10228, 10268, 10309, 10349, 10389, 10430, 10470, 10511,
+        10544, 10565, 10585, 10606, 10627, 10648, 10668, 10689, 10710, 10728
+    },
+    // 171 mm/s
+    {
+         4865,  4935,  5004,  5077,  5158,  5239,  5320,  5401,  5472,  5537,
+         5602,  5667,  5732,  5797,  5862,  5927,  5992,  6073,  6181,  6290,
+         6398,  6506,  6614,  6723,  6831,  6939,  7036,  7097,  7159,  7221,
+         7283,  7344,  7406,  7468,  7529,  7591,  7640,  7689,  7738,  7787,
+         7836,  7885,  7934,  7983,  8032,  8080,  8127,  8174,  8221,  8268,
+         8315,  8362,  8409,  8456,  8508,  8567,  8625,  8684,  8742,  8801,
+         8860,  8918,  8977,  9028,  9059,  9089,  9120,  9150,  9181,  9211,
+         9242,  9272,  9303,  9352,  9401,  9450,  9499,  9548,  9597,  9646,
+         9695,  9744,  9787,  9830,  9873,  9916,  9960, 10003, 10046, 10089,
+        10132, 10173, 10213, 10253, 10293, 10333, 10374, 10414, 10454, 10494,
+        10527, 10548, 10568, 10589, 10610, 10631, 10652, 10672, 10693, 10711
+    },
+    // 172 mm/s
+    {
+         4858,  4927,  4997,  5070,  5151,  5233,  5314,  5396,  5467,  5532,
+         5596,  5661,  5726,  5791,  5856,  5920,  5985,  6066,  6175,  6283,
+         6391,  6500,  6608,  6717,  6825,  6933,  7030,  7091,  7152,  7213,
+         7275,  7336,  7397,  7458,  7519,  7581,  7630,  7679,  7728,  7777,
+         7826,  7876,  7925,  7974,  8023,  8070,  8117,  8164,  8211,  8258,
+         8304,  8351,  8398,  8445,  8497,  8555,  8614,  8672,  8731,  8789,
+         8847,  8906,  8964,  9015,  9046,  9076,  9107,  9137,  9167,  9198,
+         9228,  9259,  9289,  9338,  9387,  9436,  9485,  9534,  9583,  9632,
+         9681,  9730,  9774,  9817,  9860,  9903,  9946,  9989, 10031, 10074,
+        10117, 10158, 10198, 10238, 10278, 10318, 10358, 10398, 10438, 10477,
+        10510, 10531, 10552, 10572, 10593, 10614, 10635, 10655, 10676, 10694
+    },
+    // 173 mm/s
+    {
+         4850,  4920,  4990,  5063,  5145,  5227,  5308,  5390,  5461,  5526,
+         5591,  5655,  5720,  5785,  5849,  5914,  5979,  6060,  6168,  6277,
+         6385,  6494,  6602,  6710,  6819,  6927,  7024,  7085,  7145,  7206,
+         7267,  7327,  7388,  7449,  7510,  7570,  7620,  7669,  7718,  7768,
+         7817,  7866,  7915,  7965,  8014,  8061,  8108,  8154,  8201,  8247,
+         8294,  8340,  8387,  8434,  8486,  8544,  8602,  8660,  8719,  8777,
+         8835,  8893,  8951,  9003,  9033,  9063,  9094,  9124,  9154,  9185,
+         9215,  9245,  9276,  9325,  9374,  9423,  9472,  9521,  9570,  9619,
+         9668,  9717,  9760,  9803,  9846,  9889,  9932,  9975, 10017, 10060,
+        10103, 10144, 10183, 10223, 10263, 10302, 10342, 10382, 10421, 10461,
+        10493, 10514, 10535, 10556, 10576, 10597, 10618, 10639, 10659, 10678
+    },
+    // 174 mm/s
+    {
+         4843,  4913,  4983,  5056,  5138,  5220,  5303,  5385,  5456,  5520,
+         5585,  5649,  5714,  5779,  5843,  5908,  5972,  6053,  6162,  6270,
+         6379,  6487,  6596,  6704,  6813,  6921,  7018,  7078,  7138,  7199,
+         7259,  7319,  7379,  7439,  7500,  7560,  7609,  7659,  7708,  7758,
+         7807,  7857,  7906,  7956,  8005,  8052,  8098,  8145,  8191,  8237,
+         8284,  8330,  8376,  8423,  8475,  8533,  8591,  8649,  8707,  8765,
+         8823,  8881,  8939,  8990,  9020,  9050,  9081,  9111,  9141,  9171,
+         9202,  9232,  9262,  9311,  9360,  9409,  9458,  9507,  9556,  9605,
+         9654,  9703,  9747,  9790,  9832,  9875,  9918,  9961, 10003, 10046,
+        10089, 10129, 10169, 10208, 10247, 10287, 10326, 10365, 10405, 10444,
+        10477, 10497, 10518, 10539, 10560, 10580, 10601, 10622, 10643, 10661
+    },
+    // 175 mm/s
+    {
+         4836,  4906,  4976,  5049,  5131,  5214,  5297,  5379,  5450,  5515,
+         5579,  5644,  5708,  5772,  5837,  5901,  5965,  6046,  6155,  6264,
+         6372,  6481,  6590,  6698,  6807,  6916,  7012,  7072,  7131,  7191,
+         7251,  7311,  7370,  7430,  7490,  7550,  7599,  7649,  7698,  7748,
+         7798,  7847,  7897,  7946,  7996,  8043,  8089,  8135,  8181,  8227,
+         8273,  8319,  8365,  8412,  8464,  8521,  8579,  8637,  8695,  8753,
+         8810,  8868,  8926,  8977,  9007,  9037,  9068,  9098,  9128,  9158,
+         9188,  9218,  9248,  9298,  9347,  9396,  9445,  9494,  9543,  9592,
+         9641,  9690,  9733,  9776,  9819,  9861,  9904,  9947,  9989, 10032,
+        10074, 10115, 10154, 10193, 10232, 10271, 10310, 10349, 10388, 10428,
+        10460, 10481, 10501, 10522, 10543, 10564, 10584, 10605, 10626, 10644
+    },
+    // 176 mm/s
+    {
+         4829,  4899,  4968,  5042,  5125,  5208,  5291,  5374,  5445,  5509,
+         5573,  5638,  5702,  5766,  5830,  5895,  5959,  6040,  6149,  6257,
+         6366,  6475,  6583,  6692,  6801,  6910,  7006,  7065,  7124,  7184,
+         7243,  7302,  7361,  7421,  7480,  7539,  7589,  7639,  7688,  7738,
+         7788,  7838,  7887,  7937,  7987,  8034,  8080,  8125,  8171,  8217,
+         8263,  8309,  8355,  8401,  8452,  8510,  8568,  8625,  8683,  8741,
+         8798,  8856,  8913,  8964,  8994,  9024,  9054,  9085,  9115,  9145,
+         9175,  9205,  9235,  9284,  9333,  9382,  9431,  9480,  9529,  9578,
+         9628,  9677,  9720,  9762,  9805,  9847,  9890,  9933,  9975, 10018,
+        10060, 10100, 10139, 10178, 10217, 10256, 10294, 10333, 10372, 10411,
+        10443, 10464, 10484, 10505, 10526, 10547, 10568, 10588, 10609, 10627
+    },
+    // 177 mm/s
+    {
+         4822,  4891,  4961,  5034,  5118,  5201,  5285,  5368,  5439,  5504,
+         5568,  5632,  5696,  5760,  5824,  5888,  5952,  6033,  6142,  6251,
+         6360,  6468,  6577,  6686,  6795,  6904,  7000,  7059,  7118,  7176,
+         7235,  7294,  7353,  7411,  7470,  7529,  7579,  7629,  7679,  7728,
+         7778,  7828,  7878,  7928,  7978,  8024,  8070,  8116,  8161,  8207,
+         8253,  8298,  8344,  8390,  8441,  8499,  8556,  8614,  8671,  8728,
+         8786,  8843,  8901,  8951,  8981,  9011,  9041,  9071,  9101,  9131,
+         9161,  9191,  9221,  9270,  9320,  9369,  9418,  9467,  9516,  9565,
+         9614,  9663,  9706,  9749,  9791,  9834,  9876,  9919,  9961, 10003,
+        10046, 10086, 10124, 10163, 10201, 10240, 10279, 10317, 10356, 10394,
+        10426, 10447, 10468, 10488, 10509, 10530, 10551, 10571, 10592, 10610
+    },
+    // 178 mm/s
+    {
+         4814,  4884,  4954,  5027,  5111,  5195,  5279,  5363,  5434,  5498,
+         5562,  5626,  5690,  5754,  5818,  5882,  5946,  6026,  6135,  6244,
+         6353,  6462,  6571,  6680,  6789,  6898,  6994,  7052,  7111,  7169,
+         7227,  7285,  7344,  7402,  7460,  7519,  7569,  7619,  7669,  7719,
+         7769,  7819,  7869,  7919,  7969,  8015,  8061,  8106,  8151,  8197,
+         8242,  8288,  8333,  8379,  8430,  8487,  8544,  8602,  8659,  8716,
+         8774,  8831,  8888,  8939,  8969,  8999,  9028,  9058,  9088,  9118,
+         9148,  9178,  9208,  9257,  9306,  9355,  9404,  9453,  9502,  9552,
+         9601,  9650,  9693,  9735,  9778,  9820,  9862,  9905,  9947,  9989,
+        10031, 10071, 10110, 10148, 10186, 10224, 10263, 10301, 10339, 10378,
+        10409, 10430, 10451, 10472, 10492, 10513, 10534, 10555, 10575, 10594
+    },
+    // 179 mm/s
+    {
+         4807,  4877,  4947,  5020,  5104,  5189,  5273,  5357,  5428,  5492,
+         5556,  5620,  5684,  5748,  5811,  5875,  5939,  6020,  6129,  6238,
+         6347,  6456,  6565,  6674,  6783,  6892,  6988,  7046,  7104,  7161,
+         7219,  7277,  7335,  7393,  7450,  7508,  7558,  7608,  7659,  7709,
+         7759,  7809,  7859,  7909,  7960,  8006,  8051,  8096,  8142,  8187,
+         8232,  8277,  8322,  8368,  8419,  8476,  8533,  8590,  8647,  8704,
+         8761,  8819,  8876,  8926,  8956,  8986,  9015,  9045,  9075,  9105,
+         9135,  9164,  9194,  9243,  9293,  9342,  9391,  9440,  9489,  9538,
+         9587,  9636,  9679,  9722,  9764,  9806,  9848,  9891,  9933,  9975,
+        10017, 10057, 10095, 10133, 10171, 10209, 10247, 10285, 10323, 10361,
+        10393, 10413, 10434, 10455, 10476, 10496, 10517, 10538, 10559, 10577
+    },
+    // 180 mm/s
+    {
+         4800,  4870,  4940,  5013,  5098,  5182,  5267,  5351,  5423,  5487,
+         5550,  5614,  5678,  5741,  5805,  5869,  5932,  6013,  6122,  6231,
+         6340,  6450,  6559,  6668,  6777,  6886,  6982,  7039,  7097,  7154,
+         7211,  7269,  7326,  7383,  7441,  7498,  7548,  7598,  7649,  7699,
+         7749,  7800,  7850,  7900,  7951,  7997,  8042,  8087,  8132,  8177,
+         8222,  8267,  8312,  8357,  8407,  8464,  8521,  8578,  8635,  8692,
+         8749,  8806,  8863,  8913,  8943,  8973,  9002,  9032,  9062,  9092,
+         9121,  9151,  9181,  9230,  9279,  9328,  9377,  9426,  9476,  9525,
+         9574,  9623,  9666,  9708,  9750,  9792,  9834,  9877,  9919,  9961,
+        10003, 10042, 10080, 10118, 10156, 10193, 10231, 10269, 10307, 10344,
+        10376, 10397, 10417, 10438, 10459, 10480, 10500, 10521, 10542, 10560
+    }
+};
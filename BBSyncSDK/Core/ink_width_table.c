@@ -0,0 +1,79 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ink_width_table.h"
+
+// Array of digitizer pressure readings for which line widths are provided.
+const uint16_t inkWidthTableMass[INK_WIDTH_TABLE_MASSES] = {M2P(10.0f), M2P(25.0f), M2P(50.0f), M2P(100.0f),
+    M2P(150.0f), M2P(200.0f), M2P(250.0f), M2P(300.0f), M2P(350.0f),
+    M2P(400.0f), M2P(450.0f), M2P(500.0f), M2P(550.0f), M2P(600.0f)};
+
+// Array of line widths vs. pressure at various velocities.
+const lwmap_t inkWidthTable[INK_WIDTH_TABLE_SPEEDS] =
+{
+    //   v(mm/s)       10g*               25g*               50g               100g               150g               200g               250g               300g               350g               400g               450g               500g               550g*              600g*
+    {V2D(  1.0f), { MM2DIG(0.720000f), MM2DIG(0.800000f), MM2DIG(0.908937f), MM2DIG(1.108957f), MM2DIG(1.266351f), MM2DIG(1.388042f), MM2DIG(1.462073f), MM2DIG(1.540000f), MM2DIG(1.618852f), MM2DIG(1.701938f), MM2DIG(1.793265f), MM2DIG(1.860000f), MM2DIG(1.920000f), MM2DIG(1.954108f)}},
+    {V2D(  5.0f), { MM2DIG(0.490000f), MM2DIG(0.530000f), MM2DIG(0.614119f), MM2DIG(0.758321f), MM2DIG(0.868824f), MM2DIG(0.910000f), MM2DIG(0.942034f), MM2DIG(1.000218f), MM2DIG(1.047881f), MM2DIG(1.083052f), MM2DIG(1.155148f), MM2DIG(1.196536f), MM2DIG(1.250000f), MM2DIG(1.286546f)}},
+    {V2D( 30.0f), { MM2DIG(0.300000f), MM2DIG(0.340000f), MM2DIG(0.387672f), MM2DIG(0.493372f), MM2DIG(0.565948f), MM2DIG(0.620261f), MM2DIG(0.673648f), MM2DIG(0.710716f), MM2DIG(0.746997f), MM2DIG(0.777846f), MM2DIG(0.815101f), MM2DIG(0.837235f), MM2DIG(0.880000f), MM2DIG(0.926857f)}},
+    {V2D( 75.0f), { MM2DIG(0.290000f), MM2DIG(0.295000f), MM2DIG(0.320000f), MM2DIG(0.374948f), MM2DIG(0.422921f), MM2DIG(0.473530f), MM2DIG(0.508386f), MM2DIG(0.541358f), MM2DIG(0.577623f), MM2DIG(0.600577f), MM2DIG(0.621771f), MM2DIG(0.651861f), MM2DIG(0.670000f), MM2DIG(0.690000f)}},
+    {V2D(100.0f), { MM2DIG(0.280000f), MM2DIG(0.290000f), MM2DIG(0.302881f), MM2DIG(0.338898f), MM2DIG(0.387231f), MM2DIG(0.433664f), MM2DIG(0.452389f), MM2DIG(0.482745f), MM2DIG(0.516970f), MM2DIG(0.534589f), MM2DIG(0.557370f), MM2DIG(0.581577f), MM2DIG(0.610000f), MM2DIG(0.620000f)}},
+    {V2D(180.0f), { MM2DIG(0.250000f), MM2DIG(0.260000f), MM2DIG(0.280375f), MM2DIG(0.311056f), MM2DIG(0.362906f), MM2DIG(0.390511f), MM2DIG(0.414745f), MM2DIG(0.436406f), MM2DIG(0.463840f), MM2DIG(0.478165f), MM2DIG(0.501515f), MM2DIG(0.521805f), MM2DIG(0.540000f), MM2DIG(0.550000f)}}
+};
+
+float inkWidthTableLookup(float dist, float pressure)
+{
+    const uint16_t *mass = inkWidthTableMass;
+    const lwmap_t *lwmap = inkWidthTable;
+    uint8_t i, j;
+    float lwa, lwb;
+
+    // Saturate distance at range we have data for.
+    if (dist < lwmap[0].distance)
+        dist = lwmap[0].distance;
+    else if (dist > lwmap[INK_WIDTH_TABLE_SPEEDS-1].distance)
+        dist = lwmap[INK_WIDTH_TABLE_SPEEDS-1].distance;
+
+    // Saturate pressure at range we have data for.
+    if (pressure < mass[0])
+        pressure = mass[0];
+    else if (pressure > mass[INK_WIDTH_TABLE_MASSES - 1])
+        pressure = mass[INK_WIDTH_TABLE_MASSES - 1];
+
+    // Find the indices for distance (velocity).
+    for (i = 1; i < INK_WIDTH_TABLE_SPEEDS - 1; i++)
+    {
+        if (dist <= lwmap[i].distance)
+            break;
+    }
+
+    // Find the indices for mass (pressure).
+    for (j = 1; j < INK_WIDTH_TABLE_MASSES - 1; j++)
+    {
+        if (pressure <= mass[j])
+            break;
+    }
+
+    // Interpolate based on mass (pressure) first.
+    lwa = lwmap[i-1].lineWidth[j-1]  +  (pressure - mass[j-1])*(lwmap[i-1].lineWidth[j-0] - lwmap[i-1].lineWidth[j-1])/(mass[j-0] - mass[j-1]);
+    lwb = lwmap[i-0].lineWidth[j-1]  +  (pressure - mass[j-1])*(lwmap[i-0].lineWidth[j-0] - lwmap[i-0].lineWidth[j-1])/(mass[j-0] - mass[j-1]);
+
+    // Interpolate based on speed (distance) second.
+    return lwa + (dist - lwmap[i-1].distance)*(lwb - lwa)/(lwmap[i-0].distance - lwmap[i-1].distance);
+}
@@ -0,0 +1,70 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _INK_WIDTH_TABLE_H_
+#define _INK_WIDTH_TABLE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TICKS_PER_MM    100         // Digitizer resolution is 0.01 mm
+#define MS_PER_SAMPLE   6.924f      // 144.425 samples per second
+#define PEN_ANGLE_COS   0.866f      // Assuming stylus held at 30 deg angle.
+#define SCALE           0.75f       // Scale factor for reported linewidth (to make recorded lines sharper than actual device).
+
+// Macro to convert from velocity in mm/s to distance (in digitizer units) between successive samples.
+#define V2D(vel)       ((vel)*TICKS_PER_MM*MS_PER_SAMPLE/1000)
+
+// Macro to convert from line width expressed in mm to scaled line width expressed in digitizer units.
+#define MM2DIG(mm)     ((mm)*TICKS_PER_MM*SCALE)
+
+// Macro to convert from mass in grams (normal to surface) to corresponding digitizer pressure reading (along stylus).
+#define M2P(mass)      ((mass)*PEN_ANGLE_COS*1023.0f/600.0f + 0.5f)
+
+// Measured line widths, in digitizer units, for a few stylus speeds (as
+// distance between samples) and masses (as digitizer pressure). Line width
+// lookups in the filter use the dense grid generated from this table by
+// Tools/bbwidthgen; this table is the reference for it.
+#define INK_WIDTH_TABLE_SPEEDS      6
+#define INK_WIDTH_TABLE_MASSES      14
+
+extern const uint16_t inkWidthTableMass[INK_WIDTH_TABLE_MASSES];
+
+// Data type for encoding trace width versus stylus speed.
+typedef struct
+{
+    float    distance;                              // In digitizer units (speed ~ distance between consecutive points).
+    float    lineWidth[INK_WIDTH_TABLE_MASSES];     // In digitizer units.
+} lwmap_t;
+
+extern const lwmap_t inkWidthTable[INK_WIDTH_TABLE_SPEEDS];
+
+// Interpolates the table at a distance between samples and a pressure, both
+// saturated at the range the table has data for.
+float inkWidthTableLookup(float dist, float pressure);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INK_WIDTH_TABLE_H_ */
@@ -0,0 +1,92 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "obex_packet.h"
+
+// Code, length, version, flags and maximum packet length.
+#define OBEX_CONNECT_HEADER_LENGTH  7
+
+static inline uint16_t readLength(const uint8_t *bytes)
+{
+    return (uint16_t)(bytes[0] << 8 | bytes[1]);
+}
+
+int obexPacketParse(obexPacket_t *p, const uint8_t *bytes, size_t length, int connect)
+{
+    size_t offset = OBEX_PACKET_HEADER_LENGTH, headerLength, prefix;
+    uint8_t id;
+
+    p->headerCount = 0;
+    p->version = p->flags = 0;
+    p->maxLength = 0;
+    if (length < OBEX_PACKET_HEADER_LENGTH)
+        return -1;
+    p->code = bytes[0];
+    p->length = readLength(bytes + 1);
+    if (p->length < OBEX_PACKET_HEADER_LENGTH || p->length > length)
+        return -1;
+    length = p->length;
+
+    if (connect && length >= OBEX_CONNECT_HEADER_LENGTH)
+    {
+        p->version = bytes[3];
+        p->flags = bytes[4];
+        p->maxLength = readLength(bytes + 5);
+        offset = OBEX_CONNECT_HEADER_LENGTH;
+    }
+
+    while (offset < length)
+    {
+        // The top two bits of the id give the encoding of the value.
+        id = bytes[offset];
+        switch (id >> 6)
+        {
+            case 0:     // Unicode text and byte sequences carry a length.
+            case 1:
+                if (length - offset < 3)
+                    return -1;
+                headerLength = readLength(bytes + offset + 1);
+                if (headerLength < 3)
+                    return -1;
+                prefix = 3;
+                break;
+            case 2:     // One byte.
+                headerLength = 2;
+                prefix = 1;
+                break;
+            default:    // Four bytes.
+                headerLength = 5;
+                prefix = 1;
+                break;
+        }
+        if (headerLength > length - offset)
+            return -1;
+
+        if (p->headerCount < OBEX_PACKET_MAX_HEADERS)
+        {
+            obexHeader_t *h = &p->headers[p->headerCount++];
+            h->id = id;
+            h->offset = (uint16_t)(offset + prefix);
+            h->length = (uint16_t)(headerLength - prefix);
+        }
+        offset += headerLength;
+    }
+    return 0;
+}
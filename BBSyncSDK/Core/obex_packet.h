@@ -0,0 +1,95 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _OBEX_PACKET_H_
+#define _OBEX_PACKET_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Response code and packet length.
+#define OBEX_PACKET_HEADER_LENGTH   3
+
+// Headers kept per packet. A Sync response carries at most a connection id,
+// a who and a body; headers past this many are checked but not kept.
+#define OBEX_PACKET_MAX_HEADERS     8
+
+#define OBEX_HEADER_BODY            0x48
+#define OBEX_HEADER_END_OF_BODY     0x49
+
+// A header found in a packet. Its value stays in the packet's bytes: text and
+// byte sequences without their length prefix, 1 and 4 byte values as sent.
+typedef struct
+{
+    uint8_t  id;
+    uint16_t offset;                    // Of the value from the start of the packet.
+    uint16_t length;                    // Of the value.
+} obexHeader_t;
+
+// A response parsed in place. Nothing is copied out of the packet, so the
+// views are only valid while its bytes are.
+typedef struct
+{
+    uint8_t      code;
+    uint16_t     length;                // Of the whole packet.
+    uint8_t      version;               // Only in connect responses.
+    uint8_t      flags;
+    uint16_t     maxLength;
+    uint8_t      headerCount;
+    obexHeader_t headers[OBEX_PACKET_MAX_HEADERS];
+} obexPacket_t;
+
+// Parses a response of length bytes. Connect responses carry the version,
+// flags and maximum packet length before their headers and are only told
+// apart by the request that was sent. Returns 0 on success, -1 if the packet
+// is shorter than its length or a header runs past its end.
+int obexPacketParse(obexPacket_t *p, const uint8_t *bytes, size_t length, int connect);
+
+// Returns the first header with this id, or NULL if the packet has none.
+static inline const obexHeader_t *obexPacketFindHeader(const obexPacket_t *p, uint8_t id)
+{
+    for (uint8_t i = 0; i < p->headerCount; i++)
+    {
+        if (p->headers[i].id == id)
+            return &p->headers[i];
+    }
+    return NULL;
+}
+
+// Returns the body or end of body header, whichever the packet has.
+static inline const obexHeader_t *obexPacketBody(const obexPacket_t *p)
+{
+    for (uint8_t i = 0; i < p->headerCount; i++)
+    {
+        if (p->headers[i].id == OBEX_HEADER_BODY || p->headers[i].id == OBEX_HEADER_END_OF_BODY)
+            return &p->headers[i];
+    }
+    return NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _OBEX_PACKET_H_ */
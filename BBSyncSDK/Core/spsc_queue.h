@@ -0,0 +1,87 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _SPSC_QUEUE_H_
+#define _SPSC_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bounded lock-free queue of fixed size elements for exactly one producer
+// thread and one consumer thread. Elements are copied in and out.
+typedef struct
+{
+    uint8_t *slots;
+    size_t   elementSize;
+    size_t   capacity;      // Always a power of two.
+    size_t   head;          // Total elements popped, written by the consumer only.
+    size_t   tail;          // Total elements pushed, written by the producer only.
+} spscQueue_t;
+
+// Allocates room for capacity elements (rounded up to a power of two).
+// Returns 0 on success, -1 if the allocation failed.
+int spscQueueInit(spscQueue_t *q, size_t elementSize, size_t capacity);
+
+void spscQueueFree(spscQueue_t *q);
+
+// Producer: copies the element in. Returns 0 if the queue was full.
+static inline int spscQueuePush(spscQueue_t *q, const void *element)
+{
+    size_t tail = q->tail;
+    size_t head = __atomic_load_n(&q->head, __ATOMIC_ACQUIRE);
+
+    if (tail - head == q->capacity)
+        return 0;
+
+    memcpy(q->slots + (tail & (q->capacity - 1))*q->elementSize, element, q->elementSize);
+    __atomic_store_n(&q->tail, tail + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+// Consumer: copies the oldest element out. Returns 0 if the queue was empty.
+static inline int spscQueuePop(spscQueue_t *q, void *element)
+{
+    size_t head = q->head;
+    size_t tail = __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE);
+
+    if (head == tail)
+        return 0;
+
+    memcpy(element, q->slots + (head & (q->capacity - 1))*q->elementSize, q->elementSize);
+    __atomic_store_n(&q->head, head + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+// Either side: approximate number of queued elements.
+static inline size_t spscQueueCount(spscQueue_t *q)
+{
+    return __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE) - __atomic_load_n(&q->head, __ATOMIC_ACQUIRE);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SPSC_QUEUE_H_ */
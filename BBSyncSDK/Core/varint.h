@@ -0,0 +1,82 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _VARINT_H_
+#define _VARINT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Longest encoding of a 64 bit value.
+#define VARINT_MAX_LENGTH   10
+
+// Writes value as a little endian base 128 varint. Returns the bytes written.
+static inline size_t varintEncode(uint64_t value, uint8_t *dst)
+{
+    size_t n = 0;
+
+    while (value >= 0x80)
+    {
+        dst[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    dst[n++] = (uint8_t)value;
+    return n;
+}
+
+// Reads a varint from at most length bytes. Returns the bytes read, or 0 if
+// the input is truncated or longer than VARINT_MAX_LENGTH.
+static inline size_t varintDecode(const uint8_t *src, size_t length, uint64_t *value)
+{
+    uint64_t v = 0;
+    size_t n;
+
+    for (n = 0; n < length && n < VARINT_MAX_LENGTH; n++)
+    {
+        v |= (uint64_t)(src[n] & 0x7f) << (7*n);
+        if (!(src[n] & 0x80))
+        {
+            *value = v;
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+// Maps signed values to unsigned so small magnitudes encode short.
+static inline uint64_t zigzagEncode(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static inline int64_t zigzagDecode(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VARINT_H_ */
@@ -0,0 +1,51 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  The 'HIDFrameDecoder' class wraps the streaming frame decoder. It keeps any
+ *  partially received frame between calls so frames split across stream reads
+ *  are not lost.
+ */
+@interface HIDFrameDecoder : NSObject
+
+/**
+ *  Number of frames dropped because of a failed CRC check.
+ */
+@property (nonatomic, readonly) NSUInteger crcErrors;
+
+/**
+ *  Decodes the bytes and appends a message for every complete frame.
+ *
+ *  @param bytes    Raw bytes read from the HID session.
+ *  @param length   Number of bytes.
+ *  @param messages Array the decoded messages are appended to.
+ *
+ *  @return Number of bytes consumed.
+ */
+- (NSUInteger)decodeBytes:(const void *)bytes length:(NSUInteger)length messages:(NSMutableArray *)messages;
+
+/**
+ *  Discards any partially received frame.
+ */
+- (void)reset;
+
+@end
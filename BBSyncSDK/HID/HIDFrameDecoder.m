@@ -0,0 +1,66 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#import "HIDFrameDecoder.h"
+#import "HIDUtilities.h"
+#import "hid_decoder.h"
+
+@interface HIDFrameDecoder() {
+    hidDecoder_t _decoder;
+}
+
+@end
+
+@implementation HIDFrameDecoder
+
+static int appendMessage(void *context, const uint8_t *frame, size_t length) {
+    HIDMessage *message = [HIDUtilities messageFromFrame:frame length:length];
+    if(message) {
+        [(__bridge NSMutableArray *)context addObject:message];
+    }
+    return 0;
+}
+
+- (id)init {
+    self = [super init];
+    if(self) {
+        hidDecoderReset(&_decoder);
+    }
+    return self;
+}
+
+- (NSUInteger)decodeBytes:(const void *)bytes length:(NSUInteger)length messages:(NSMutableArray *)messages {
+    uint32_t crcErrors = _decoder.crcErrors;
+    size_t consumed = hidDecoderFeed(&_decoder, bytes, length, appendMessage, (__bridge void *)messages);
+    if(_decoder.crcErrors != crcErrors) {
+        NSLog(@"CRC check failed.");
+    }
+    return consumed;
+}
+
+- (void)reset {
+    hidDecoderReset(&_decoder);
+}
+
+- (NSUInteger)crcErrors {
+    return _decoder.crcErrors;
+}
+
+@end
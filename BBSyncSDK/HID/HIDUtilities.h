@@ -20,6 +20,8 @@
 
 #import <Foundation/Foundation.h>
 
+@class HIDMessage;
+
 extern char const FEND;
 extern char const FESC;
 extern char const TFEND;
@@ -35,5 +37,6 @@ extern char const REQUEST_REPORT_ID;
 + (unsigned short)CRC8OnData:(NSData *)data;
 + (NSData *)framedData:(NSData *)data;
 + (NSArray *)parsedMessagesFromData:(NSData *)data;
++ (HIDMessage *)messageFromFrame:(const uint8_t *)frame length:(NSUInteger)length;
 
 @end
@@ -24,93 +24,45 @@
 #import "HIDGetReport.h"
 #import "HIDDataMessage.h"
 #import "BBSyncCaptureMessage.h"
+#import "HIDFrameDecoder.h"
+#import "hid_crc.h"
+#import "hid_slip.h"
 
 char const FEND = 0xC0;
 char const FESC = 0xDB;
 char const TFEND = 0xDC;
 char const TFESC = 0xDD;
-#define POLY 0x8408
 
 @implementation HIDUtilities
 
 + (NSData *)removeEscapeFromData:(NSData *)data {
-    const char *bytes = [data bytes];
-    NSMutableData *unescapedData = [[NSMutableData alloc] init];
+    NSMutableData *unescapedData = [[NSMutableData alloc] initWithLength:data.length];
     if (data) {
-        // Take out all the escape sequences in the data.
-        for(int i=0; i< [data length]; i++){
-            char currentByte = bytes[i];
-            
-            if(currentByte == FEND && i ==0)
-                continue;
-            else if(currentByte == FEND && i+1 == [data length])
-                break;
-            else if(currentByte == FESC) {
-                currentByte = bytes[++i];
-                if(currentByte == TFEND)
-                    currentByte = FEND;
-                else if(currentByte ==TFESC)
-                    currentByte = FESC;
-            }            
-            [unescapedData appendBytes:&currentByte length:1];
-        }
+        // Take out all the escape sequences and frame ends in the data.
+        NSUInteger length = hidSlipUnescape([data bytes], data.length, [unescapedData mutableBytes]);
+        [unescapedData setLength:length];
     }
     return unescapedData;
 }
 
 + (NSData *)escapeData:(NSData *)data {
-    const char *bytes = [data bytes];
-    NSMutableData *escapedData = [[NSMutableData alloc] init];
+    NSMutableData *escapedData = [[NSMutableData alloc] initWithLength:HID_SLIP_ESCAPED_MAX(data.length)];
     if (data) {
-        // Take out all the escape sequences in the data.
-        for(int i=0; i< [data length]; i++){
-            char currentByte = bytes[i];
-            
-            if(currentByte == FESC && i != 0 && i+1 != [data length]) {
-                [escapedData appendBytes:&FESC length:1];
-                [escapedData appendBytes:&TFEND length:1];
-                continue;
-            } else if(currentByte == FESC) {
-                [escapedData appendBytes:&FESC length:1];
-                [escapedData appendBytes:&TFESC length:1];
-                continue;
-            }
-            [escapedData appendBytes:&currentByte length:1];
-        }
+        NSUInteger length = hidSlipEscape([data bytes], data.length, [escapedData mutableBytes]);
+        [escapedData setLength:length];
     }
     return escapedData;
 }
 
 + (unsigned short)CRC8OnData:(NSData *)data {
-    unsigned short crc = 0xffff;
-    NSUInteger length = [data length];
-    const char *bufp = [data bytes];
-    NSUInteger len;
-    static unsigned short lotab[16] = {
-        0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
-        0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
-    };
-    static unsigned short hitab[16] = {
-        0x0000, 0x1081, 0x2102, 0x3183, 0x4204, 0x5285, 0x6306, 0x7387,
-        0x8408, 0x9489, 0xa50a, 0xb58b, 0xc60c, 0xd68d, 0xe70e, 0xf78f,
-    };
-    for (len = length; len > 0; len--) {
-        unsigned char ch = *bufp++ ^ crc;
-        crc = (crc >> 8) ^ lotab[ch&0xf] ^ hitab[(ch&0xf0) >> 4];
-    }
-    return crc;
+    return hidCRCUpdate(HID_CRC_INIT, [data bytes], [data length]);
 }
 
 + (NSData *)framedData:(NSData *)data {
-    // Generate CRC.
-    unsigned short crc = [HIDUtilities CRC8OnData:data];
-    
-    // Frame the data and create the packet to be returned.
-    NSMutableData *packet = [[NSMutableData alloc] init];
-    [packet appendBytes:&FEND length:1];
-    [packet appendData:data];
-    [packet appendBytes:&crc length:2];
-    [packet appendBytes:&FEND length:1];
+    // Frame the data, escaping it and the CRC so neither can end the frame early.
+    NSMutableData *packet = [[NSMutableData alloc] initWithLength:HID_SLIP_FRAME_MAX(data.length)];
+    NSUInteger length = hidSlipEncodeFrame([data bytes], data.length, [packet mutableBytes]);
+    [packet setLength:length];
     
     return packet;
 }
@@ -119,79 +71,59 @@ char const TFESC = 0xDD;
     NSMutableArray *messages = [NSMutableArray new];
     
     if(data) {
-        char const *bytes = [data bytes];
-        NSMutableData *unescapedData = [[NSMutableData alloc] init];
+        // A fresh decoder keeps this call stateless, streams should hold on to
+        // their own HIDFrameDecoder so split frames are not dropped.
+        HIDFrameDecoder *decoder = [HIDFrameDecoder new];
+        [decoder decodeBytes:[data bytes] length:data.length messages:messages];
+    }
+    return messages;
+}
+
++ (HIDMessage *)messageFromFrame:(const uint8_t *)frame length:(NSUInteger)length {
+    // Handshakes are only the channel and header bytes, data messages follow
+    // them with a report ID.
+    if(length < 2) {
+        return nil;
+    }
     
-        // Remove all escape sequences in the data.
-        for(int i=0; i < data.length; i++) {
-            char currentByte = bytes[i];
-            
-            if(currentByte == FEND && i ==0) {
-                continue;
+    char channel = frame[0];
+    char type = (frame[1] & 0xF0) >> 4;
+    char parameter = frame[1] & 0x0F;
+    char report = length >= 3 ? frame[2] : 0;
+    
+    switch(channel) {
+        case HIDMessageChannelControl:
+            if(type == HIDMessageTypeHandshake) {
+                return [[HIDHandshake alloc] initWithResultCode:parameter];
             }
-            else if(currentByte == FEND && i != 0) {
-                if(unescapedData.length >= 4) {
-                    if([HIDUtilities CRC8OnData:unescapedData] == 0){
-                        // Get the byte array as well as remove the CRC from the end of the packet.
-                        NSData *cleanData = [unescapedData subdataWithRange:NSMakeRange(0, unescapedData.length-2)];
-                        char const *cleanBytes = [cleanData bytes];
-                        char channel = cleanBytes[0];
-                        char type = (cleanBytes[1] & 0xF0) >> 4;
-                        char parameter = cleanBytes[1] & 0x0F;
-                        char report = cleanBytes[2];
-                        
-                        switch(channel) {
-                            case HIDMessageChannelControl:
-                                if(type == HIDMessageTypeHandshake) {
-                                    [messages addObject:[[HIDHandshake alloc] initWithResultCode:parameter]];
-                                }
-                                else if(type == HIDMessageTypeData) {
-                                    // Returned data messages from the Sync are from a requested get report.
-                                    // These get reports add an extra two bytes for satisfying other systems.
-                                    // Make sure to remove these two bytes.
-                                    NSData *payload = [cleanData subdataWithRange:NSMakeRange(5, cleanData.length - 5)];
-                                    [messages addObject:[[HIDDataMessage alloc] initWithChannel:channel reportType:parameter reportId:report payload:payload]];
-                                }
-                                break;
-                            case HIDMessageChannelInterrupt:
-                                if(type == HIDMessageTypeData) {
-                                    NSData *payload = [cleanData subdataWithRange:NSMakeRange(3, cleanData.length - 3)];
-                                    if(report == BBSyncCaptureMessageReportIdDataCapture || report == BBSyncCaptureMessageReportIdDigitizer) {
-                                        [messages addObject:[[BBSyncCaptureMessage alloc] initWithReportId:report captureData:payload]];
-                                    }
-                                    else {
-                                        [messages addObject:[[HIDDataMessage alloc] initWithChannel:channel reportType:parameter reportId:report payload:payload]];
-                                    }
-                                }
-                                else {
-                                    [messages addObject:[[HIDMessage alloc] initWithType:type channel:channel parameter:parameter]];
-                                }
-                                break;
-                            default:
-                                break;
-                        }
-                    }
-                    else {
-                        NSLog(@"CRC check failed.");
-                    }
-                    [unescapedData setLength:0];
-                }
-                continue;
+            else if(type == HIDMessageTypeData && length >= 5) {
+                // Returned data messages from the Sync are from a requested get report.
+                // These get reports add an extra two bytes for satisfying other systems.
+                // Make sure to remove these two bytes.
+                NSData *payload = [NSData dataWithBytes:frame + 5 length:length - 5];
+                return [[HIDDataMessage alloc] initWithChannel:channel reportType:parameter reportId:report payload:payload];
             }
-            else if(currentByte == FESC) {
-                currentByte = bytes[++i];
-                if(currentByte == TFEND) {
-                    currentByte = FEND;
+            break;
+        case HIDMessageChannelInterrupt:
+            if(type == HIDMessageTypeData && length >= 3) {
+                NSData *payload = [NSData dataWithBytes:frame + 3 length:length - 3];
+                if(report == BBSyncCaptureMessageReportIdDataCapture || report == BBSyncCaptureMessageReportIdDigitizer) {
+                    if(payload.length >= kBBSyncCaptureMessageLength) {
+                        return [[BBSyncCaptureMessage alloc] initWithReportId:report captureData:payload];
+                    }
                 }
-                else if(currentByte ==TFESC) {
-                    currentByte = FESC;
+                else {
+                    return [[HIDDataMessage alloc] initWithChannel:channel reportType:parameter reportId:report payload:payload];
                 }
             }
-            
-            [unescapedData appendBytes:&currentByte length:1];
-        }
+            else if(type != HIDMessageTypeData) {
+                return [[HIDMessage alloc] initWithType:type channel:channel parameter:parameter];
+            }
+            break;
+        default:
+            break;
     }
-    return messages;
+    return nil;
 }
 
 @end
@@ -60,6 +60,8 @@ typedef NS_ENUM(char, BTFtpRequestState) {
 @property (nonatomic) NSUInteger length;
 @property (nonatomic) NSData *maxSize;
 @property (nonatomic) int state;
+// Called with the result instead of the client's delegate, if set.
+@property (nonatomic, copy) void (^completion)(id result, NSError *error);
 
 - (id)initWithOpCode:(char)opCode;
 - (void)addHeader:(OBEXFileTransferHeader *)header;
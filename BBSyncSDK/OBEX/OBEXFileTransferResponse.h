@@ -57,12 +57,25 @@ static char const DATABASE_LOCKED = 0xE1;
 @interface OBEXFileTransferResponse : NSObject
 
 @property(nonatomic, retain) NSData *data;
-@property(nonatomic, retain) NSMutableDictionary *headers;
 @property(nonatomic, assign) NSInteger length;
 @property(nonatomic, assign) NSInteger maxLength;
 @property(nonatomic, readonly) char code;
 @property(nonatomic, readonly) char version;
 @property(nonatomic, readonly) char flag;
 
-- (id)initWithData:(NSData *)data;
+/** Parses data in place. The headers are views into data, so it must not change while the response is in use.
+ 
+ @param connect Whether this answers a connect request, whose response carries the version, flags and maximum packet length before its headers.
+ */
+- (id)initWithData:(NSData *)data connect:(BOOL)connect;
+
+/** Returns a copy of the value of the header with this identifier, or nil if the response has none. */
+- (NSData *)dataForHeader:(char)identifier;
+
+/** Appends the value of the body or end of body header straight from the packet.
+ 
+ @return NO if the response has no body.
+ */
+- (BOOL)appendBodyToData:(NSMutableData *)data;
+
 @end
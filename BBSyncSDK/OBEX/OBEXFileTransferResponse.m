@@ -19,67 +19,46 @@
 // SOFTWARE.
 
 #import "OBEXFileTransferResponse.h"
-#import "OBEXFileTransferUtilities.h"
-#import "OBEXFileTransferHeader.h"
+#import "obex_packet.h"
+
+@interface OBEXFileTransferResponse () {
+    obexPacket_t _packet;
+}
+
+@end
 
 @implementation OBEXFileTransferResponse
 
-- (id)initWithData:(NSData *)data {
+- (id)initWithData:(NSData *)data connect:(BOOL)connect {
     if (self = [super init]) {
-        _length = -1;
-        _maxLength = -1;
-        _headers = [NSMutableDictionary dictionaryWithCapacity:10];
         _data = data;
-        [self parseResponse];
+        if(obexPacketParse(&_packet, data.bytes, data.length, connect) != 0) {
+            NSLog(@"Received malformed OBEX response.");
+        }
+        _code = (char)_packet.code;
+        _length = _packet.length;
+        _version = (char)_packet.version;
+        _flag = (char)_packet.flags;
+        _maxLength = connect ? _packet.maxLength : -1;
     }
     return self;
 }
 
-- (void)parseResponse {   
-    NSInteger currentIndex = 3;
-    [self.data getBytes:&_code length:1];
-    self.length = [OBEXFileTransferUtilities getLength:[self.data subdataWithRange:NSMakeRange(1, 2)]];
-    
-    if (self.length > 3) {
-        
-        char temp;
-        [self.data getBytes:&temp range:NSMakeRange(3, 1)];
-        
-        // Weak condition to check if it was a connection response.
-        if (temp == 16) {
-            [self.data getBytes:&_version range:NSMakeRange(3, 1)];
-            [self.data getBytes:&_flag range:NSMakeRange(4, 1)];
-            self.maxLength = [OBEXFileTransferUtilities getLength:[self.data subdataWithRange:NSMakeRange(5, 2)]];
-            currentIndex = 7;
-        }
-        
-        // Loop until the whole packet has been parsed.
-        while (currentIndex < self.data.length) {
-            char identifier;
-            NSInteger headerLength;
-            OBEXFileTransferHeader *temp;
-            
-            // Get the header id and header length.
-            [self.data getBytes:&identifier range:NSMakeRange(currentIndex, 1)];
-            headerLength = [OBEXFileTransferUtilities getLength:[self.data subdataWithRange:NSMakeRange(currentIndex + 1, 2)]];            
-            
-            // Format the headerId as a NSString to use with a NSDictionary.
-            NSString* key = [NSString stringWithFormat:@"%c" , identifier];
-            
-            // This is needed because Connection Id and Length headers have no length attribute.
-            if (identifier == CONNECTION_ID || identifier == LENGTH) {
-                temp = [[OBEXFileTransferHeader alloc] initWithIdentifier:identifier body:[self.data subdataWithRange:NSMakeRange(currentIndex + 1, 4)]];
-                currentIndex += 5;
-            }
-            // Take care of a regular header that has a length corresponding to it.
-            else {
-                temp = [[OBEXFileTransferHeader alloc] initWithIdentifier:identifier body:[self.data subdataWithRange:NSMakeRange(currentIndex + 3, headerLength - 3)]];
-                currentIndex += headerLength;
-            }      
-            // Add the header to the dictionary.
-            [self.headers setObject:temp forKey:key];
-        }        
+- (NSData *)dataForHeader:(char)identifier {
+    const obexHeader_t *header = obexPacketFindHeader(&_packet, (uint8_t)identifier);
+    if(header == NULL) {
+        return nil;
+    }
+    return [NSData dataWithBytes:(const uint8_t *)self.data.bytes + header->offset length:header->length];
+}
+
+- (BOOL)appendBodyToData:(NSMutableData *)data {
+    const obexHeader_t *header = obexPacketBody(&_packet);
+    if(header == NULL) {
+        return NO;
     }
+    [data appendBytes:(const uint8_t *)self.data.bytes + header->offset length:header->length];
+    return YES;
 }
 
 @end
@@ -0,0 +1,368 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Checks and times the HID frame decoder on a synthetic capture stream: the
+// stream is decoded whole and again split at random points, and both must give
+// the same frames. Then times filling capture batches against allocating a
+// message per sample the way the SDK used to, and the frame CRC against the
+// nibble table one it replaced.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "capture_batch.h"
+#include "hid_crc.h"
+#include "hid_decoder.h"
+#include "hid_slip.h"
+#include "monotonic_time.h"
+
+#define INTERRUPT_CHANNEL   0x01
+#define DATA_MESSAGE_HEADER 0xA1    // Data message, input report.
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bbdecode [-n frames] [-f bytes] [-s seed]\n"
+                    "  -n frames  capture reports in the stream (default 1000000)\n"
+                    "  -f bytes   longest piece the stream is split into (default 64)\n"
+                    "  -s seed    seed of the random reports and split points\n");
+    exit(2);
+}
+
+static uint64_t randomState = 0x9E3779B97F4A7C15ull;
+
+static uint64_t nextRandom(void)
+{
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    return randomState*0x2545F4914F6CDD1Dull;
+}
+
+// Decoded frames, each as its length followed by its bytes.
+typedef struct
+{
+    uint8_t *bytes;
+    size_t   length;
+    size_t   capacity;
+    size_t   frames;
+} frameLog_t;
+
+static int logFrame(void *context, const uint8_t *frame, size_t length)
+{
+    frameLog_t *log = context;
+
+    if (log->length + 1 + length <= log->capacity)
+    {
+        log->bytes[log->length++] = (uint8_t)length;
+        memcpy(log->bytes + log->length, frame, length);
+        log->length += length;
+    }
+    log->frames++;
+    return 0;
+}
+
+static int countFrame(void *context, const uint8_t *frame, size_t length)
+{
+    (void)frame;
+    (void)length;
+    (*(size_t *)context)++;
+    return 0;
+}
+
+// Fills capture batches, emptying them when full.
+static int batchFrame(void *context, const uint8_t *frame, size_t length)
+{
+    captureBatch_t *batch = context;
+
+    if (captureBatchIsFull(batch))
+        captureBatchClear(batch);
+    captureBatchAppendFrame(batch, frame, length, 0);
+    return 0;
+}
+
+// What decoding a read cost when every sample became a BBSyncCaptureMessage
+// made by initWithReportId:captureData:. Objects are modeled by their
+// allocations: per sample the frame without its CRC and the payload, both
+// from subdataWithRange:, and the message; per read the array of messages.
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t pressure;
+    uint8_t  flags;
+} messageModel_t;
+
+typedef struct
+{
+    void   *isa;
+    uint8_t channel;
+    uint8_t reportType;
+    uint8_t reportId;
+    void   *payload;
+    messageModel_t sample;
+} captureMessageModel_t;
+
+typedef struct
+{
+    void  **objects;
+    size_t  count;
+    size_t  capacity;
+    size_t  allocations;
+} messageArrayModel_t;
+
+static void *modelAlloc(messageArrayModel_t *a, size_t size)
+{
+    void *p = malloc(size);
+
+    a->allocations++;
+    if (a->count == a->capacity)
+    {
+        a->capacity = a->capacity ? a->capacity*2 : 16;
+        a->objects = realloc(a->objects, a->capacity*sizeof(void *));
+        a->allocations++;
+    }
+    a->objects[a->count++] = p;
+    return p;
+}
+
+static int messageFrame(void *context, const uint8_t *frame, size_t length)
+{
+    messageArrayModel_t *array = context;
+    captureMessageModel_t *message;
+    uint8_t *clean, *payload;
+
+    clean = modelAlloc(array, length);
+    memcpy(clean, frame, length);
+    payload = modelAlloc(array, length - 3);
+    memcpy(payload, clean + 3, length - 3);
+    message = modelAlloc(array, sizeof(*message));
+    message->channel = clean[0];
+    message->reportType = clean[1] & 0x0f;
+    message->reportId = clean[2];
+    message->payload = payload;
+    message->sample.x = (uint16_t)(payload[0] | payload[1] << 8);
+    message->sample.y = (uint16_t)(payload[2] | payload[3] << 8);
+    message->sample.pressure = (uint16_t)(payload[4] | payload[5] << 8);
+    message->sample.flags = payload[6];
+    return 0;
+}
+
+// Decodes the stream in reads of readLength bytes, making the messages of
+// each read and releasing them before the next one. Returns the allocations.
+static size_t decodeMessages(const uint8_t *stream, size_t length, size_t readLength)
+{
+    messageArrayModel_t array;
+    hidDecoder_t decoder;
+    size_t offset, piece, allocations = 0, i;
+
+    hidDecoderReset(&decoder);
+    for (offset = 0; offset < length; offset += piece)
+    {
+        piece = length - offset < readLength ? length - offset : readLength;
+        memset(&array, 0, sizeof(array));
+        hidDecoderFeed(&decoder, stream + offset, piece, messageFrame, &array);
+        for (i = 0; i < array.count; i++)
+            free(array.objects[i]);
+        free(array.objects);
+        allocations += array.allocations;
+    }
+    return allocations;
+}
+
+// The CRC of +[HIDUtilities CRC8OnData:] before the table driven one, four
+// bits at a time.
+static uint16_t nibbleCRC(const uint8_t *bytes, size_t length)
+{
+    static const uint16_t lotab[16] = {
+        0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
+        0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+    };
+    static const uint16_t hitab[16] = {
+        0x0000, 0x1081, 0x2102, 0x3183, 0x4204, 0x5285, 0x6306, 0x7387,
+        0x8408, 0x9489, 0xa50a, 0xb58b, 0xc60c, 0xd68d, 0xe70e, 0xf78f,
+    };
+    uint16_t crc = HID_CRC_INIT;
+    uint8_t ch;
+
+    while (length-- > 0)
+    {
+        ch = *bytes++ ^ (uint8_t)crc;
+        crc = (crc >> 8) ^ lotab[ch & 0xf] ^ hitab[(ch & 0xf0) >> 4];
+    }
+    return crc;
+}
+
+// Runs both CRCs over frames of frameLength bytes cut from data, checking
+// they agree, and prints their throughput.
+static void benchmarkCRC(const uint8_t *data, size_t length, size_t frameLength)
+{
+    size_t frames = length/frameLength, i;
+    uint64_t start, nibble, table;
+    uint16_t nibbleSum = 0, tableSum = 0;
+
+    for (i = 0; i < frames; i++)
+    {
+        if (nibbleCRC(data + i*frameLength, frameLength) != hidCRCUpdate(HID_CRC_INIT, data + i*frameLength, frameLength))
+        {
+            fprintf(stderr, "bbdecode: CRCs differ on a %zu byte frame\n", frameLength);
+            exit(1);
+        }
+    }
+
+    start = monotonicTimeNanos();
+    for (i = 0; i < frames; i++)
+        nibbleSum ^= nibbleCRC(data + i*frameLength, frameLength);
+    nibble = monotonicTimeNanos() - start;
+    start = monotonicTimeNanos();
+    for (i = 0; i < frames; i++)
+        tableSum ^= hidCRCUpdate(HID_CRC_INIT, data + i*frameLength, frameLength);
+    table = monotonicTimeNanos() - start;
+    if (nibbleSum != tableSum)
+        exit(1);
+
+    printf("crc %-7zu nibble %.0f MB/s, slicing by 8 %.0f MB/s, %.1fx\n", frameLength,
+           frames*frameLength/(nibble/1e9)/1e6, frames*frameLength/(table/1e9)/1e6, (double)nibble/table);
+}
+
+// Builds a stream of framed capture reports with random coordinates, so that
+// some of them need escaping. Returns its length.
+static size_t buildStream(uint8_t *stream, size_t frames)
+{
+    uint8_t frame[3 + CAPTURE_REPORT_LENGTH];
+    size_t i, length = 0;
+    uint64_t r;
+
+    frame[0] = INTERRUPT_CHANNEL;
+    frame[1] = DATA_MESSAGE_HEADER;
+    frame[2] = CAPTURE_REPORT_ID_DATA_CAPTURE;
+    for (i = 0; i < frames; i++)
+    {
+        r = nextRandom();
+        memcpy(frame + 3, &r, CAPTURE_REPORT_LENGTH);
+        length += hidSlipEncodeFrame(frame, sizeof(frame), stream + length);
+    }
+    return length;
+}
+
+// Decodes the stream in pieces of 1 to maxPiece bytes, or whole if maxPiece is
+// 0. Returns the number of pieces.
+static size_t decode(const uint8_t *stream, size_t length, size_t maxPiece,
+                     hidDecoderFrameCallback_t callback, void *context)
+{
+    hidDecoder_t decoder;
+    size_t offset = 0, piece, pieces = 0;
+
+    hidDecoderReset(&decoder);
+    while (offset < length)
+    {
+        piece = maxPiece ? 1 + nextRandom() % maxPiece : length;
+        if (piece > length - offset)
+            piece = length - offset;
+        offset += hidDecoderFeed(&decoder, stream + offset, piece, callback, context);
+        pieces++;
+    }
+    return pieces;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t frames = 1000000, maxPiece = 64, length, pieces, counted, allocations;
+    uint64_t seed = 0, start, whole, split, batches, messages;
+    captureBatch_t batch;
+    frameLog_t wholeLog, splitLog;
+    uint8_t *stream;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:f:s:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': frames = strtoul(optarg, NULL, 10); break;
+            case 'f': maxPiece = strtoul(optarg, NULL, 10); if (maxPiece < 1) usage(); break;
+            case 's': seed = strtoull(optarg, NULL, 10); break;
+            default: usage();
+        }
+    }
+    if (optind != argc || frames == 0)
+        usage();
+    if (seed)
+        randomState = seed;
+
+    stream = malloc(HID_SLIP_FRAME_MAX(3 + CAPTURE_REPORT_LENGTH)*frames);
+    memset(&wholeLog, 0, sizeof(wholeLog));
+    memset(&splitLog, 0, sizeof(splitLog));
+    wholeLog.capacity = splitLog.capacity = (1 + 3 + CAPTURE_REPORT_LENGTH)*frames;
+    wholeLog.bytes = malloc(wholeLog.capacity);
+    splitLog.bytes = malloc(splitLog.capacity);
+    if (stream == NULL || wholeLog.bytes == NULL || splitLog.bytes == NULL)
+    {
+        fprintf(stderr, "bbdecode: out of memory\n");
+        return 1;
+    }
+    length = buildStream(stream, frames);
+
+    // Both ways must give every frame, the same.
+    decode(stream, length, 0, logFrame, &wholeLog);
+    pieces = decode(stream, length, maxPiece, logFrame, &splitLog);
+    if (wholeLog.frames != frames || splitLog.frames != frames || wholeLog.length != splitLog.length ||
+        memcmp(wholeLog.bytes, splitLog.bytes, wholeLog.length) != 0)
+    {
+        fprintf(stderr, "bbdecode: %zu frames decoded whole and %zu split into %zu pieces, of %zu, differ\n",
+                wholeLog.frames, splitLog.frames, pieces, frames);
+        return 1;
+    }
+    printf("fragment    %zu frames, %zu bytes, split into %zu pieces of 1 to %zu bytes: identical\n",
+           frames, length, pieces, maxPiece);
+
+    counted = 0;
+    start = monotonicTimeNanos();
+    decode(stream, length, 0, countFrame, &counted);
+    whole = monotonicTimeNanos() - start;
+    counted = 0;
+    start = monotonicTimeNanos();
+    decode(stream, length, maxPiece, countFrame, &counted);
+    split = monotonicTimeNanos() - start;
+    printf("decode      whole %.0f frames/s, %.2f MB/s; split %.0f frames/s, %.2f MB/s\n",
+           frames/(whole/1e9), length/(whole/1e9)/1e6, frames/(split/1e9), length/(split/1e9)/1e6);
+
+    // A read of a Sync at 144 Hz holds a few reports; 1 KiB reads favour the
+    // message path, which allocates an array per read.
+    captureBatchClear(&batch);
+    start = monotonicTimeNanos();
+    decode(stream, length, 0, batchFrame, &batch);
+    batches = monotonicTimeNanos() - start;
+    start = monotonicTimeNanos();
+    allocations = decodeMessages(stream, length, 1024);
+    messages = monotonicTimeNanos() - start;
+    printf("batch       %.1f ns/sample, no allocations\n", (double)batches/frames);
+    printf("messages    %.1f ns/sample, %.2f allocations/sample\n",
+           (double)messages/frames, (double)allocations/frames);
+
+    // Capture reports with their CRC, and the longest frame the decoder holds.
+    benchmarkCRC(stream, length, 3 + CAPTURE_REPORT_LENGTH + HID_CRC_LENGTH);
+    benchmarkCRC(stream, length, HID_FRAME_MAX_LENGTH);
+
+    free(stream);
+    free(wholeLog.bytes);
+    free(splitLog.bytes);
+    return 0;
+}
@@ -0,0 +1,257 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Re-filters a collection of recorded sessions on every core and writes the
+// strokes of each one to an archive or a document, or only filters them to
+// time it.
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ink_refilter.h"
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bbrefilter [-j threads] [-p profile] [-o dir [-f format]] [-s] input...\n"
+                    "  input      a recording or an ink archive, or a directory of them\n"
+                    "  -j threads workers (default one per core)\n"
+                    "  -p profile filter with this profile (default sync)\n"
+                    "  -o dir     write the samples and strokes of each session to dir/name.bbia\n"
+                    "  -f format  write dir/name.bbia (archive, the default), or only the strokes\n"
+                    "             to dir/name.svg (svg) or dir/name.pdf (pdf)\n"
+                    "  -s         run with 1, 2, 4 and so on up to threads workers and report how\n"
+                    "             throughput scales\n");
+    exit(2);
+}
+
+typedef struct
+{
+    char  **paths;
+    size_t  count;
+    size_t  capacity;
+} pathList_t;
+
+static void addPath(pathList_t *list, const char *path)
+{
+    char **paths;
+
+    if (list->count == list->capacity)
+    {
+        list->capacity = list->capacity ? list->capacity*2 : 64;
+        paths = realloc(list->paths, list->capacity*sizeof(char *));
+        if (paths == NULL)
+        {
+            fprintf(stderr, "bbrefilter: out of memory\n");
+            exit(1);
+        }
+        list->paths = paths;
+    }
+    list->paths[list->count] = strdup(path);
+    if (list->paths[list->count] == NULL)
+    {
+        fprintf(stderr, "bbrefilter: out of memory\n");
+        exit(1);
+    }
+    list->count++;
+}
+
+static int comparePaths(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// Adds a file, or every regular file in a directory in name order.
+static void addInput(pathList_t *list, const char *path)
+{
+    struct dirent *entry;
+    struct stat st;
+    char file[4096];
+    size_t first = list->count;
+    DIR *dir;
+
+    if (stat(path, &st) != 0)
+    {
+        fprintf(stderr, "bbrefilter: cannot read %s\n", path);
+        exit(1);
+    }
+    if (!S_ISDIR(st.st_mode))
+    {
+        addPath(list, path);
+        return;
+    }
+
+    dir = opendir(path);
+    if (dir == NULL)
+    {
+        fprintf(stderr, "bbrefilter: cannot read %s\n", path);
+        exit(1);
+    }
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (entry->d_name[0] == '.')
+            continue;
+        snprintf(file, sizeof(file), "%s/%s", path, entry->d_name);
+        if (stat(file, &st) == 0 && S_ISREG(st.st_mode))
+            addPath(list, file);
+    }
+    closedir(dir);
+    qsort(list->paths + first, list->count - first, sizeof(char *), comparePaths);
+}
+
+typedef enum {OUTPUT_ARCHIVE, OUTPUT_SVG, OUTPUT_PDF} outputFormat_t;
+
+typedef struct
+{
+    const char     *dir;
+    outputFormat_t  format;
+} output_t;
+
+// Writes a session next to the others in the output directory, named after
+// its input without the extension.
+static int writeSession(void *context, const inkRefilterSession_t *session)
+{
+    static const char *const extensions[] = {"bbia", "svg", "pdf"};
+    const output_t *output = context;
+    const char *name, *dot;
+    char path[4096];
+    int result;
+
+    name = strrchr(session->path, '/');
+    name = name ? name + 1 : session->path;
+    dot = strrchr(name, '.');
+    snprintf(path, sizeof(path), "%s/%.*s.%s", output->dir, (int)(dot && dot != name ? dot - name : (int)strlen(name)), name,
+             extensions[output->format]);
+    if (output->format == OUTPUT_ARCHIVE)
+        result = inkRefilterWriteArchive(session, path);
+    else
+        result = inkRefilterWriteDocument(session, path, output->format == OUTPUT_SVG ? INK_EXPORT_SVG : INK_EXPORT_PDF);
+    if (result != 0)
+    {
+        fprintf(stderr, "bbrefilter: cannot write %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+static void freePaths(pathList_t *list)
+{
+    size_t i;
+
+    for (i = 0; i < list->count; i++)
+        free(list->paths[i]);
+    free(list->paths);
+}
+
+static void printResult(const inkRefilterResult_t *r)
+{
+    double seconds = r->elapsedNanos/1e9;
+
+    printf("sessions    %llu, %llu failed\n", (unsigned long long)r->sessions, (unsigned long long)r->failed);
+    printf("samples     %llu in %llu runs\n", (unsigned long long)r->samples, (unsigned long long)r->runs);
+    printf("strokes     %llu, %llu points\n", (unsigned long long)r->strokes, (unsigned long long)r->points);
+    printf("threads     %u, %llu tasks stolen\n", r->threads, (unsigned long long)r->steals);
+    printf("elapsed     %.3f s, %.0f samples/s\n", seconds, seconds > 0 ? r->samples/seconds : 0.0);
+}
+
+int main(int argc, char *argv[])
+{
+    inkRefilterOptions_t options = {NULL, 0, NULL, NULL};
+    inkRefilterResult_t result;
+    pathList_t inputs = {NULL, 0, 0};
+    output_t output = {NULL, OUTPUT_ARCHIVE};
+    double base = 0, rate;
+    unsigned threads;
+    int scaling = 0, opt;
+    long online;
+    size_t i;
+
+    while ((opt = getopt(argc, argv, "j:p:o:f:s")) != -1)
+    {
+        switch (opt)
+        {
+            case 'j': options.threads = (unsigned)atoi(optarg); if (options.threads < 1) usage(); break;
+            case 'p':
+                options.profile = inkFilterProfileNamed(optarg);
+                if (options.profile == NULL)
+                {
+                    fprintf(stderr, "bbrefilter: unknown profile %s, one of:", optarg);
+                    for (i = 0; i < inkFilterProfileCount; i++)
+                        fprintf(stderr, " %s", inkFilterProfiles[i].name);
+                    fprintf(stderr, "\n");
+                    return 2;
+                }
+                break;
+            case 'o': output.dir = optarg; options.sink = writeSession; options.context = &output; break;
+            case 'f':
+                if (strcmp(optarg, "archive") == 0)
+                    output.format = OUTPUT_ARCHIVE;
+                else if (strcmp(optarg, "svg") == 0)
+                    output.format = OUTPUT_SVG;
+                else if (strcmp(optarg, "pdf") == 0)
+                    output.format = OUTPUT_PDF;
+                else
+                    usage();
+                break;
+            case 's': scaling = 1; break;
+            default: usage();
+        }
+    }
+    if (optind == argc)
+        usage();
+    for (i = optind; i < (size_t)argc; i++)
+        addInput(&inputs, argv[i]);
+
+    if (!scaling)
+    {
+        if (inkRefilterRun((const char *const *)inputs.paths, inputs.count, &options, &result) != 0)
+        {
+            fprintf(stderr, "bbrefilter: out of memory\n");
+            return 1;
+        }
+        printResult(&result);
+        freePaths(&inputs);
+        return result.failed ? 1 : 0;
+    }
+
+    online = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = options.threads ? options.threads : (online > 0 ? (unsigned)online : 1);
+    printf("threads  samples/s     speedup  stolen\n");
+    for (options.threads = 1; ; options.threads = options.threads*2 < threads ? options.threads*2 : threads)
+    {
+        if (inkRefilterRun((const char *const *)inputs.paths, inputs.count, &options, &result) != 0)
+        {
+            fprintf(stderr, "bbrefilter: out of memory\n");
+            return 1;
+        }
+        rate = result.elapsedNanos ? result.samples/(result.elapsedNanos/1e9) : 0;
+        if (options.threads == 1)
+            base = rate;
+        printf("%7u  %12.0f  %6.2fx  %6llu\n", result.threads, rate, base > 0 ? rate/base : 0.0,
+               (unsigned long long)result.steals);
+        if (options.threads == threads)
+            break;
+    }
+    freePaths(&inputs);
+    return 0;
+}
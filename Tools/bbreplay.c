@@ -0,0 +1,1048 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Replays a raw HID capture recording through the SDK's decoding pipeline
+// and reports throughput, so pipeline performance can be tracked without a
+// Boogie Board Sync.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+
+#include "capture_replay.h"
+#include "capture_stats.h"
+#include "ink_archive.h"
+#include "ink_curve.h"
+#include "ink_export.h"
+#include "ink_filter.h"
+#include "ink_index.h"
+#include "ink_page_store.h"
+#include "ink_raster.h"
+#include "ink_stroke.h"
+#include "ink_tessellator.h"
+#include "ink_width_table.h"
+#include "monotonic_time.h"
+
+#include "filter_baseline.h"
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bbreplay [-s speed | -f] [-F | -S | -T tolerance | -Q | -R dpi | -C tolerance]\n"
+                    "                [-A archive] [-E document] [-P budget] [-L] [-B] [-p profile]\n"
+                    "                [-n passes]\n"
+                    "                recording\n"
+                    "  -s speed   replay at speed times the recorded pace (default 1)\n"
+                    "  -f         replay flat out\n"
+                    "  -F         also filter the samples into segments\n"
+                    "  -S         also filter the samples and assemble them into strokes\n"
+                    "  -T tolerance\n"
+                    "             also tessellate the strokes as they grow, tolerance in digitizer units\n"
+                    "  -Q         also index the strokes as they grow and time queries at 10k, 100k\n"
+                    "             and 1M segments\n"
+                    "  -R dpi     also draw the strokes as they grow into a tiled page at dpi and\n"
+                    "             take its dirty tiles after every batch\n"
+                    "  -C tolerance\n"
+                    "             also fit curves to the strokes as they finish, tolerance in digitizer\n"
+                    "             units, and measure their error and size\n"
+                    "  -A archive also write the samples and the strokes of the first pass to an\n"
+                    "             archive, then read it back\n"
+                    "  -E document\n"
+                    "             also write the ink of the first pass to an SVG document, or a PDF if\n"
+                    "             its name ends in .pdf, as it is filtered, and time finishing it\n"
+                    "  -P budget  also store every page as it is saved or erased, spilling pages to\n"
+                    "             disk past budget KiB, and report resident memory as the session goes\n"
+                    "  -L         also predict the ink ahead of every sample and measure how far the\n"
+                    "             predicted tips land from the filtered ones, at 1 to 12 samples ahead\n"
+                    "  -B         also filter the samples with the filter as it was before profiles,\n"
+                    "             its constants hard-coded, and compare its time and segments with\n"
+                    "             the profile's\n"
+                    "  -p profile filter with this profile (default sync)\n"
+                    "  -n passes  replay the recording this many times (default 1)\n");
+    exit(2);
+}
+
+// How far the page's segments have been handed on to a consumer.
+typedef struct
+{
+    size_t   stroke;                    // First stroke with segments left.
+    uint32_t points;                    // Points of it already handed on.
+} pageCursor_t;
+
+// Look-aheads at which predictions are measured, in samples.
+#define PREDICTION_LOOKAHEADS   6
+#define PREDICTION_HISTORY      16      // Power of two above the longest look-ahead.
+#define PREDICTION_BINS         4096    // Of one digitizer unit.
+
+static const int32_t predictionSamples[PREDICTION_LOOKAHEADS] = {1, 2, 4, 6, 8, 12};
+
+typedef struct
+{
+    float x;
+    float y;
+} tip_t;
+
+typedef struct
+{
+    inkFilter_t filter;                 // Runs sample by sample beside the batch filter.
+    uint64_t    traceSamples;           // Of the trace in progress.
+    tip_t       inked[PREDICTION_HISTORY];  // End of the real ink after each sample.
+    tip_t       predicted[PREDICTION_LOOKAHEADS][PREDICTION_HISTORY];
+    uint32_t    errors[PREDICTION_LOOKAHEADS][PREDICTION_BINS];
+    uint32_t    trailing[PREDICTION_LOOKAHEADS][PREDICTION_BINS];
+    uint64_t    predictions;
+    uint64_t    predictNanos;
+} predictionStats_t;
+
+typedef struct
+{
+    latencyHistogram_t decode;
+    int                filtering;
+    int                stroking;
+    int                tessellating;
+    float              tolerance;
+    inkFilter_t        filter;
+    inkPage_t          page;
+    inkMesh_t         *meshes;
+    size_t             meshCapacity;
+    size_t             meshed;          // Meshes of strokes that are finished.
+    uint64_t           vertexCount;     // Vertices written, tails included.
+    uint64_t           tessellateNanos;
+    inkSegment_t       segments[INK_FILTER_BATCH_SEGMENTS];
+    uint64_t           segmentCount;
+    uint64_t           filterNanos;
+    int                baseline;
+    inkFilter_t        baselineFilter;
+    inkSegment_t       baselineSegments[INK_FILTER_BATCH_SEGMENTS];
+    uint64_t           baselineNanos;
+    uint64_t           baselineBatches;
+    uint64_t           baselineDiffering;  // Batches whose segments differ from the profile's.
+    int                indexing;
+    inkIndex_t         index;
+    pageCursor_t       indexed;
+    uint64_t           indexNanos;
+    int                milestone;
+    float              dpi;
+    inkCanvas_t        canvas;
+    pageCursor_t       drawn;
+    uint64_t           drawNanos;
+    uint64_t           dirtyTiles;
+    uint64_t           batches;
+    float              curveTolerance;
+    inkCurves_t        curves;
+    inkStroke_t        flattened;
+    size_t             fitted;          // Strokes of the page already fitted.
+    uint64_t           fittedStrokes;
+    uint64_t           fittedPoints;
+    uint64_t           curveCount;
+    uint64_t           flattenedPoints; // Points of the curves flattened to tolerance.
+    uint64_t           fitNanos;
+    double             maxError;
+    double             sumError;
+    const char        *archivePath;
+    inkArchiveWriter_t archive;
+    size_t             archived;        // Strokes of the page already archived.
+    uint64_t           archiveNanos;
+    const char        *exportPath;
+    inkExportWriter_t  exporter;
+    pageCursor_t       exported;
+    uint64_t           exportNanos;
+    uint64_t           finishNanos;
+    int                paging;
+    inkPageStore_t     store;
+    uint64_t           samples;
+    int                predicting;
+    predictionStats_t  prediction;
+} replayContext_t;
+
+typedef int (*segmentsAdded_t)(replayContext_t *c, size_t stroke, uint32_t from, uint32_t to);
+
+static int batchErases(const captureBatch_t *batch)
+{
+    size_t i;
+
+    for (i = 0; i < batch->count; i++)
+    {
+        if (batch->flags[i] & CAPTURE_FLAG_ERASE)
+            return 1;
+    }
+    return 0;
+}
+
+// Hands the segments added to the page since the cursor on to a consumer.
+static void advanceCursor(replayContext_t *c, pageCursor_t *cursor, segmentsAdded_t added)
+{
+    const inkStroke_t *s;
+
+    for (; cursor->stroke < c->page.count; cursor->stroke++, cursor->points = 0)
+    {
+        s = &c->page.strokes[cursor->stroke];
+        if (added(c, cursor->stroke, cursor->points, s->count) != 0)
+        {
+            fprintf(stderr, "bbreplay: out of memory\n");
+            exit(1);
+        }
+        cursor->points = s->count;
+        if (c->page.open && cursor->stroke == c->page.count - 1)
+            break;
+    }
+}
+
+#define QUERY_MILESTONES    3
+#define QUERY_REPEATS       10000
+
+static const size_t queryMilestones[QUERY_MILESTONES] = {10000, 100000, 1000000};
+
+static void countSegment(void *context, const inkIndexEntry_t *entry)
+{
+    (void)entry;
+    (*(uint64_t *)context)++;
+}
+
+static void randomRect(inkRect_t *r, unsigned width, unsigned height)
+{
+    r->minX = rand() % (INK_DIGITIZER_MAX_X - width);
+    r->minY = rand() % (INK_DIGITIZER_MAX_Y - height);
+    r->maxX = r->minX + width;
+    r->maxY = r->minY + height;
+}
+
+static void printLatency(const char *name, const latencyHistogram_t *h)
+{
+    printf("  %-10s p50 %.3f us, p99 %.3f us, max %.3f us", name, latencyHistogramValueAtPercentile(h, 50)/1e3,
+           latencyHistogramValueAtPercentile(h, 99)/1e3, h->max/1e3);
+}
+
+// Times rect queries for a zoomed in view (a quarter of the board across) and
+// a partial redraw (512 units square), then hit tests with 20 units of slop.
+static void timeQueries(replayContext_t *c)
+{
+    static latencyHistogram_t view, redraw, hit;
+    uint64_t start, viewFound = 0, redrawFound = 0, hits = 0;
+    uint32_t stroke, point;
+    inkRect_t r;
+    int i;
+
+    latencyHistogramReset(&view);
+    latencyHistogramReset(&redraw);
+    latencyHistogramReset(&hit);
+    srand(1);
+    for (i = 0; i < QUERY_REPEATS; i++)
+    {
+        randomRect(&r, INK_DIGITIZER_MAX_X/4, INK_DIGITIZER_MAX_Y/4);
+        start = monotonicTimeNanos();
+        inkIndexQueryRect(&c->index, &r, countSegment, &viewFound);
+        latencyHistogramRecord(&view, monotonicTimeNanos() - start);
+
+        randomRect(&r, 512, 512);
+        start = monotonicTimeNanos();
+        inkIndexQueryRect(&c->index, &r, countSegment, &redrawFound);
+        latencyHistogramRecord(&redraw, monotonicTimeNanos() - start);
+
+        randomRect(&r, 0, 0);
+        start = monotonicTimeNanos();
+        hits += inkIndexHitTest(&c->index, r.minX, r.minY, 20, &stroke, &point);
+        latencyHistogramRecord(&hit, monotonicTimeNanos() - start);
+    }
+
+    printf("index       %zu segments, %zu bytes\n", c->index.segments, inkIndexMemory(&c->index));
+    printLatency("view", &view);
+    printf(", %.1f segments/query\n", (double)viewFound/QUERY_REPEATS);
+    printLatency("redraw", &redraw);
+    printf(", %.1f segments/query\n", (double)redrawFound/QUERY_REPEATS);
+    printLatency("hit test", &hit);
+    printf(", %.1f%% hit\n", 100.0*hits/QUERY_REPEATS);
+}
+
+static int indexSegments(replayContext_t *c, size_t stroke, uint32_t from, uint32_t to)
+{
+    const inkStroke_t *s = &c->page.strokes[stroke];
+
+    return inkIndexAddSegments(&c->index, (uint32_t)stroke, s->points, s->widths, from, to);
+}
+
+static void indexStrokes(replayContext_t *c, const captureBatch_t *batch)
+{
+    uint64_t start = monotonicTimeNanos();
+
+    // An erase empties the page, start over with its strokes.
+    if (batchErases(batch))
+    {
+        inkIndexClear(&c->index);
+        memset(&c->indexed, 0, sizeof(c->indexed));
+    }
+    advanceCursor(c, &c->indexed, indexSegments);
+    c->indexNanos += monotonicTimeNanos() - start;
+
+    while (c->milestone < QUERY_MILESTONES && c->index.segments >= queryMilestones[c->milestone])
+    {
+        timeQueries(c);
+        c->milestone++;
+    }
+}
+
+static int drawSegments(replayContext_t *c, size_t stroke, uint32_t from, uint32_t to)
+{
+    return inkCanvasDrawStroke(&c->canvas, &c->page.strokes[stroke], from, to);
+}
+
+// Draws the new ink and copies out the tiles it dirtied, as a view would.
+static void drawStrokes(replayContext_t *c, const captureBatch_t *batch)
+{
+    static uint8_t copy[INK_RASTER_TILE_SIZE*INK_RASTER_TILE_SIZE];
+    uint64_t start = monotonicTimeNanos();
+    const uint8_t *pixels;
+    uint32_t tile;
+
+    if (batchErases(batch))
+    {
+        inkCanvasClear(&c->canvas);
+        memset(&c->drawn, 0, sizeof(c->drawn));
+    }
+    advanceCursor(c, &c->drawn, drawSegments);
+
+    while (inkCanvasTakeDirty(&c->canvas, &tile, 1) == 1)
+    {
+        pixels = inkCanvasTile(&c->canvas, tile % c->canvas.columns, tile / c->canvas.columns);
+        memcpy(copy, pixels, sizeof(copy));
+        c->dirtyTiles++;
+    }
+    c->batches++;
+    c->drawNanos += monotonicTimeNanos() - start;
+}
+
+static void exportFailed(const replayContext_t *c)
+{
+    fprintf(stderr, "bbreplay: cannot write document %s\n", c->exportPath);
+    exit(1);
+}
+
+static int exportSegments(replayContext_t *c, size_t stroke, uint32_t from, uint32_t to)
+{
+    if (inkExportWriteStroke(&c->exporter, &c->page.strokes[stroke], from, to) != 0)
+        exportFailed(c);
+    return 0;
+}
+
+// Appends the new ink to the document, which an erase starts over.
+static void exportStrokes(replayContext_t *c, const captureBatch_t *batch)
+{
+    uint64_t start = monotonicTimeNanos();
+
+    if (batchErases(batch))
+    {
+        if (inkExportClear(&c->exporter) != 0)
+            exportFailed(c);
+        memset(&c->exported, 0, sizeof(c->exported));
+    }
+    advanceCursor(c, &c->exported, exportSegments);
+    c->exportNanos += monotonicTimeNanos() - start;
+}
+
+static inkExportFormat_t exportFormat(const char *path)
+{
+    size_t length = strlen(path);
+
+    return length > 4 && strcasecmp(path + length - 4, ".pdf") == 0 ? INK_EXPORT_PDF : INK_EXPORT_SVG;
+}
+
+// Writes the whole page to a new document, which is what saving would cost
+// without writing the ink as it comes.
+static void rebuildDocument(replayContext_t *c)
+{
+    uint64_t start = monotonicTimeNanos();
+    inkExportWriter_t w;
+    char path[64];
+    size_t i;
+
+    snprintf(path, sizeof(path), "/tmp/bbreplay-%d.document", (int)getpid());
+    if (inkExportWriterOpen(&w, path, exportFormat(c->exportPath)) != 0)
+        return;
+    for (i = 0; i < c->page.count; i++)
+        inkExportWriteStroke(&w, &c->page.strokes[i], 0, c->page.strokes[i].count);
+    inkExportWriterClose(&w);
+    printf("rebuild     %.3f ms for the whole page\n", (monotonicTimeNanos() - start)/1e6);
+    unlink(path);
+}
+
+static void resetMeshes(replayContext_t *c)
+{
+    size_t i;
+
+    for (i = 0; i < c->meshCapacity; i++)
+        inkMeshReset(&c->meshes[i]);
+    c->meshed = 0;
+}
+
+static void tessellate(replayContext_t *c, const captureBatch_t *batch)
+{
+    inkMesh_t *meshes;
+    uint64_t start = monotonicTimeNanos();
+    size_t i;
+
+    // An erase empties the page, start over with its strokes.
+    if (batchErases(batch))
+        resetMeshes(c);
+
+    if (c->page.count > c->meshCapacity)
+    {
+        meshes = realloc(c->meshes, c->page.count*2*sizeof(inkMesh_t));
+        if (meshes == NULL)
+        {
+            fprintf(stderr, "bbreplay: out of memory\n");
+            exit(1);
+        }
+        for (i = c->meshCapacity; i < c->page.count*2; i++)
+            inkMeshInit(&meshes[i], c->tolerance);
+        c->meshes = meshes;
+        c->meshCapacity = c->page.count*2;
+    }
+
+    for (i = c->meshed; i < c->page.count; i++)
+    {
+        if (inkMeshUpdate(&c->meshes[i], &c->page.strokes[i]) != 0)
+        {
+            fprintf(stderr, "bbreplay: out of memory\n");
+            exit(1);
+        }
+        c->vertexCount += c->meshes[i].count - c->meshes[i].firstChanged;
+    }
+    c->meshed = c->page.open ? c->page.count - 1 : c->page.count;
+    c->tessellateNanos += monotonicTimeNanos() - start;
+}
+
+// Distance from each point of the stroke to the polyline drawn for it, the
+// curves flattened.
+static void measureCurves(replayContext_t *c, const inkStroke_t *s)
+{
+    const inkStroke_t *f = &c->flattened;
+    float distance, nearest;
+    uint32_t i, j;
+
+    for (i = 0; i < s->count; i++)
+    {
+        nearest = hypotf((float)s->points[i].x - f->points[0].x, (float)s->points[i].y - f->points[0].y);
+        for (j = 1; j < f->count; j++)
+        {
+            distance = inkSegmentDistance(f->points[j - 1].x, f->points[j - 1].y, f->points[j].x, f->points[j].y,
+                                          s->points[i].x, s->points[i].y);
+            if (distance < nearest)
+                nearest = distance;
+        }
+        if (nearest > c->maxError)
+            c->maxError = nearest;
+        c->sumError += nearest;
+    }
+}
+
+static void fitCurves(replayContext_t *c, const captureBatch_t *batch)
+{
+    const inkStroke_t *s;
+    uint64_t start;
+    size_t last = c->page.open ? c->page.count - 1 : c->page.count;
+
+    if (batchErases(batch))
+        c->fitted = 0;
+
+    for (; c->fitted < last; c->fitted++)
+    {
+        s = &c->page.strokes[c->fitted];
+        start = monotonicTimeNanos();
+        if (inkCurvesFit(&c->curves, s, c->curveTolerance*INK_CURVE_FIT_SHARE) != 0 ||
+            inkCurvesFlatten(&c->curves, c->curveTolerance*(1.0f - INK_CURVE_FIT_SHARE), &c->flattened) != 0)
+        {
+            fprintf(stderr, "bbreplay: out of memory\n");
+            exit(1);
+        }
+        c->fitNanos += monotonicTimeNanos() - start;
+        c->fittedStrokes++;
+        c->fittedPoints += s->count;
+        c->curveCount += c->curves.count;
+        c->flattenedPoints += c->flattened.count;
+        measureCurves(c, s);
+    }
+}
+
+static void archive(replayContext_t *c, const captureBatch_t *batch)
+{
+    uint64_t start = monotonicTimeNanos();
+    size_t last = c->page.open ? c->page.count - 1 : c->page.count;
+
+    if (batchErases(batch))
+        c->archived = 0;
+
+    if (inkArchiveWriteSamples(&c->archive, batch) != 0)
+        goto failed;
+    for (; c->archived < last; c->archived++)
+    {
+        if (inkArchiveWriteStroke(&c->archive, &c->page.strokes[c->archived]) != 0)
+            goto failed;
+    }
+    c->archiveNanos += monotonicTimeNanos() - start;
+    return;
+
+failed:
+    fprintf(stderr, "bbreplay: cannot write archive %s\n", c->archivePath);
+    exit(1);
+}
+
+// Reads the archive back, the stroke headers alone, then the strokes and
+// then the samples.
+static void readArchive(replayContext_t *c)
+{
+    inkArchive_t a;
+    inkArchiveCursor_t cursor;
+    inkArchiveStroke_t stroke;
+    inkStroke_t s;
+    captureBatch_t batch;
+    uint64_t start, headerNanos, strokeNanos, points = 0;
+
+    if (inkArchiveOpen(&a, c->archivePath) != 0)
+    {
+        fprintf(stderr, "bbreplay: cannot read archive %s\n", c->archivePath);
+        exit(1);
+    }
+    inkStrokeInit(&s);
+
+    start = monotonicTimeNanos();
+    inkArchiveCursorInit(&cursor, &a);
+    while (inkArchiveNextStroke(&cursor, NULL, &stroke))
+        ;
+    headerNanos = monotonicTimeNanos() - start;
+
+    start = monotonicTimeNanos();
+    inkArchiveCursorInit(&cursor, &a);
+    while (inkArchiveNextStroke(&cursor, NULL, &stroke))
+    {
+        if (inkArchiveDecodeStroke(&stroke, &s) != 0)
+        {
+            fprintf(stderr, "bbreplay: corrupt stroke in archive %s\n", c->archivePath);
+            exit(1);
+        }
+        points += s.count;
+    }
+    strokeNanos = monotonicTimeNanos() - start;
+
+    start = monotonicTimeNanos();
+    inkArchiveCursorInit(&cursor, &a);
+    while (inkArchiveNextSamples(&cursor, &batch))
+        ;
+
+    printf("archive     %zu bytes, %zu chunks, %llu samples, %llu strokes, %.2f bytes/sample\n", a.length,
+           a.chunkCount, (unsigned long long)a.samples, (unsigned long long)a.strokes,
+           a.samples ? (double)a.length/a.samples : 0.0);
+    printf("write       %.1f ns/sample for samples and strokes\n",
+           a.samples ? (double)c->archiveNanos/a.samples : 0.0);
+    printf("read        %.1f us for all stroke headers, %.1f ns/point for strokes, %.1f ns/sample for samples\n",
+           headerNanos/1e3, points ? (double)strokeNanos/points : 0.0,
+           a.samples ? (double)(monotonicTimeNanos() - start)/a.samples : 0.0);
+    inkStrokeFree(&s);
+    inkArchiveClose(&a);
+}
+
+#define MEMORY_REPORT_SAMPLES   200000
+
+// Memory of the page store and the page on screen, against keeping every page
+// as strokes.
+static void reportMemory(replayContext_t *c)
+{
+    size_t page = inkPageMemory(&c->page), store = inkPageStoreMemory(&c->store), i;
+    uint64_t points = 0;
+
+    for (i = 0; i < c->store.count; i++)
+        points += c->store.pages[i].points;
+    printf("memory      %8llu samples, %4zu pages, %9zu bytes resident (store %zu, page %zu), %zu spilled,"
+           " %.0f bytes as strokes\n", (unsigned long long)c->samples, c->store.count, page + store, store, page,
+           c->store.spilled, page + points*(double)(sizeof(inkPoint_t) + sizeof(float)));
+}
+
+// Loads the first and the last page back, which come from the spill file and
+// from memory when the budget is small.
+static void loadPages(replayContext_t *c)
+{
+    inkPage_t page;
+    uint64_t start;
+    size_t ends[2], i;
+
+    reportMemory(c);
+    if (c->store.count == 0)
+    {
+        inkPageStoreFree(&c->store);
+        return;
+    }
+
+    inkPageInit(&page);
+    ends[0] = 0;
+    ends[1] = c->store.count - 1;
+    for (i = 0; i < 2; i++)
+    {
+        start = monotonicTimeNanos();
+        if (inkPageStoreLoad(&c->store, ends[i], &page) != 0)
+        {
+            fprintf(stderr, "bbreplay: cannot load page %zu\n", ends[i]);
+            exit(1);
+        }
+        printf("load page   %zu (%s) of %zu strokes in %.3f ms\n", ends[i],
+               c->store.pages[ends[i]].bytes ? "in memory" : "spilled", page.count,
+               (monotonicTimeNanos() - start)/1e6);
+    }
+    inkPageFree(&page);
+    inkPageStoreFree(&c->store);
+}
+
+static void countDistance(uint32_t bins[PREDICTION_BINS], tip_t a, tip_t b)
+{
+    float d = sqrtf((a.x - b.x)*(a.x - b.x) + (a.y - b.y)*(a.y - b.y));
+
+    bins[d < PREDICTION_BINS - 1 ? (int)d : PREDICTION_BINS - 1]++;
+}
+
+// Predicts the ink after every sample of a trace and, once the trace has gone
+// on that far, compares the predicted tip with where the filter actually got
+// to, and with the end of the real ink when the prediction was made.
+static void predict(replayContext_t *c, const captureBatch_t *batch)
+{
+    predictionStats_t *p = &c->prediction;
+    float ms = p->filter.profile->constants.msPerSample;
+    inkSegment_t segments[INK_FILTER_PREDICTED_SEGMENTS];
+    const inkDynamics_t *d = &p->filter.currFilter;
+    uint64_t start;
+    size_t i, n, h;
+    tip_t cur;
+    int k;
+
+    for (i = 0; i < batch->count; i++)
+    {
+        inkFilterApply(&p->filter, batch->x[i], batch->y[i], batch->pressure[i], batch->flags[i], segments);
+        if (!inkFilterIsContact(batch->flags[i]))
+        {
+            p->traceSamples = 0;
+            continue;
+        }
+
+        cur.x = d->cur.x;
+        cur.y = d->cur.y;
+        for (k = 0; k < PREDICTION_LOOKAHEADS; k++)
+        {
+            if (p->traceSamples < (uint64_t)predictionSamples[k])
+                continue;
+            h = (p->traceSamples - predictionSamples[k]) % PREDICTION_HISTORY;
+            countDistance(p->errors[k], p->predicted[k][h], cur);
+            countDistance(p->trailing[k], p->inked[h], cur);
+        }
+
+        h = p->traceSamples++ % PREDICTION_HISTORY;
+        p->inked[h].x = d->last.x;
+        p->inked[h].y = d->last.y;
+        for (k = 0; k < PREDICTION_LOOKAHEADS; k++)
+        {
+            start = monotonicTimeNanos();
+            n = inkFilterPredict(&p->filter, predictionSamples[k]*ms, segments);
+            p->predictNanos += monotonicTimeNanos() - start;
+            p->predictions++;
+            if (n > 0)
+            {
+                p->predicted[k][h].x = segments[n - 1].x2;
+                p->predicted[k][h].y = segments[n - 1].y2;
+            }
+            else
+            {
+                p->predicted[k][h] = p->inked[h];
+            }
+        }
+    }
+}
+
+// Distance below which a fraction of the counts fall, in mm.
+static double binPercentile(const uint32_t bins[PREDICTION_BINS], double fraction)
+{
+    uint64_t total = 0, seen = 0;
+    int i;
+
+    for (i = 0; i < PREDICTION_BINS; i++)
+        total += bins[i];
+    for (i = 0; i < PREDICTION_BINS; i++)
+    {
+        seen += bins[i];
+        if (seen >= total*fraction)
+            break;
+    }
+    return (i + 1)/(double)TICKS_PER_MM;
+}
+
+static void reportPrediction(const replayContext_t *c)
+{
+    const predictionStats_t *p = &c->prediction;
+    float ms = p->filter.profile->constants.msPerSample;
+    int k;
+
+    printf("predict     %.1f ns per prediction\n", p->predictions ? (double)p->predictNanos/p->predictions : 0.0);
+    printf("            look-ahead  predicted tip off p50/p95     ink tip behind p50/p95\n");
+    for (k = 0; k < PREDICTION_LOOKAHEADS; k++)
+    {
+        printf("            %5.1f ms    %5.2f mm / %5.2f mm        %5.2f mm / %5.2f mm\n", predictionSamples[k]*ms,
+               binPercentile(p->errors[k], 0.5), binPercentile(p->errors[k], 0.95),
+               binPercentile(p->trailing[k], 0.5), binPercentile(p->trailing[k], 0.95));
+    }
+}
+
+// Filters the batch with the profile and with the filter as it was before
+// profiles, taking turns at going first, and compares their segments.
+static void filterWithBaseline(replayContext_t *c, const captureBatch_t *batch)
+{
+    uint64_t start, profileNanos, baselineNanos;
+    size_t n, baseline;
+
+    if (c->baselineBatches++ & 1)
+    {
+        start = monotonicTimeNanos();
+        baseline = baselineFilterApplyBatch(&c->baselineFilter, batch, c->baselineSegments, NULL);
+        baselineNanos = monotonicTimeNanos() - start;
+        start = monotonicTimeNanos();
+        n = inkFilterApplyBatch(&c->filter, batch, c->segments, NULL);
+        profileNanos = monotonicTimeNanos() - start;
+    }
+    else
+    {
+        start = monotonicTimeNanos();
+        n = inkFilterApplyBatch(&c->filter, batch, c->segments, NULL);
+        profileNanos = monotonicTimeNanos() - start;
+        start = monotonicTimeNanos();
+        baseline = baselineFilterApplyBatch(&c->baselineFilter, batch, c->baselineSegments, NULL);
+        baselineNanos = monotonicTimeNanos() - start;
+    }
+    c->segmentCount += n;
+    c->filterNanos += profileNanos;
+    c->baselineNanos += baselineNanos;
+    if (n != baseline || memcmp(c->segments, c->baselineSegments, n*sizeof(inkSegment_t)) != 0)
+        c->baselineDiffering++;
+}
+
+static void batchDecoded(void *context, const captureBatch_t *batch)
+{
+    replayContext_t *c = context;
+    uint64_t start;
+    size_t i;
+
+    for (i = 0; i < batch->count; i++)
+        latencyHistogramRecord(&c->decode, batch->decoded - batch->timestamp[i]);
+
+    if (c->stroking)
+    {
+        start = monotonicTimeNanos();
+        if ((c->paging ? inkPageStoreAppendBatch(&c->store, &c->page, &c->filter, batch) :
+                         inkPageAppendBatch(&c->page, &c->filter, batch)) != 0)
+        {
+            fprintf(stderr, "bbreplay: out of memory\n");
+            exit(1);
+        }
+        c->filterNanos += monotonicTimeNanos() - start;
+    }
+    if (c->paging && (c->samples + batch->count)/MEMORY_REPORT_SAMPLES != c->samples/MEMORY_REPORT_SAMPLES)
+        reportMemory(c);
+    c->samples += batch->count;
+    if (c->indexing)
+        indexStrokes(c, batch);
+    if (c->dpi > 0)
+        drawStrokes(c, batch);
+    if (c->archive.file)
+        archive(c, batch);
+    if (c->exporter.file)
+        exportStrokes(c, batch);
+    if (c->curveTolerance > 0)
+        fitCurves(c, batch);
+    if (c->predicting)
+        predict(c, batch);
+    if (c->tessellating)
+        tessellate(c, batch);
+    else if (c->baseline)
+        filterWithBaseline(c, batch);
+    else if (c->filtering)
+    {
+        start = monotonicTimeNanos();
+        c->segmentCount += inkFilterApplyBatch(&c->filter, batch, c->segments, NULL);
+        c->filterNanos += monotonicTimeNanos() - start;
+    }
+}
+
+// Draws the whole page again from its strokes, which is what every update
+// would cost without dirty tiles.
+static void redrawPage(replayContext_t *c)
+{
+    uint64_t start = monotonicTimeNanos();
+    inkCanvas_t canvas;
+    size_t i;
+
+    if (inkCanvasInit(&canvas, c->dpi) != 0)
+        return;
+    for (i = 0; i < c->page.count; i++)
+        inkCanvasDrawStroke(&canvas, &c->page.strokes[i], 0, c->page.strokes[i].count);
+    printf("redraw      %.3f ms for the whole page\n", (monotonicTimeNanos() - start)/1e6);
+    inkCanvasFree(&canvas);
+}
+
+int main(int argc, char *argv[])
+{
+    static replayContext_t context;
+    captureRecording_t rec;
+    captureReplayResult_t result, total = {0};
+    uint64_t points = 0, segments = 0;
+    double speed = 1.0, seconds;
+    char spillPath[64];
+    size_t budget = 0;
+    const inkFilterProfile_t *profile = &inkFilterProfiles[0];
+    int passes = 1, opt, i;
+
+    while ((opt = getopt(argc, argv, "s:fFST:QR:C:A:E:P:LBp:n:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's': speed = atof(optarg); if (speed <= 0) usage(); break;
+            case 'f': speed = CAPTURE_REPLAY_FLAT_OUT; break;
+            case 'F': context.filtering = 1; break;
+            case 'S': context.stroking = 1; break;
+            case 'T':
+                context.stroking = context.tessellating = 1;
+                context.tolerance = atof(optarg);
+                if (context.tolerance <= 0) usage();
+                break;
+            case 'Q': context.stroking = context.indexing = 1; break;
+            case 'R':
+                context.stroking = 1;
+                context.dpi = atof(optarg);
+                if (context.dpi <= 0) usage();
+                break;
+            case 'C':
+                context.stroking = 1;
+                context.curveTolerance = atof(optarg);
+                if (context.curveTolerance <= 0) usage();
+                break;
+            case 'A': context.stroking = 1; context.archivePath = optarg; break;
+            case 'E': context.stroking = 1; context.exportPath = optarg; break;
+            case 'P':
+                context.stroking = context.paging = 1;
+                budget = strtoul(optarg, NULL, 10)*1024;
+                break;
+            case 'L': context.predicting = 1; break;
+            case 'B': context.filtering = context.baseline = 1; break;
+            case 'p':
+                profile = inkFilterProfileNamed(optarg);
+                if (profile == NULL)
+                {
+                    fprintf(stderr, "bbreplay: unknown profile %s, one of:", optarg);
+                    for (i = 0; i < (int)inkFilterProfileCount; i++)
+                        fprintf(stderr, " %s", inkFilterProfiles[i].name);
+                    fprintf(stderr, "\n");
+                    return 2;
+                }
+                break;
+            case 'n': passes = atoi(optarg); if (passes < 1) usage(); break;
+            default: usage();
+        }
+    }
+    if (optind != argc - 1)
+        usage();
+
+    if (captureRecordingOpen(&rec, argv[optind]) != 0)
+    {
+        fprintf(stderr, "bbreplay: cannot read recording %s\n", argv[optind]);
+        return 1;
+    }
+
+    latencyHistogramReset(&context.decode);
+    inkPageInit(&context.page);
+    inkIndexInit(&context.index);
+    inkCurvesInit(&context.curves);
+    inkStrokeInit(&context.flattened);
+    snprintf(spillPath, sizeof(spillPath), "/tmp/bbreplay-%d.pages", (int)getpid());
+    if (context.paging && inkPageStoreInit(&context.store, spillPath, budget) != 0)
+    {
+        fprintf(stderr, "bbreplay: out of memory\n");
+        return 1;
+    }
+    if (context.archivePath && inkArchiveWriterOpen(&context.archive, context.archivePath) != 0)
+    {
+        fprintf(stderr, "bbreplay: cannot create archive %s\n", context.archivePath);
+        return 1;
+    }
+    if (context.exportPath && inkExportWriterOpen(&context.exporter, context.exportPath,
+                                                  exportFormat(context.exportPath)) != 0)
+    {
+        fprintf(stderr, "bbreplay: cannot create document %s\n", context.exportPath);
+        return 1;
+    }
+    if (context.dpi > 0 && inkCanvasInit(&context.canvas, context.dpi) != 0)
+    {
+        fprintf(stderr, "bbreplay: out of memory\n");
+        return 1;
+    }
+    for (i = 0; i < passes; i++)
+    {
+        inkFilterResetWithProfile(&context.filter, profile);
+        inkFilterResetWithProfile(&context.prediction.filter, profile);
+        baselineFilterReset(&context.baselineFilter);
+        context.prediction.traceSamples = 0;
+        inkPageClear(&context.page);
+        resetMeshes(&context);
+        inkIndexClear(&context.index);
+        memset(&context.indexed, 0, sizeof(context.indexed));
+        if (context.dpi > 0)
+        {
+            inkCanvasClear(&context.canvas);
+            memset(&context.drawn, 0, sizeof(context.drawn));
+        }
+        context.fitted = 0;
+        if (captureReplayRun(&rec, speed, batchDecoded, &context, &result) != 0)
+        {
+            fprintf(stderr, "bbreplay: out of memory\n");
+            return 1;
+        }
+        total.chunks += result.chunks;
+        total.bytes += result.bytes;
+        total.samples += result.samples;
+        total.crcErrors += result.crcErrors;
+        total.elapsedNanos += result.elapsedNanos;
+        if (context.archive.file && inkArchiveWriterClose(&context.archive) != 0)
+        {
+            fprintf(stderr, "bbreplay: cannot write archive %s\n", context.archivePath);
+            return 1;
+        }
+        if (context.exporter.file)
+        {
+            uint64_t start = monotonicTimeNanos();
+
+            if (inkExportWriterClose(&context.exporter) != 0)
+                exportFailed(&context);
+            context.finishNanos = monotonicTimeNanos() - start;
+        }
+    }
+    captureRecordingClose(&rec);
+
+    seconds = total.elapsedNanos/1e9;
+    printf("chunks      %llu\n", (unsigned long long)total.chunks);
+    printf("bytes       %llu\n", (unsigned long long)total.bytes);
+    printf("samples     %llu\n", (unsigned long long)total.samples);
+    printf("crc errors  %llu\n", (unsigned long long)total.crcErrors);
+    printf("elapsed     %.6f s\n", seconds);
+    if (seconds > 0)
+    {
+        printf("throughput  %.0f samples/s, %.2f MB/s\n", total.samples/seconds, total.bytes/seconds/1e6);
+    }
+    printf("decode      p50 %.3f us, p99 %.3f us, max %.3f us\n",
+           latencyHistogramValueAtPercentile(&context.decode, 50)/1e3,
+           latencyHistogramValueAtPercentile(&context.decode, 99)/1e3, context.decode.max/1e3);
+    if (context.filtering && context.filterNanos > 0)
+    {
+        printf("filter      %s, %llu segments, %.0f segments/s, %.1f ns/sample\n", profile->name,
+               (unsigned long long)context.segmentCount, context.segmentCount/(context.filterNanos/1e9),
+               (double)context.filterNanos/total.samples);
+    }
+    if (context.baseline && context.baselineNanos > 0)
+    {
+        printf("baseline    hard-coded filter %.1f ns/sample against %.1f for %s, %llu of %llu batches differ\n",
+               (double)context.baselineNanos/total.samples, (double)context.filterNanos/total.samples,
+               profile->name, (unsigned long long)context.baselineDiffering,
+               (unsigned long long)context.baselineBatches);
+    }
+    if (context.stroking)
+    {
+        for (i = 0; i < (int)context.page.count; i++)
+        {
+            points += context.page.strokes[i].count;
+            segments += context.page.strokes[i].count - 1;
+        }
+        printf("strokes     %zu strokes, %llu points from %llu segments, %.1f ns/sample\n", context.page.count,
+               (unsigned long long)points, (unsigned long long)segments, (double)context.filterNanos/total.samples);
+        printf("page        %zu bytes, %.1f bytes/segment\n", inkPageMemory(&context.page),
+               segments ? (double)inkPageMemory(&context.page)/segments : 0.0);
+    }
+    if (context.tessellating)
+    {
+        uint64_t vertices = 0, meshBytes = 0;
+
+        for (i = 0; i < (int)context.page.count; i++)
+        {
+            vertices += context.meshes[i].count;
+            meshBytes += context.meshes[i].count*sizeof(inkVertex_t);
+        }
+        printf("tessellate  %llu vertices written, %.0f vertices/s, %.1f ns/sample\n",
+               (unsigned long long)context.vertexCount, context.vertexCount/(context.tessellateNanos/1e9),
+               (double)context.tessellateNanos/total.samples);
+        printf("mesh        %llu vertices, %.1f vertices/stroke, %.1f bytes/stroke, %.1f bytes/segment\n",
+               (unsigned long long)vertices, context.page.count ? (double)vertices/context.page.count : 0.0,
+               context.page.count ? (double)meshBytes/context.page.count : 0.0,
+               segments ? (double)meshBytes/segments : 0.0);
+        for (i = 0; i < (int)context.meshCapacity; i++)
+            inkMeshFree(&context.meshes[i]);
+        free(context.meshes);
+    }
+    if (context.indexing)
+    {
+        printf("index       %zu segments, %.1f ns/segment to add, %.1f bytes/segment\n", context.index.segments,
+               context.index.segments ? (double)context.indexNanos/context.index.segments : 0.0,
+               context.index.segments ? (double)inkIndexMemory(&context.index)/context.index.segments : 0.0);
+        inkIndexFree(&context.index);
+    }
+    if (context.dpi > 0)
+    {
+        printf("raster      %ux%u pixels, %ux%u tiles, %zu bytes\n", context.canvas.width, context.canvas.height,
+               context.canvas.columns, context.canvas.rows, inkCanvasMemory(&context.canvas));
+        printf("draw        %.1f ns/sample, %.0f segments/s, %.2f dirty tiles/batch\n",
+               (double)context.drawNanos/total.samples, segments/(context.drawNanos/1e9/passes),
+               context.batches ? (double)context.dirtyTiles/context.batches : 0.0);
+        redrawPage(&context);
+        inkCanvasFree(&context.canvas);
+    }
+    if (context.curveTolerance > 0 && context.fittedStrokes > 0)
+    {
+        double pointBytes = context.fittedPoints*(double)(sizeof(inkPoint_t) + sizeof(float));
+        double curveBytes = (3*context.curveCount + context.fittedStrokes)*(double)sizeof(inkCurvePoint_t);
+
+        printf("curves      %llu curves, %.1f curves/stroke, %.1f points/curve, %.1f us/stroke to fit\n",
+               (unsigned long long)context.curveCount, (double)context.curveCount/context.fittedStrokes,
+               (double)context.fittedPoints/context.curveCount, context.fitNanos/1e3/context.fittedStrokes);
+        printf("curve error max %.2f, mean %.2f digitizer units\n", context.maxError,
+               context.sumError/context.fittedPoints);
+        printf("curve size  %.1f bytes/stroke against %.1f, %.1fx smaller, %.1fx fewer segments to draw\n",
+               curveBytes/context.fittedStrokes, pointBytes/context.fittedStrokes, pointBytes/curveBytes,
+               (double)(context.fittedPoints - context.fittedStrokes)/(context.flattenedPoints - context.fittedStrokes));
+        inkCurvesFree(&context.curves);
+        inkStrokeFree(&context.flattened);
+    }
+    if (context.exportPath)
+    {
+        printf("document    %llu segments, %llu bytes, %.1f ns/segment, finished in %.1f us\n",
+               (unsigned long long)context.exporter.segments, (unsigned long long)context.exporter.offset,
+               context.exporter.segments ? (double)context.exportNanos/context.exporter.segments : 0.0,
+               context.finishNanos/1e3);
+        rebuildDocument(&context);
+    }
+    if (context.predicting)
+        reportPrediction(&context);
+    if (context.archivePath)
+        readArchive(&context);
+    if (context.paging)
+        loadPages(&context);
+    if (context.stroking)
+        inkPageFree(&context.page);
+    return 0;
+}
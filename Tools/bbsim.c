@@ -0,0 +1,408 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Simulates a Boogie Board Sync: the HID capture session and the OBEX File
+// Transfer server, each on its own pty or socket, with configurable sample
+// rate, packet size, latency, loss and corruption.
+
+#define _GNU_SOURCE // posix_openpt, cfmakeraw
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "capture_channel.h"
+#include "capture_stats.h"
+#include "fd_reader.h"
+#include "hid_slip.h"
+#include "monotonic_time.h"
+#include "obex_packet.h"
+#include "sim_hid.h"
+#include "sim_obex.h"
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bbsim [options]\n"
+                    "  -r rate     capture reports per second (default 144, 0 as fast as possible)\n"
+                    "  -n samples  stop streaming after this many samples\n"
+                    "  -p bytes    largest single write (default unlimited)\n"
+                    "  -l ms       latency added to everything sent\n"
+                    "  -d rate     probability of dropping a message\n"
+                    "  -c rate     probability of corrupting a message\n"
+                    "  -f dir      serve this directory over FTP (default generated files)\n"
+                    "  -s bytes    size of generated files (default 65536)\n"
+                    "  -m          start in capture mode\n"
+                    "  -b seconds  run an in-process client over socketpairs and report\n");
+    exit(2);
+}
+
+// Opens a pty in raw mode and returns the master, printing the device name.
+static int openPty(const char *label)
+{
+    struct termios tio;
+    int master, slave;
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+        return -1;
+
+    // Keep a slave open so the master does not see hangups between clients.
+    slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if (slave < 0 || tcgetattr(slave, &tio) != 0)
+        return -1;
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+
+    printf("%s: %s\n", label, ptsname(master));
+    return master;
+}
+
+// Capture client side of the benchmark.
+static pthread_mutex_t drainLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t drainCond = PTHREAD_COND_INITIALIZER;
+static int drainPending;
+
+static void batchesReady(void *context)
+{
+    (void)context;
+    pthread_mutex_lock(&drainLock);
+    drainPending = 1;
+    pthread_cond_signal(&drainCond);
+    pthread_mutex_unlock(&drainLock);
+}
+
+static void setReport(int fd, uint8_t reportId, uint8_t value)
+{
+    uint8_t frame[6] = {0x00, 0x53, reportId, reportId, 0x00, value};
+    uint8_t encoded[HID_SLIP_FRAME_MAX(sizeof(frame))];
+    (void)write(fd, encoded, hidSlipEncodeFrame(frame, sizeof(frame), encoded));
+}
+
+static void benchmarkCapture(const simHidConfig_t *config, double seconds)
+{
+    static latencyHistogram_t decode;
+    captureChannel_t channel;
+    captureBatch_t batch;
+    fdReader_t reader;
+    simHid_t sim;
+    uint64_t samples = 0, start, end;
+    struct timespec deadline;
+    int sv[2];
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0 ||
+        captureChannelInit(&channel, 32, batchesReady, NULL) != 0 ||
+        simHidStart(&sim, sv[0], config) != 0 || fdReaderStart(&reader, sv[1], &channel) != 0)
+    {
+        fprintf(stderr, "bbsim: cannot start capture benchmark\n");
+        exit(1);
+    }
+
+    latencyHistogramReset(&decode);
+    setReport(sv[1], 0x05, SIM_MODE_CAPTURE);
+    start = monotonicTimeNanos();
+    end = start + (uint64_t)(seconds*1e9);
+
+    while (monotonicTimeNanos() < end)
+    {
+        pthread_mutex_lock(&drainLock);
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += 10000000;
+        if (deadline.tv_nsec >= 1000000000)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+        while (!drainPending && pthread_cond_timedwait(&drainCond, &drainLock, &deadline) == 0)
+            ;
+        drainPending = 0;
+        pthread_mutex_unlock(&drainLock);
+
+        captureChannelBeginDrain(&channel);
+        while (captureChannelConsume(&channel, &batch))
+        {
+            for (size_t i = 0; i < batch.count; i++)
+                latencyHistogramRecord(&decode, batch.decoded - batch.timestamp[i]);
+            samples += batch.count;
+        }
+        if (captureChannelEndDrain(&channel))
+            fdReaderWake(&reader);
+    }
+    end = monotonicTimeNanos();
+
+    setReport(sv[1], 0x05, SIM_MODE_NONE);
+    simHidStop(&sim);
+    shutdown(sv[1], SHUT_RDWR);
+    fdReaderStop(&reader);
+
+    printf("capture     %llu sent, %llu dropped, %llu corrupted, %llu received, %u crc errors\n",
+           (unsigned long long)sim.samples, (unsigned long long)sim.link.messagesDropped,
+           (unsigned long long)sim.link.messagesCorrupted, (unsigned long long)samples, channel.decoder.crcErrors);
+    printf("            %.0f samples/s, %.2f MB/s, decode p50 %.3f us, p99 %.3f us\n",
+           samples/((end - start)/1e9), sim.link.bytesSent/((end - start)/1e9)/1e6,
+           latencyHistogramValueAtPercentile(&decode, 50)/1e3, latencyHistogramValueAtPercentile(&decode, 99)/1e3);
+
+    captureChannelFree(&channel);
+    close(sv[0]);
+    close(sv[1]);
+}
+
+// Minimal OBEX client for the benchmark. Returns the response code and copies
+// the body into body if given.
+static int obexRequest(int fd, const uint8_t *request, size_t length, uint8_t *response, size_t *responseLength)
+{
+    size_t have = 0, need = 3;
+    ssize_t n;
+
+    if (write(fd, request, length) != (ssize_t)length)
+        return -1;
+    while (have < need)
+    {
+        n = read(fd, response + have, need - have);
+        if (n <= 0)
+            return -1;
+        have += (size_t)n;
+        if (have == 3)
+            need = ((size_t)response[1] << 8) | response[2];
+    }
+    *responseLength = have;
+    return response[0];
+}
+
+static size_t putName(uint8_t *p, const char *name)
+{
+    size_t i, n = strlen(name), length = 3 + 2*(n + 1);
+
+    p[0] = 0x01;
+    p[1] = (uint8_t)(length >> 8);
+    p[2] = (uint8_t)length;
+    for (i = 0; i <= n; i++)
+    {
+        p[3 + 2*i] = 0;
+        p[4 + 2*i] = (uint8_t)name[i];
+    }
+    return length;
+}
+
+// Issues a GET until it completes, appending bodies. Returns total bytes.
+static size_t obexGet(int fd, const uint8_t *request, size_t length, char *body, size_t capacity, uint64_t *requests)
+{
+    uint8_t response[SIM_OBEX_MAX_PACKET];
+    size_t responseLength, total = 0;
+    const obexHeader_t *header;
+    obexPacket_t packet;
+    int code;
+
+    do
+    {
+        code = obexRequest(fd, request, length, response, &responseLength);
+        (*requests)++;
+        if (obexPacketParse(&packet, response, responseLength, 0) == 0 && (header = obexPacketBody(&packet)) != NULL)
+        {
+            if (body && total + header->length < capacity)
+                memcpy(body + total, response + header->offset, header->length);
+            total += header->length;
+        }
+    } while (code == 0x90);
+    if (body && total < capacity)
+        body[total] = '\0';
+    return total;
+}
+
+// Parses full size body responses in place and appends their bodies to a
+// sink, the way the SDK handles a download.
+static void benchmarkParse(double seconds)
+{
+    static uint8_t sink[1 << 20];
+    uint8_t packet[SIM_OBEX_MAX_PACKET];
+    size_t length = sizeof(packet), used = 0;
+    uint64_t packets = 0, bytes = 0, start, elapsed, i;
+    const obexHeader_t *header;
+    obexPacket_t parsed;
+
+    packet[0] = 0x90;
+    packet[1] = (uint8_t)(length >> 8);
+    packet[2] = (uint8_t)length;
+    packet[3] = OBEX_HEADER_BODY;
+    packet[4] = (uint8_t)((length - 3) >> 8);
+    packet[5] = (uint8_t)(length - 3);
+    for (i = 6; i < length; i++)
+        packet[i] = (uint8_t)i;
+
+    start = monotonicTimeNanos();
+    do
+    {
+        for (i = 0; i < 1024; i++)
+        {
+            if (obexPacketParse(&parsed, packet, length, 0) != 0 || (header = obexPacketBody(&parsed)) == NULL)
+            {
+                fprintf(stderr, "bbsim: cannot parse response\n");
+                exit(1);
+            }
+            if (used + header->length > sizeof(sink))
+                used = 0;
+            memcpy(sink + used, packet + header->offset, header->length);
+            used += header->length;
+            bytes += header->length;
+        }
+        packets += i;
+        elapsed = monotonicTimeNanos() - start;
+    } while (elapsed < seconds*1e9);
+
+    printf("parse       %llu responses of %zu bytes, %.0f packets/s, %.1f ns/packet, %.2f MB/s\n",
+           (unsigned long long)packets, length, packets/(elapsed/1e9), (double)elapsed/packets, bytes/(elapsed/1e9)/1e6);
+}
+
+static void benchmarkTransfer(const simObexConfig_t *config)
+{
+    static const uint8_t connect[] = {0x80, 0x00, 0x1A, 0x10, 0x00, 0x0F, 0xFF, 0x46, 0x00, 0x13,
+        0xF9, 0xEC, 0x7B, 0xC4, 0x95, 0x3C, 0x11, 0xD2, 0x98, 0x4E, 0x52, 0x54, 0x00, 0xDC, 0x9E, 0x09};
+    static char listing[1 << 20];
+    uint8_t request[600], response[SIM_OBEX_MAX_PACKET];
+    size_t length, responseLength, bytes = 0;
+    uint64_t requests = 0, start, elapsed;
+    unsigned files = 0;
+    char name[SIM_FS_NAME_MAX], *p, *q;
+    simObex_t sim;
+    int sv[2];
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0 || simObexStart(&sim, sv[0], config) != 0)
+    {
+        fprintf(stderr, "bbsim: cannot start transfer benchmark\n");
+        exit(1);
+    }
+
+    start = monotonicTimeNanos();
+    if (obexRequest(sv[1], connect, sizeof(connect), response, &responseLength) != 0xA0)
+    {
+        fprintf(stderr, "bbsim: connect failed\n");
+        exit(1);
+    }
+    requests++;
+
+    // GET with an empty name and the folder listing type.
+    length = 3;
+    request[length++] = 0x01;
+    request[length++] = 0x00;
+    request[length++] = 0x03;
+    request[length++] = 0x42;
+    request[length++] = 0x00;
+    request[length++] = 3 + 22;
+    memcpy(request + length, "x-obex/folder-listing", 22);
+    length += 22;
+    request[0] = 0x83;
+    request[1] = (uint8_t)(length >> 8);
+    request[2] = (uint8_t)length;
+    bytes += obexGet(sv[1], request, length, listing, sizeof(listing), &requests);
+
+    // GET every file in the listing.
+    for (p = listing; (p = strstr(p, "<file name=\"")) != NULL; p = q)
+    {
+        p += 12;
+        if ((q = strchr(p, '"')) == NULL || (size_t)(q - p) >= sizeof(name))
+            break;
+        memcpy(name, p, (size_t)(q - p));
+        name[q - p] = '\0';
+
+        length = 3 + putName(request + 3, name);
+        request[0] = 0x83;
+        request[1] = (uint8_t)(length >> 8);
+        request[2] = (uint8_t)length;
+        bytes += obexGet(sv[1], request, length, NULL, 0, &requests);
+        files++;
+    }
+    elapsed = monotonicTimeNanos() - start;
+
+    simObexStop(&sim);
+    close(sv[0]);
+    close(sv[1]);
+
+    printf("transfer    %u files, %zu bytes, %llu requests in %.3f s, %.2f MB/s\n",
+           files, bytes, (unsigned long long)requests, elapsed/1e9, bytes/(elapsed/1e9)/1e6);
+}
+
+int main(int argc, char *argv[])
+{
+    simHidConfig_t hid = {144.0, 0, SIM_MODE_NONE, {0, 0, 0, 0, 1}};
+    simObexConfig_t obex = {NULL, 8, 65536, {0, 0, 0, 0, 2}};
+    double benchmark = 0;
+    simHid_t hidSim;
+    simObex_t obexSim;
+    int hidFd, obexFd, opt;
+    sigset_t signals;
+
+    while ((opt = getopt(argc, argv, "r:n:p:l:d:c:f:s:mb:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'r': hid.sampleRate = atof(optarg); break;
+            case 'n': hid.sampleLimit = strtoull(optarg, NULL, 10); break;
+            case 'p': hid.link.packetSize = obex.link.packetSize = strtoul(optarg, NULL, 10); break;
+            case 'l': hid.link.latencyNanos = obex.link.latencyNanos = (uint64_t)(atof(optarg)*1e6); break;
+            case 'd': hid.link.lossRate = obex.link.lossRate = atof(optarg); break;
+            case 'c': hid.link.corruptRate = atof(optarg); break;
+            case 'f': obex.root = optarg; break;
+            case 's': obex.generatedFileSize = strtoul(optarg, NULL, 10); break;
+            case 'm': hid.initialMode = SIM_MODE_CAPTURE; break;
+            case 'b': benchmark = atof(optarg); break;
+            default: usage();
+        }
+    }
+    if (optind != argc)
+        usage();
+
+    if (benchmark > 0)
+    {
+        benchmarkCapture(&hid, benchmark);
+        benchmarkParse(benchmark);
+        if (obex.link.lossRate == 0)
+            benchmarkTransfer(&obex);
+        return 0;
+    }
+
+    // Serve on ptys until interrupted.
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+    if ((hidFd = openPty("HID")) < 0 || (obexFd = openPty("FTP")) < 0)
+    {
+        fprintf(stderr, "bbsim: cannot open ptys\n");
+        return 1;
+    }
+    fflush(stdout);
+    if (simHidStart(&hidSim, hidFd, &hid) != 0 || simObexStart(&obexSim, obexFd, &obex) != 0)
+    {
+        fprintf(stderr, "bbsim: cannot start simulator\n");
+        return 1;
+    }
+
+    sigwait(&signals, &opt);
+    simHidStop(&hidSim);
+    simObexStop(&obexSim);
+    printf("%llu samples sent, %llu set reports, %llu FTP requests\n", (unsigned long long)hidSim.samples,
+           (unsigned long long)hidSim.setReports, (unsigned long long)obexSim.requests);
+    return 0;
+}
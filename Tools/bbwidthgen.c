@@ -0,0 +1,152 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Generates the dense line width grid (BBSyncSDK/Core/ink_width_grid_data.c)
+// from the measured line width table, and checks a built grid against the
+// table.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ink_width_grid.h"
+#include "monotonic_time.h"
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bbwidthgen [-c]\n"
+                    "  (none)  write the grid source to standard output\n"
+                    "  -c      check the built in grid against the table\n");
+    exit(2);
+}
+
+static void generate(void)
+{
+    float dist, pressure, width;
+    int r, c;
+
+    printf("// Generated by Tools/bbwidthgen from ink_width_table.c, do not edit.\n\n");
+    printf("#include \"ink_width_grid.h\"\n\n");
+    printf("const uint16_t inkWidthGrid[INK_WIDTH_GRID_ROWS][INK_WIDTH_GRID_COLUMNS] =\n{\n");
+    for (r = 0; r < INK_WIDTH_GRID_ROWS; r++)
+    {
+        dist = INK_WIDTH_GRID_DISTANCE_MIN + r*INK_WIDTH_GRID_DISTANCE_STEP;
+        printf("    // %d mm/s\n    {", r + 1);
+        for (c = 0; c < INK_WIDTH_GRID_COLUMNS; c++)
+        {
+            pressure = INK_WIDTH_GRID_PRESSURE_MIN + c*INK_WIDTH_GRID_PRESSURE_STEP;
+            width = inkWidthTableLookup(dist, pressure);
+            printf("%s%5ld%s", c % 10 ? " " : "\n        ", lroundf(width*INK_WIDTH_GRID_SCALE),
+                   c < INK_WIDTH_GRID_COLUMNS - 1 ? "," : "");
+        }
+        printf("\n    }%s\n", r < INK_WIDTH_GRID_ROWS - 1 ? "," : "");
+    }
+    printf("};\n");
+}
+
+#define CHECK_BATCH 4096
+
+static int check(void)
+{
+    static float dist[CHECK_BATCH], pressure[CHECK_BATCH], width[CHECK_BATCH];
+    float d, p, error, maxError = 0, maxDist = 0, maxPressure = 0;
+    uint64_t lookups = 0, start, gridNanos, tableNanos;
+    volatile float sink = 0;
+    size_t n = 0, i, mismatches = 0;
+
+    // Everything the filter can ask for: speeds past both ends of the table
+    // and every pressure the digitizer reports, in half units.
+    for (d = 0.0f; d < V2D(200.0f); d += 0.01f)
+    {
+        for (p = 0.0f; p <= 1023.0f; p += 0.5f)
+        {
+            dist[n] = d;
+            pressure[n] = p;
+            if (++n < CHECK_BATCH && !(d + 0.01f >= V2D(200.0f) && p == 1023.0f))
+                continue;
+
+            inkWidthGridLookupBatch(dist, pressure, width, n);
+            for (i = 0; i < n; i++)
+            {
+                if (width[i] != inkWidthGridLookup(dist[i], pressure[i]))
+                    mismatches++;
+                error = fabsf(width[i] - inkWidthTableLookup(dist[i], pressure[i]));
+                if (error > maxError)
+                {
+                    maxError = error;
+                    maxDist = dist[i];
+                    maxPressure = pressure[i];
+                }
+            }
+            lookups += n;
+            n = 0;
+        }
+    }
+
+    // Time both lookups over the last batch.
+    start = monotonicTimeNanos();
+    for (i = 0; i < 1000; i++)
+    {
+        inkWidthGridLookupBatch(dist, pressure, width, CHECK_BATCH);
+        sink += width[i];
+    }
+    gridNanos = monotonicTimeNanos() - start;
+    start = monotonicTimeNanos();
+    for (i = 0; i < 1000; i++)
+    {
+        for (n = 0; n < CHECK_BATCH; n++)
+            width[n] = inkWidthTableLookup(dist[n], pressure[n]);
+        sink += width[i];
+    }
+    tableNanos = monotonicTimeNanos() - start;
+
+    printf("lookups     %llu\n", (unsigned long long)lookups);
+    printf("max error   %.4f digitizer units at distance %.2f, pressure %.1f (tolerance %.4f)\n",
+           maxError, maxDist, maxPressure, INK_WIDTH_GRID_TOLERANCE);
+    printf("batch       %zu lookups differ from single lookups\n", mismatches);
+    printf("grid        %.2f ns/lookup\n", gridNanos/(1000.0*CHECK_BATCH));
+    printf("table       %.2f ns/lookup\n", tableNanos/(1000.0*CHECK_BATCH));
+
+    return maxError <= INK_WIDTH_GRID_TOLERANCE && mismatches == 0 ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    int opt, checking = 0;
+
+    while ((opt = getopt(argc, argv, "c")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c': checking = 1; break;
+            default: usage();
+        }
+    }
+    if (optind != argc)
+        usage();
+
+    if (checking)
+        return check();
+
+    generate();
+    return 0;
+}
@@ -0,0 +1,33 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _FILTER_BASELINE_H_
+#define _FILTER_BASELINE_H_
+
+#include "ink_filter.h"
+
+// The filter before profiles, for timing them against. A context reset here
+// must only be used with baselineFilterApplyBatch.
+void baselineFilterReset(inkFilter_t *f);
+
+size_t baselineFilterApplyBatch(inkFilter_t *f, const captureBatch_t *b, inkSegment_t out[INK_FILTER_BATCH_SEGMENTS],
+                                uint8_t segmentCounts[CAPTURE_BATCH_CAPACITY]);
+
+#endif /* _FILTER_BASELINE_H_ */
@@ -0,0 +1,239 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <errno.h>
+#include <math.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "capture_batch.h"
+#include "hid_slip.h"
+#include "monotonic_time.h"
+#include "sim_hid.h"
+
+#define CONTROL_CHANNEL         0x00
+#define INTERRUPT_CHANNEL       0x01
+#define SET_REPORT_TYPE         0x05
+#define DATA_MESSAGE_HEADER     0xA1    // Data message, input report.
+#define SET_REPORT_HEADER_LENGTH 5      // Channel, header, report id twice, reserved.
+
+#define REPORT_ID_OPERATION     0x04
+#define REPORT_ID_MODE          0x05
+#define REPORT_ID_DATE          0x06
+#define REPORT_ID_DEVICE        0x08
+#define OPERATION_ERASE         0x01
+
+#define HANDSHAKE_SUCCESSFUL    0x00
+#define HANDSHAKE_UNSUPPORTED   0x03
+
+// Samples generated per pass when running as fast as possible.
+#define FLAT_OUT_BURST          64
+
+// Synthetic strokes: pen down for a while, then hovering.
+#define STROKE_SAMPLES          240
+#define HOVER_SAMPLES           24
+#define DIGITIZER_MAX_X         20280
+#define DIGITIZER_MAX_Y         13942
+
+static void sendFrame(simHid_t *s, const uint8_t *frame, size_t length, uint64_t now)
+{
+    uint8_t encoded[HID_SLIP_FRAME_MAX(32)];
+    simLinkSend(&s->link, encoded, hidSlipEncodeFrame(frame, length, encoded), now);
+}
+
+static void sendSample(simHid_t *s, uint64_t now)
+{
+    uint64_t i = s->samples++;
+    uint64_t phase = i % (STROKE_SAMPLES + HOVER_SAMPLES);
+    double t = (double)i*0.013;
+    uint16_t x = (uint16_t)(DIGITIZER_MAX_X*(0.5 + 0.4*sin(3*t)));
+    uint16_t y = (uint16_t)(DIGITIZER_MAX_Y*(0.5 + 0.4*sin(2*t + 0.7)));
+    uint16_t pressure = 0;
+    uint8_t flags = CAPTURE_FLAG_READY;
+    uint8_t frame[3 + CAPTURE_REPORT_LENGTH];
+
+    if (phase < STROKE_SAMPLES)
+    {
+        flags |= CAPTURE_FLAG_TIP_SWITCH;
+        pressure = (uint16_t)(400 + 300*sin((double)phase*M_PI/STROKE_SAMPLES));
+    }
+    flags |= s->pendingFlags;
+    s->pendingFlags = 0;
+
+    frame[0] = INTERRUPT_CHANNEL;
+    frame[1] = DATA_MESSAGE_HEADER;
+    frame[2] = CAPTURE_REPORT_ID_DATA_CAPTURE;
+    frame[3] = (uint8_t)x;
+    frame[4] = (uint8_t)(x >> 8);
+    frame[5] = (uint8_t)y;
+    frame[6] = (uint8_t)(y >> 8);
+    frame[7] = (uint8_t)pressure;
+    frame[8] = (uint8_t)(pressure >> 8);
+    frame[9] = flags;
+    sendFrame(s, frame, sizeof(frame), now);
+}
+
+static void handshake(simHid_t *s, uint8_t result)
+{
+    uint8_t frame[2] = {CONTROL_CHANNEL, result};
+    sendFrame(s, frame, sizeof(frame), monotonicTimeNanos());
+}
+
+static int frameReceived(void *context, const uint8_t *frame, size_t length)
+{
+    simHid_t *s = context;
+    const uint8_t *payload = frame + SET_REPORT_HEADER_LENGTH;
+    size_t payloadLength = length - SET_REPORT_HEADER_LENGTH;
+
+    if (length < SET_REPORT_HEADER_LENGTH + 1 || frame[0] != CONTROL_CHANNEL || (frame[1] >> 4) != SET_REPORT_TYPE)
+    {
+        handshake(s, HANDSHAKE_UNSUPPORTED);
+        return 0;
+    }
+
+    s->setReports++;
+    switch (frame[2])
+    {
+        case REPORT_ID_MODE:
+            if (payload[0] == SIM_MODE_CAPTURE && s->mode != SIM_MODE_CAPTURE)
+                s->nextSample = monotonicTimeNanos();
+            s->mode = payload[0];
+            break;
+        case REPORT_ID_DATE:
+            memcpy(s->date, payload, payloadLength < 4 ? payloadLength : 4);
+            break;
+        case REPORT_ID_DEVICE:
+            memcpy(s->deviceFlags, payload, payloadLength < 4 ? payloadLength : 4);
+            break;
+        case REPORT_ID_OPERATION:
+            if (payload[0] == OPERATION_ERASE)
+                s->pendingFlags |= CAPTURE_FLAG_ERASE;
+            break;
+        default:
+            handshake(s, HANDSHAKE_UNSUPPORTED);
+            return 0;
+    }
+    handshake(s, HANDSHAKE_SUCCESSFUL);
+    return 0;
+}
+
+static int streaming(const simHid_t *s)
+{
+    return s->mode == SIM_MODE_CAPTURE && (s->config.sampleLimit == 0 || s->samples < s->config.sampleLimit);
+}
+
+static void *hidMain(void *context)
+{
+    simHid_t *s = context;
+    struct pollfd fds[2];
+    uint8_t buffer[1024];
+    uint64_t now, next, due, period;
+    ssize_t n;
+    int timeout, i;
+
+    period = s->config.sampleRate > 0 ? (uint64_t)(1e9/s->config.sampleRate) : 0;
+    fds[0].fd = s->wakeFds[0];
+    fds[0].events = POLLIN;
+    fds[1].fd = s->link.fd;
+    fds[1].events = POLLIN;
+
+    for (;;)
+    {
+        now = monotonicTimeNanos();
+        if (streaming(s))
+        {
+            if (period == 0)
+            {
+                for (i = 0; i < FLAT_OUT_BURST && streaming(s); i++)
+                    sendSample(s, now);
+            }
+            else
+            {
+                for (; s->nextSample <= now && streaming(s); s->nextSample += period)
+                    sendSample(s, s->nextSample);
+            }
+        }
+
+        due = simLinkFlush(&s->link, now);
+        if (due == 0)
+            break;
+
+        next = streaming(s) ? (period == 0 ? now : s->nextSample) : UINT64_MAX;
+        if (due < next)
+            next = due;
+        now = monotonicTimeNanos();
+        timeout = next == UINT64_MAX ? -1 : next <= now ? 0 : (int)((next - now + 999999)/1000000);
+
+        if (poll(fds, 2, timeout) < 0 && errno != EINTR)
+            break;
+        if (fds[0].revents & POLLIN)
+            break;
+        if (fds[1].revents & (POLLIN | POLLHUP | POLLERR))
+        {
+            n = read(s->link.fd, buffer, sizeof(buffer));
+            if (n <= 0)
+                break;
+            hidDecoderFeed(&s->decoder, buffer, (size_t)n, frameReceived, s);
+        }
+    }
+    return NULL;
+}
+
+int simHidStart(simHid_t *s, int fd, const simHidConfig_t *config)
+{
+    s->config = *config;
+    s->mode = config->initialMode ? config->initialMode : SIM_MODE_NONE;
+    s->samples = 0;
+    s->nextSample = monotonicTimeNanos();
+    s->pendingFlags = 0;
+    s->setReports = 0;
+    s->stopping = 0;
+    memset(s->date, 0, sizeof(s->date));
+    memset(s->deviceFlags, 0, sizeof(s->deviceFlags));
+    hidDecoderReset(&s->decoder);
+
+    if (simLinkInit(&s->link, fd, &config->link) != 0)
+        return -1;
+    if (pipe(s->wakeFds) != 0)
+    {
+        simLinkFree(&s->link);
+        return -1;
+    }
+    if (pthread_create(&s->thread, NULL, hidMain, s) != 0)
+    {
+        close(s->wakeFds[0]);
+        close(s->wakeFds[1]);
+        simLinkFree(&s->link);
+        return -1;
+    }
+    return 0;
+}
+
+void simHidStop(simHid_t *s)
+{
+    char stop = 's';
+
+    (void)write(s->wakeFds[1], &stop, 1);
+    pthread_join(s->thread, NULL);
+    close(s->wakeFds[0]);
+    close(s->wakeFds[1]);
+    simLinkFree(&s->link);
+}
@@ -0,0 +1,72 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _SIM_HID_H_
+#define _SIM_HID_H_
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "hid_decoder.h"
+#include "sim_link.h"
+
+// Sync modes set through the mode feature report.
+#define SIM_MODE_NONE       0x01
+#define SIM_MODE_CAPTURE    0x04
+#define SIM_MODE_FILE       0x05
+
+typedef struct
+{
+    double          sampleRate;     // Capture reports per second, 0 for as fast as possible.
+    uint64_t        sampleLimit;    // Stop streaming after this many samples, 0 for no limit.
+    uint8_t         initialMode;    // Mode before the client sets one.
+    simLinkConfig_t link;
+} simHidConfig_t;
+
+// Simulated HID side of a Sync: answers SetReports and streams SLIP framed
+// capture reports of synthetic strokes while in capture mode.
+typedef struct
+{
+    simHidConfig_t config;
+    simLink_t      link;
+    hidDecoder_t   decoder;
+    int            wakeFds[2];
+    int            stopping;
+    pthread_t      thread;
+
+    // Device state.
+    uint8_t        mode;
+    uint8_t        date[4];
+    uint8_t        deviceFlags[4];
+
+    // Stroke generator.
+    uint64_t       samples;
+    uint64_t       nextSample;      // Monotonic ns the next sample is due.
+    uint8_t        pendingFlags;    // One-shot flags for the next sample.
+
+    uint64_t       setReports;
+} simHid_t;
+
+// Starts serving on fd, which stays owned by the caller. Returns 0 on success.
+int simHidStart(simHid_t *s, int fd, const simHidConfig_t *config);
+
+void simHidStop(simHid_t *s);
+
+#endif /* _SIM_HID_H_ */
@@ -0,0 +1,121 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sim_link.h"
+
+#define OUT_BUFFER_SIZE     65536
+
+// Only messages up to this length are corrupted.
+#define CORRUPT_MAX_LENGTH  512
+
+int simLinkInit(simLink_t *l, int fd, const simLinkConfig_t *config)
+{
+    l->fd = fd;
+    l->config = *config;
+    l->head = l->tail = 0;
+    l->random = config->seed ? config->seed : 0x9E3779B97F4A7C15ull;
+    l->messagesSent = l->messagesDropped = l->messagesCorrupted = 0;
+    l->bytesSent = 0;
+    return byteRingInit(&l->out, OUT_BUFFER_SIZE);
+}
+
+void simLinkFree(simLink_t *l)
+{
+    byteRingFree(&l->out);
+}
+
+double simLinkRandom(simLink_t *l)
+{
+    // xorshift64*
+    l->random ^= l->random >> 12;
+    l->random ^= l->random << 25;
+    l->random ^= l->random >> 27;
+    return (double)((l->random*0x2545F4914F6CDD1Dull) >> 11)/9007199254740992.0;
+}
+
+void simLinkSend(simLink_t *l, const uint8_t *bytes, size_t length, uint64_t now)
+{
+    uint8_t corrupted[CORRUPT_MAX_LENGTH];
+
+    if (l->config.lossRate > 0 && simLinkRandom(l) < l->config.lossRate)
+    {
+        l->messagesDropped++;
+        return;
+    }
+
+    if (l->config.corruptRate > 0 && length > 0 && length <= sizeof(corrupted) &&
+        simLinkRandom(l) < l->config.corruptRate)
+    {
+        memcpy(corrupted, bytes, length);
+        corrupted[(size_t)(simLinkRandom(l)*length)] ^= 0x5A;
+        bytes = corrupted;
+        l->messagesCorrupted++;
+    }
+
+    // Make room by sending early rather than growing the FIFO without bound.
+    if (l->tail - l->head == SIM_LINK_MAX_PENDING)
+        simLinkFlush(l, l->pending[(l->tail - 1) % SIM_LINK_MAX_PENDING].due);
+
+    if (byteRingWrite(&l->out, bytes, length) != 0)
+        return;
+    l->pending[l->tail % SIM_LINK_MAX_PENDING].due = now + l->config.latencyNanos;
+    l->pending[l->tail % SIM_LINK_MAX_PENDING].length = length;
+    l->tail++;
+}
+
+uint64_t simLinkFlush(simLink_t *l, uint64_t now)
+{
+    simLinkMessage_t *m;
+    const uint8_t *bytes;
+    size_t length;
+    ssize_t n;
+
+    while (l->head != l->tail)
+    {
+        m = &l->pending[l->head % SIM_LINK_MAX_PENDING];
+        if (m->due > now)
+            return m->due;
+
+        while (m->length > 0)
+        {
+            bytes = byteRingReadPointer(&l->out, &length);
+            if (length > m->length)
+                length = m->length;
+            if (l->config.packetSize > 0 && length > l->config.packetSize)
+                length = l->config.packetSize;
+
+            n = write(l->fd, bytes, length);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return 0;
+            byteRingConsume(&l->out, (size_t)n);
+            m->length -= (size_t)n;
+            l->bytesSent += (size_t)n;
+        }
+        l->head++;
+        l->messagesSent++;
+    }
+    return UINT64_MAX;
+}
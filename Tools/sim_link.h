@@ -0,0 +1,77 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _SIM_LINK_H_
+#define _SIM_LINK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "byte_ring.h"
+
+// Conditions applied to everything a simulated device sends.
+typedef struct
+{
+    size_t   packetSize;        // Largest single write, 0 for unlimited.
+    uint64_t latencyNanos;      // Delay between a message being ready and sent.
+    double   lossRate;          // Probability of dropping a whole message.
+    double   corruptRate;       // Probability of flipping one byte of a message.
+    unsigned seed;
+} simLinkConfig_t;
+
+#define SIM_LINK_MAX_PENDING    1024
+
+typedef struct
+{
+    uint64_t due;
+    size_t   length;
+} simLinkMessage_t;
+
+// Sending side of a simulated link. Messages wait in a FIFO until their due
+// time and are then written in packetSize pieces.
+typedef struct
+{
+    int              fd;
+    simLinkConfig_t  config;
+    byteRing_t       out;
+    simLinkMessage_t pending[SIM_LINK_MAX_PENDING];
+    size_t           head, tail;
+    uint64_t         random;
+    uint64_t         messagesSent;
+    uint64_t         messagesDropped;
+    uint64_t         messagesCorrupted;
+    uint64_t         bytesSent;
+} simLink_t;
+
+int simLinkInit(simLink_t *l, int fd, const simLinkConfig_t *config);
+
+void simLinkFree(simLink_t *l);
+
+// Queues a message that became ready at now, subject to loss and corruption.
+void simLinkSend(simLink_t *l, const uint8_t *bytes, size_t length, uint64_t now);
+
+// Writes every message due by now. Returns the due time of the next pending
+// message, or UINT64_MAX if none is left, or 0 if the peer went away.
+uint64_t simLinkFlush(simLink_t *l, uint64_t now);
+
+// Uniform random number in [0, 1) from the link's generator.
+double simLinkRandom(simLink_t *l);
+
+#endif /* _SIM_LINK_H_ */
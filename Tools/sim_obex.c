@@ -0,0 +1,586 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <dirent.h>
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "monotonic_time.h"
+#include "sim_obex.h"
+
+// Operation codes, all with the final bit set.
+#define OP_CONNECT          0x80
+#define OP_DISCONNECT       0x81
+#define OP_PUT              0x82
+#define OP_GET              0x83
+#define OP_SET_PATH         0x85
+#define OP_ACTION           0x86
+#define OP_ABORT            0xFF
+
+#define RESPONSE_CONTINUE   0x90
+#define RESPONSE_SUCCESS    0xA0
+#define RESPONSE_BAD_REQUEST 0xC0
+#define RESPONSE_NOT_FOUND  0xC4
+#define RESPONSE_NOT_IMPLEMENTED 0xD1
+
+#define HEADER_NAME         0x01
+#define HEADER_TYPE         0x42
+#define HEADER_BODY         0x48
+#define HEADER_END_OF_BODY  0x49
+#define HEADER_CONNECTION_ID 0xCB
+
+#define SET_PATH_BACKUP     0x01
+
+#define OBEX_VERSION        0x10
+#define PACKET_HEADER_LENGTH 3
+#define IN_BUFFER_SIZE      8192
+
+static const char folderListingType[] = "x-obex/folder-listing";
+
+// File tree.
+
+static simFsNode_t *fsAdd(simFsNode_t *parent, const char *name, int folder)
+{
+    simFsNode_t *node = calloc(1, sizeof(simFsNode_t));
+    if (node == NULL)
+        return NULL;
+
+    snprintf(node->name, sizeof(node->name), "%s", name);
+    node->folder = folder;
+    node->modified = time(NULL);
+    node->parent = parent;
+    if (parent)
+    {
+        node->next = parent->children;
+        parent->children = node;
+    }
+    return node;
+}
+
+static void fsFree(simFsNode_t *node)
+{
+    simFsNode_t *child, *next;
+
+    for (child = node->children; child; child = next)
+    {
+        next = child->next;
+        fsFree(child);
+    }
+    free(node->data);
+    free(node);
+}
+
+static void fsLoad(simFsNode_t *folder, const char *path)
+{
+    char childPath[4096];
+    struct dirent *entry;
+    struct stat st;
+    simFsNode_t *node;
+    FILE *file;
+    DIR *dir;
+
+    dir = opendir(path);
+    if (dir == NULL)
+        return;
+
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (entry->d_name[0] == '.')
+            continue;
+        snprintf(childPath, sizeof(childPath), "%s/%s", path, entry->d_name);
+        node = NULL;
+        if (stat(childPath, &st) != 0)
+            continue;
+
+        if (S_ISDIR(st.st_mode))
+        {
+            if ((node = fsAdd(folder, entry->d_name, 1)) != NULL)
+                fsLoad(node, childPath);
+        }
+        else if (S_ISREG(st.st_mode) && (node = fsAdd(folder, entry->d_name, 0)) != NULL)
+        {
+            node->size = (size_t)st.st_size;
+            node->data = malloc(node->size ? node->size : 1);
+            if ((file = fopen(childPath, "rb")) != NULL)
+            {
+                node->size = fread(node->data, 1, node->size, file);
+                fclose(file);
+            }
+        }
+        if (node)
+            node->modified = st.st_mtime;
+    }
+    closedir(dir);
+}
+
+static void fsGenerate(simFsNode_t *root, unsigned files, size_t size)
+{
+    char name[32];
+    simFsNode_t *node;
+    unsigned i;
+    size_t j;
+
+    for (i = 1; i <= files; i++)
+    {
+        snprintf(name, sizeof(name), "SYNC%04u.PDF", i);
+        if ((node = fsAdd(root, name, 0)) == NULL || (node->data = malloc(size + 16)) == NULL)
+            continue;
+        node->size = (size_t)snprintf((char *)node->data, 16, "%%PDF-1.4\n");
+        for (j = node->size; j < size; j++)
+            node->data[j] = (uint8_t)(' ' + (i + j) % 95);
+        if (size > node->size)
+            node->size = size;
+    }
+    fsAdd(root, "ERASED", 1);
+}
+
+static simFsNode_t *fsFind(simFsNode_t *folder, const char *name, int wantFolder)
+{
+    simFsNode_t *node;
+
+    for (node = folder->children; node; node = node->next)
+    {
+        if (node->folder == wantFolder && strcmp(node->name, name) == 0)
+            return node;
+    }
+    return NULL;
+}
+
+static void fsRemove(simFsNode_t *node)
+{
+    simFsNode_t **link;
+
+    for (link = &node->parent->children; *link; link = &(*link)->next)
+    {
+        if (*link == node)
+        {
+            *link = node->next;
+            node->next = NULL;
+            fsFree(node);
+            return;
+        }
+    }
+}
+
+// Requests.
+
+typedef struct
+{
+    const uint8_t *name;        // UTF-16BE, NULL if absent.
+    size_t         nameLength;
+    const uint8_t *type;
+    size_t         typeLength;
+} requestHeaders_t;
+
+static int parseHeaders(const uint8_t *p, size_t length, requestHeaders_t *h)
+{
+    size_t offset = 0, headerLength;
+    uint8_t id;
+
+    memset(h, 0, sizeof(*h));
+    while (offset < length)
+    {
+        id = p[offset];
+        switch (id >> 6)
+        {
+            case 0:     // Unicode text and byte sequences carry a length.
+            case 1:
+                if (length - offset < 3)
+                    return -1;
+                headerLength = ((size_t)p[offset + 1] << 8) | p[offset + 2];
+                if (headerLength < 3 || headerLength > length - offset)
+                    return -1;
+                if (id == HEADER_NAME)
+                {
+                    h->name = p + offset + 3;
+                    h->nameLength = headerLength - 3;
+                }
+                else if (id == HEADER_TYPE)
+                {
+                    h->type = p + offset + 3;
+                    h->typeLength = headerLength - 3;
+                }
+                break;
+            case 2:
+                headerLength = 2;
+                break;
+            default:
+                headerLength = 5;
+                break;
+        }
+        offset += headerLength;
+    }
+    return offset == length ? 0 : -1;
+}
+
+// Converts a null terminated UTF-16BE name to UTF-8.
+static void nameToUTF8(const uint8_t *name, size_t length, char *dst, size_t size)
+{
+    size_t i, n = 0;
+    unsigned c;
+
+    for (i = 0; i + 1 < length && n + 4 < size; i += 2)
+    {
+        c = ((unsigned)name[i] << 8) | name[i + 1];
+        if (c == 0)
+            break;
+        if (c < 0x80)
+        {
+            dst[n++] = (char)c;
+        }
+        else if (c < 0x800)
+        {
+            dst[n++] = (char)(0xC0 | (c >> 6));
+            dst[n++] = (char)(0x80 | (c & 0x3F));
+        }
+        else if (c < 0xD800 || c > 0xDFFF)
+        {
+            dst[n++] = (char)(0xE0 | (c >> 12));
+            dst[n++] = (char)(0x80 | ((c >> 6) & 0x3F));
+            dst[n++] = (char)(0x80 | (c & 0x3F));
+        }
+        else
+        {
+            dst[n++] = '?';
+        }
+    }
+    dst[n] = '\0';
+}
+
+static void respond(simObex_t *s, uint8_t code, const uint8_t *headers, size_t length)
+{
+    uint8_t packet[SIM_OBEX_MAX_PACKET];
+    size_t total = PACKET_HEADER_LENGTH + length;
+
+    packet[0] = code;
+    packet[1] = (uint8_t)(total >> 8);
+    packet[2] = (uint8_t)total;
+    memcpy(packet + PACKET_HEADER_LENGTH, headers, length);
+    simLinkSend(&s->link, packet, total, monotonicTimeNanos());
+}
+
+static void endGet(simObex_t *s)
+{
+    if (s->getOwned)
+        free(s->getData);
+    s->getData = NULL;
+    s->getLength = s->getOffset = 0;
+    s->getOwned = 0;
+}
+
+// Sends the next piece of the get in progress.
+static void continueGet(simObex_t *s)
+{
+    uint8_t headers[SIM_OBEX_MAX_PACKET];
+    size_t space = s->maxPacket - PACKET_HEADER_LENGTH - 3;
+    size_t remaining = s->getLength - s->getOffset;
+    size_t length = remaining < space ? remaining : space;
+    int last = remaining <= space;
+
+    headers[0] = last ? HEADER_END_OF_BODY : HEADER_BODY;
+    headers[1] = (uint8_t)((length + 3) >> 8);
+    headers[2] = (uint8_t)(length + 3);
+    memcpy(headers + 3, s->getData + s->getOffset, length);
+    s->getOffset += length;
+
+    respond(s, last ? RESPONSE_SUCCESS : RESPONSE_CONTINUE, headers, length + 3);
+    if (last)
+        endGet(s);
+}
+
+static char *folderListing(const simFsNode_t *folder, size_t *length)
+{
+    size_t capacity = 512, used = 0;
+    char *xml = malloc(capacity), *grown;
+    const simFsNode_t *node;
+    char modified[32];
+    struct tm tm;
+    int n;
+
+    if (xml == NULL)
+        return NULL;
+
+#define APPEND(...) \
+    while ((n = snprintf(xml + used, capacity - used, __VA_ARGS__)) >= (int)(capacity - used)) \
+    { \
+        if ((grown = realloc(xml, capacity *= 2)) == NULL) { free(xml); return NULL; } \
+        xml = grown; \
+    } \
+    used += (size_t)n
+
+    APPEND("<?xml version=\"1.0\"?>\n<!DOCTYPE folder-listing SYSTEM \"obex-folder-listing.dtd\">\n"
+           "<folder-listing version=\"1.0\">\n");
+    if (folder->parent)
+    {
+        APPEND("<parent-folder/>\n");
+    }
+    for (node = folder->children; node; node = node->next)
+    {
+        localtime_r(&node->modified, &tm);
+        strftime(modified, sizeof(modified), "%Y%m%dT%H%M%S", &tm);
+        if (node->folder)
+        {
+            APPEND("<folder name=\"%s\" modified=\"%s\"/>\n", node->name, modified);
+        }
+        else
+        {
+            APPEND("<file name=\"%s\" size=\"%zu\" modified=\"%s\"/>\n", node->name, node->size, modified);
+        }
+    }
+    APPEND("</folder-listing>\n");
+#undef APPEND
+
+    *length = used;
+    return xml;
+}
+
+static void handleGet(simObex_t *s, const requestHeaders_t *h)
+{
+    char name[SIM_FS_NAME_MAX];
+    simFsNode_t *file;
+
+    if (s->getData == NULL)
+    {
+        if (h->type && h->typeLength >= sizeof(folderListingType) - 1 &&
+            memcmp(h->type, folderListingType, sizeof(folderListingType) - 1) == 0)
+        {
+            s->getData = (uint8_t *)folderListing(s->cwd, &s->getLength);
+            s->getOwned = 1;
+        }
+        else if (h->name)
+        {
+            nameToUTF8(h->name, h->nameLength, name, sizeof(name));
+            if ((file = fsFind(s->cwd, name, 0)) == NULL)
+            {
+                respond(s, RESPONSE_NOT_FOUND, NULL, 0);
+                return;
+            }
+            s->getData = file->data;
+            s->getLength = file->size;
+            s->getOwned = 0;
+        }
+        if (s->getData == NULL)
+        {
+            respond(s, RESPONSE_BAD_REQUEST, NULL, 0);
+            return;
+        }
+        s->getOffset = 0;
+    }
+    continueGet(s);
+}
+
+static void handlePacket(simObex_t *s, const uint8_t *p, size_t length)
+{
+    char name[SIM_FS_NAME_MAX];
+    requestHeaders_t h;
+    simFsNode_t *node;
+    size_t offset = PACKET_HEADER_LENGTH;
+    uint8_t headers[16];
+
+    s->requests++;
+    if (p[0] == OP_CONNECT)
+        offset = 7;
+    else if (p[0] == OP_SET_PATH)
+        offset = 5;
+    if (length < offset || parseHeaders(p + offset, length - offset, &h) != 0)
+    {
+        respond(s, RESPONSE_BAD_REQUEST, NULL, 0);
+        return;
+    }
+
+    switch (p[0])
+    {
+        case OP_CONNECT:
+            s->maxPacket = ((size_t)p[5] << 8) | p[6];
+            if (s->maxPacket > SIM_OBEX_MAX_PACKET || s->maxPacket < 255)
+                s->maxPacket = SIM_OBEX_MAX_PACKET;
+            s->cwd = s->root;
+            s->connectionId++;
+            endGet(s);
+            headers[0] = OBEX_VERSION;
+            headers[1] = 0x00;
+            headers[2] = (uint8_t)(SIM_OBEX_MAX_PACKET >> 8);
+            headers[3] = (uint8_t)SIM_OBEX_MAX_PACKET;
+            headers[4] = HEADER_CONNECTION_ID;
+            headers[5] = (uint8_t)(s->connectionId >> 24);
+            headers[6] = (uint8_t)(s->connectionId >> 16);
+            headers[7] = (uint8_t)(s->connectionId >> 8);
+            headers[8] = (uint8_t)s->connectionId;
+            respond(s, RESPONSE_SUCCESS, headers, 9);
+            break;
+        case OP_DISCONNECT:
+        case OP_ACTION:
+            respond(s, RESPONSE_SUCCESS, NULL, 0);
+            break;
+        case OP_ABORT:
+            endGet(s);
+            respond(s, RESPONSE_SUCCESS, NULL, 0);
+            break;
+        case OP_SET_PATH:
+            name[0] = '\0';
+            if (h.name)
+                nameToUTF8(h.name, h.nameLength, name, sizeof(name));
+            if (p[3] & SET_PATH_BACKUP)
+            {
+                if (s->cwd->parent)
+                    s->cwd = s->cwd->parent;
+            }
+            else if (name[0] == '\0')
+            {
+                s->cwd = s->root;
+            }
+            else if ((node = fsFind(s->cwd, name, 1)) != NULL)
+            {
+                s->cwd = node;
+            }
+            else
+            {
+                respond(s, RESPONSE_NOT_FOUND, NULL, 0);
+                break;
+            }
+            respond(s, RESPONSE_SUCCESS, NULL, 0);
+            break;
+        case OP_GET:
+            handleGet(s, &h);
+            break;
+        case OP_PUT:
+            // A put without a body deletes the named file.
+            name[0] = '\0';
+            if (h.name)
+                nameToUTF8(h.name, h.nameLength, name, sizeof(name));
+            if ((node = fsFind(s->cwd, name, 0)) == NULL)
+            {
+                respond(s, RESPONSE_NOT_FOUND, NULL, 0);
+                break;
+            }
+            if (s->getData == node->data)
+                endGet(s);
+            fsRemove(node);
+            respond(s, RESPONSE_SUCCESS, NULL, 0);
+            break;
+        default:
+            respond(s, RESPONSE_NOT_IMPLEMENTED, NULL, 0);
+            break;
+    }
+}
+
+// Thread.
+
+static void *obexMain(void *context)
+{
+    simObex_t *s = context;
+    struct pollfd fds[2];
+    const uint8_t *p;
+    uint8_t *space;
+    size_t length, packetLength;
+    uint64_t due, now;
+    ssize_t n;
+    int timeout;
+
+    fds[0].fd = s->wakeFds[0];
+    fds[0].events = POLLIN;
+    fds[1].fd = s->link.fd;
+    fds[1].events = POLLIN;
+
+    for (;;)
+    {
+        now = monotonicTimeNanos();
+        due = simLinkFlush(&s->link, now);
+        if (due == 0)
+            break;
+        timeout = due == UINT64_MAX ? -1 : (int)((due - now + 999999)/1000000);
+
+        if (poll(fds, 2, timeout) < 0 && errno != EINTR)
+            break;
+        if (fds[0].revents & POLLIN)
+            break;
+        if (!(fds[1].revents & (POLLIN | POLLHUP | POLLERR)))
+            continue;
+
+        space = byteRingWritePointer(&s->in, 1024, &length);
+        if (space == NULL)
+            break;
+        n = read(s->link.fd, space, length);
+        if (n <= 0)
+            break;
+        byteRingCommit(&s->in, (size_t)n);
+
+        while (byteRingReadable(&s->in) >= PACKET_HEADER_LENGTH)
+        {
+            p = byteRingPeek(&s->in, PACKET_HEADER_LENGTH);
+            packetLength = ((size_t)p[1] << 8) | p[2];
+            if (packetLength < PACKET_HEADER_LENGTH)
+            {
+                byteRingClear(&s->in);
+                break;
+            }
+            if ((p = byteRingPeek(&s->in, packetLength)) == NULL)
+                break;
+            handlePacket(s, p, packetLength);
+            byteRingConsume(&s->in, packetLength);
+        }
+    }
+    return NULL;
+}
+
+int simObexStart(simObex_t *s, int fd, const simObexConfig_t *config)
+{
+    s->config = *config;
+    s->connectionId = 0;
+    s->maxPacket = SIM_OBEX_MAX_PACKET;
+    s->getData = NULL;
+    s->getLength = s->getOffset = 0;
+    s->getOwned = 0;
+    s->requests = 0;
+
+    s->root = fsAdd(NULL, "", 1);
+    if (s->root == NULL)
+        return -1;
+    if (config->root)
+        fsLoad(s->root, config->root);
+    else
+        fsGenerate(s->root, config->generatedFiles, config->generatedFileSize);
+    s->cwd = s->root;
+
+    if (byteRingInit(&s->in, IN_BUFFER_SIZE) != 0 || simLinkInit(&s->link, fd, &config->link) != 0)
+        return -1;
+    if (pipe(s->wakeFds) != 0 || pthread_create(&s->thread, NULL, obexMain, s) != 0)
+        return -1;
+    return 0;
+}
+
+void simObexStop(simObex_t *s)
+{
+    char stop = 's';
+
+    (void)write(s->wakeFds[1], &stop, 1);
+    pthread_join(s->thread, NULL);
+    close(s->wakeFds[0]);
+    close(s->wakeFds[1]);
+    endGet(s);
+    simLinkFree(&s->link);
+    byteRingFree(&s->in);
+    fsFree(s->root);
+}
@@ -0,0 +1,88 @@
+// Copyright © 2014 Kent Displays, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _SIM_OBEX_H_
+#define _SIM_OBEX_H_
+
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "byte_ring.h"
+#include "sim_link.h"
+
+#define SIM_FS_NAME_MAX     256
+
+// Largest packet the server sends or accepts.
+#define SIM_OBEX_MAX_PACKET 4095
+
+// In-memory file tree served by the simulator.
+typedef struct simFsNode
+{
+    char              name[SIM_FS_NAME_MAX];
+    int               folder;
+    uint8_t          *data;
+    size_t            size;
+    time_t            modified;
+    struct simFsNode *parent;
+    struct simFsNode *children;
+    struct simFsNode *next;
+} simFsNode_t;
+
+typedef struct
+{
+    const char     *root;               // Host directory to serve, NULL to generate files.
+    unsigned        generatedFiles;     // Files generated when there is no root.
+    size_t          generatedFileSize;
+    simLinkConfig_t link;
+} simObexConfig_t;
+
+// Simulated OBEX File Transfer server of a Sync: connect, disconnect, set
+// path, folder listings, file gets, deletes and aborts. Deletes only touch the
+// in-memory tree, never the served directory.
+typedef struct
+{
+    simObexConfig_t config;
+    simLink_t       link;
+    byteRing_t      in;
+    int             wakeFds[2];
+    pthread_t       thread;
+
+    simFsNode_t    *root;
+    simFsNode_t    *cwd;
+    uint32_t        connectionId;
+    size_t          maxPacket;
+
+    // Get in progress, continued by every further GET until it completes.
+    uint8_t        *getData;
+    size_t          getLength;
+    size_t          getOffset;
+    int             getOwned;
+
+    uint64_t        requests;
+} simObex_t;
+
+// Loads or generates the file tree and starts serving on fd, which stays
+// owned by the caller. Returns 0 on success.
+int simObexStart(simObex_t *s, int fd, const simObexConfig_t *config);
+
+void simObexStop(simObex_t *s);
+
+#endif /* _SIM_OBEX_H_ */